@@ -0,0 +1,170 @@
+/**
+ * @file ast_walk.cpp
+ * @brief Generic AST traversal for the Bishop code generator.
+ *
+ * Analysis passes (escape checks, range proofs) walk function bodies
+ * through these helpers instead of re-listing every node type.
+ */
+
+#include "codegen.hpp"
+
+using namespace std;
+
+namespace codegen {
+
+/**
+ * Calls visit on every direct child of a node, in source order.
+ */
+void for_each_child(const ASTNode& node, const function<void(const ASTNode&)>& visit) {
+    auto visit_opt = [&](const unique_ptr<ASTNode>& child) {
+        if (child) {
+            visit(*child);
+        }
+    };
+
+    auto visit_all = [&](const vector<unique_ptr<ASTNode>>& children) {
+        for (const auto& child : children) {
+            visit_opt(child);
+        }
+    };
+
+    if (auto* bin = dynamic_cast<const BinaryExpr*>(&node)) {
+        visit_opt(bin->left);
+        visit_opt(bin->right);
+    } else if (auto* fstr = dynamic_cast<const FormatString*>(&node)) {
+        visit_all(fstr->values);
+    } else if (auto* is_none = dynamic_cast<const IsNone*>(&node)) {
+        visit_opt(is_none->value);
+    } else if (auto* not_expr = dynamic_cast<const NotExpr*>(&node)) {
+        visit_opt(not_expr->value);
+    } else if (auto* neg = dynamic_cast<const NegateExpr*>(&node)) {
+        visit_opt(neg->value);
+    } else if (auto* spawn = dynamic_cast<const GoSpawn*>(&node)) {
+        visit_opt(spawn->call);
+    } else if (auto* paren = dynamic_cast<const ParenExpr*>(&node)) {
+        visit_opt(paren->value);
+    } else if (auto* addr = dynamic_cast<const AddressOf*>(&node)) {
+        visit_opt(addr->value);
+    } else if (auto* chan = dynamic_cast<const ChannelCreate*>(&node)) {
+        visit_opt(chan->capacity);
+    } else if (auto* list = dynamic_cast<const ListLiteral*>(&node)) {
+        visit_all(list->elements);
+    } else if (auto* map = dynamic_cast<const MapLiteral*>(&node)) {
+        for (const auto& [key, value] : map->entries) {
+            visit_opt(key);
+            visit_opt(value);
+        }
+    } else if (auto* pair = dynamic_cast<const PairCreate*>(&node)) {
+        visit_opt(pair->first);
+        visit_opt(pair->second);
+    } else if (auto* tuple = dynamic_cast<const TupleCreate*>(&node)) {
+        visit_all(tuple->elements);
+    } else if (auto* array = dynamic_cast<const ArrayCreate*>(&node)) {
+        visit_all(array->elements);
+    } else if (auto* set = dynamic_cast<const SetLiteral*>(&node)) {
+        visit_all(set->elements);
+    } else if (auto* select = dynamic_cast<const SelectStmt*>(&node)) {
+        for (const auto& c : select->cases) {
+            visit(*c);
+        }
+    } else if (auto* sc = dynamic_cast<const SelectCase*>(&node)) {
+        visit_opt(sc->channel);
+        visit_opt(sc->send_value);
+        visit_opt(sc->timeout);
+        visit_all(sc->body);
+    } else if (auto* call = dynamic_cast<const FunctionCall*>(&node)) {
+        visit_all(call->args);
+    } else if (auto* mcall = dynamic_cast<const MethodCall*>(&node)) {
+        visit_opt(mcall->object);
+        visit_all(mcall->args);
+    } else if (auto* scall = dynamic_cast<const StaticMethodCall*>(&node)) {
+        visit_all(scall->args);
+    } else if (auto* decl = dynamic_cast<const VariableDecl*>(&node)) {
+        visit_opt(decl->value);
+    } else if (auto* assign = dynamic_cast<const Assignment*>(&node)) {
+        visit_opt(assign->value);
+    } else if (auto* fa = dynamic_cast<const FieldAssignment*>(&node)) {
+        visit_opt(fa->object);
+        visit_opt(fa->value);
+    } else if (auto* ret = dynamic_cast<const ReturnStmt*>(&node)) {
+        visit_opt(ret->value);
+    } else if (auto* fail = dynamic_cast<const FailStmt*>(&node)) {
+        visit_opt(fail->value);
+    } else if (auto* or_ret = dynamic_cast<const OrReturn*>(&node)) {
+        visit_opt(or_ret->value);
+    } else if (auto* or_fail = dynamic_cast<const OrFail*>(&node)) {
+        visit_opt(or_fail->error_expr);
+    } else if (auto* or_block = dynamic_cast<const OrBlock*>(&node)) {
+        visit_all(or_block->body);
+    } else if (auto* or_match = dynamic_cast<const OrMatch*>(&node)) {
+        for (const auto& arm : or_match->arms) {
+            visit_opt(arm.body);
+        }
+    } else if (auto* def = dynamic_cast<const DefaultExpr*>(&node)) {
+        visit_opt(def->expr);
+        visit_opt(def->fallback);
+    } else if (auto* or_expr = dynamic_cast<const OrExpr*>(&node)) {
+        visit_opt(or_expr->expr);
+        visit_opt(or_expr->handler);
+    } else if (auto* with = dynamic_cast<const WithStmt*>(&node)) {
+        visit_opt(with->resource);
+        visit_all(with->body);
+    } else if (auto* if_stmt = dynamic_cast<const IfStmt*>(&node)) {
+        visit_opt(if_stmt->condition);
+        visit_all(if_stmt->then_body);
+        visit_all(if_stmt->else_body);
+    } else if (auto* while_stmt = dynamic_cast<const WhileStmt*>(&node)) {
+        visit_opt(while_stmt->condition);
+        visit_all(while_stmt->body);
+    } else if (auto* for_stmt = dynamic_cast<const ForStmt*>(&node)) {
+        visit_opt(for_stmt->range_start);
+        visit_opt(for_stmt->range_end);
+        visit_opt(for_stmt->iterable);
+        visit_all(for_stmt->body);
+    } else if (auto* lambda = dynamic_cast<const LambdaExpr*>(&node)) {
+        visit_all(lambda->body);
+    } else if (auto* lcall = dynamic_cast<const LambdaCall*>(&node)) {
+        visit_opt(lcall->callee);
+        visit_all(lcall->args);
+    } else if (auto* lit = dynamic_cast<const StructLiteral*>(&node)) {
+        for (const auto& [name, value] : lit->field_values) {
+            visit_opt(value);
+        }
+    } else if (auto* access = dynamic_cast<const FieldAccess*>(&node)) {
+        visit_opt(access->object);
+    }
+}
+
+/**
+ * Returns true if pred holds for the node or any node beneath it.
+ */
+bool any_node(const ASTNode& node, const function<bool(const ASTNode&)>& pred) {
+    if (pred(node)) {
+        return true;
+    }
+
+    bool found = false;
+
+    for_each_child(node, [&](const ASTNode& child) {
+        if (!found && any_node(child, pred)) {
+            found = true;
+        }
+    });
+
+    return found;
+}
+
+/**
+ * Returns true if pred holds for any node in a statement list.
+ */
+bool any_node(const vector<unique_ptr<ASTNode>>& nodes, const function<bool(const ASTNode&)>& pred) {
+    for (const auto& node : nodes) {
+        if (node && any_node(*node, pred)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace codegen
@@ -16,6 +16,16 @@
  * print("x =", x, "y =", y);
  */
 
+/**
+ * @bishop_fn flush
+ * @module builtins
+ * @description Writes any buffered print() output to standard output.
+ * @note Output is also flushed at exit, and after every line when stdout is a terminal. Set BISHOP_UNBUFFERED=1 to flush every print.
+ * @example
+ * print("progress: 50%");
+ * flush();
+ */
+
 /**
  * @bishop_fn assert_eq
  * @module builtins
@@ -70,6 +80,7 @@
 #include "stdlib/algo.hpp"
 #include "stdlib/yaml.hpp"
 #include "stdlib/markdown.hpp"
+#include "stdlib/runtime.hpp"
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
@@ -205,6 +216,13 @@ static bool has_markdown_import(const map<string, const Module*>& imports) {
     return imports.find("markdown") != imports.end();
 }
 
+/**
+ * Checks if the program imports the runtime module.
+ */
+static bool has_runtime_import(const map<string, const Module*>& imports) {
+    return imports.find("runtime") != imports.end();
+}
+
 /**
  * Checks if the program uses channels (requires boost fiber).
  */
@@ -284,9 +302,14 @@ string generate_module_namespace(CodeGenState& state, const string& name, const
         return bishop::stdlib::generate_markdown_runtime();
     }
 
+    if (name == "runtime") {
+        return bishop::stdlib::generate_runtime_runtime();
+    }
+
     string out = "namespace " + name + " {\n\n";
 
     const Program* saved_program = state.current_program;
+    auto saved_consts = state.const_values;
     state.current_program = module.ast.get();
 
     for (const auto* s : module.get_public_structs()) {
@@ -307,6 +330,7 @@ string generate_module_namespace(CodeGenState& state, const string& name, const
     }
 
     state.current_program = saved_program;
+    state.const_values = move(saved_consts);
 
     out += "} // namespace " + name + "\n\n";
     return out;
@@ -340,7 +364,7 @@ string generate(CodeGenState& state, const unique_ptr<Program>& program, bool te
 
     // Forward declare all structs
     for (const auto& s : program->structs) {
-        out += "struct " + s->name + ";\n";
+        out += template_header(s->type_params) + "struct " + s->name + ";\n";
     }
 
     if (!program->structs.empty()) {
@@ -470,6 +494,10 @@ string generate_with_imports(
         out += "#include <bishop/markdown.hpp>\n";
     }
 
+    if (has_runtime_import(imports)) {
+        out += "#include <bishop/runtime.hpp>\n";
+    }
+
     if (uses_channels(*program)) {
         out += "#include <bishop/channel.hpp>\n";
     }
@@ -600,7 +628,7 @@ string generate_with_imports(
 
     // Forward declare all structs
     for (const auto& s : program->structs) {
-        out += "struct " + s->name + ";\n";
+        out += template_header(s->type_params) + "struct " + s->name + ";\n";
     }
 
     if (!program->structs.empty()) {
@@ -674,6 +702,8 @@ string generate_with_imports(
 // Legacy class API for backwards compatibility
 string CodeGen::generate(const unique_ptr<Program>& program, bool test_mode) {
     CodeGenState state;
+    state.runtime = runtime;
+    state.source_file = source_file;
     return codegen::generate(state, program, test_mode);
 }
 
@@ -683,5 +713,7 @@ string CodeGen::generate_with_imports(
     bool test_mode
 ) {
     CodeGenState state;
+    state.runtime = runtime;
+    state.source_file = source_file;
     return codegen::generate_with_imports(state, program, imports, test_mode);
 }
@@ -10,7 +10,11 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <set>
 #include <vector>
+#include <variant>
+#include <optional>
+#include <functional>
 #include "parser/ast.hpp"
 #include "project/module.hpp"
 
@@ -23,6 +27,11 @@ struct CodeGenUsingAlias {
     std::string member_name;   ///< Original member name in module
 };
 
+/**
+ * @brief A value computed at transpile time: int, bool or str.
+ */
+using CodeGenConst = std::variant<long long, bool, std::string>;
+
 /**
  * @brief Code generator state passed to all generation functions.
  *
@@ -37,6 +46,14 @@ struct CodeGenState {
     std::map<std::string, const ExternFunctionDef*> extern_functions;
     std::vector<CodeGenUsingAlias> using_aliases;  ///< Using aliases from using statements
     std::string current_struct;  ///< Current struct name when emitting method body
+    std::set<const VariableDecl*> arena_locals;  ///< Locals allocated from the function's arena
+    std::set<const MethodCall*> unchecked_indexes;  ///< List.get() calls proven in bounds
+    std::map<std::string, CodeGenConst> const_values;  ///< Folded values of const declarations in scope
+    std::set<const VariableDecl*> const_tables;  ///< Const list/map literals emitted as static tables
+    std::set<const VariableRef*> moved_refs;  ///< Last uses of str/List locals emitted as std::move
+    std::set<const VariableDecl*> fixed_tuples;  ///< Inferred Tuple locals never reassigned, kept as std::array
+    RuntimeOptions runtime;  ///< Runtime settings the generated main() starts with
+    std::string source_file;  ///< File of the definition being emitted, for goroutine spawn sites
 };
 
 namespace codegen {
@@ -51,12 +68,37 @@ std::string generate_with_imports(
 );
 std::string generate_module_namespace(CodeGenState& state, const std::string& name, const Module& module);
 
+// AST traversal (ast_walk.cpp)
+void for_each_child(const ASTNode& node, const std::function<void(const ASTNode&)>& visit);
+bool any_node(const ASTNode& node, const std::function<bool(const ASTNode&)>& pred);
+bool any_node(const std::vector<std::unique_ptr<ASTNode>>& nodes, const std::function<bool(const ASTNode&)>& pred);
+
+// Arena allocation (emit_arena.cpp)
+bool collect_arena_locals(CodeGenState& state, const std::vector<std::unique_ptr<ASTNode>>& body, bool opt_in);
+bool local_escapes(const ASTNode& node, const VariableDecl& decl, const std::set<std::string>& safe_methods);
+std::string arena_binding();
+std::string emit_arena_decl(CodeGenState& state, const VariableDecl& decl);
+
+// Bounds-check elimination (emit_bounds.cpp)
+void collect_unchecked_indexes(CodeGenState& state, const std::vector<std::unique_ptr<ASTNode>>& body);
+
+// Last-use moves (emit_moves.cpp)
+void collect_last_uses(CodeGenState& state, const std::vector<std::unique_ptr<ASTNode>>& body,
+                       const std::vector<::FunctionParam>& params);
+
+// Compile-time evaluation (emit_const.cpp)
+std::optional<CodeGenConst> fold_constant(CodeGenState& state, const ASTNode& node);
+void collect_const_tables(CodeGenState& state, const std::vector<std::unique_ptr<ASTNode>>& body);
+std::string emit_const_decl(CodeGenState& state, const VariableDecl& decl, bool module_level);
+
 // FFI emission (emit_ffi.cpp)
 std::string generate_extern_declarations(const std::unique_ptr<Program>& program);
 
 // Type utilities (emit_type.cpp)
 std::string map_type(const std::string& t);
 std::string map_type_for_decl(const std::string& t);
+std::string template_header(const std::vector<std::string>& type_params);
+std::string template_args(const std::vector<std::string>& type_args);
 std::string extract_element_type(const std::string& generic_type, const std::string& prefix);
 
 // Name utilities (emit_name.cpp)
@@ -67,6 +109,8 @@ std::string emit(CodeGenState& state, const ASTNode& node);
 
 // Literals (emit_literals.cpp)
 std::string string_literal(const std::string& value);
+std::string c_string_literal(const std::string& value);
+std::string emit_format_string(CodeGenState& state, const FormatString& fstr);
 std::string number_literal(const std::string& value);
 std::string float_literal(const std::string& value);
 std::string bool_literal(bool value);
@@ -81,6 +125,7 @@ void collect_using_aliases(CodeGenState& state, const Program& program);
 
 // Binary expressions (emit_binary.cpp)
 std::string binary_expr(const std::string& left, const std::string& op, const std::string& right);
+std::string emit_str_concat(CodeGenState& state, const BinaryExpr& expr);
 std::string is_none(const std::string& value);
 std::string emit_not_expr(CodeGenState& state, const NotExpr& expr);
 std::string emit_negate_expr(CodeGenState& state, const NegateExpr& expr);
@@ -116,8 +161,13 @@ std::string emit_pair_field_access(const std::string& obj_str, const std::string
 
 // Tuple (emit_tuple.cpp)
 std::string emit_tuple_create(CodeGenState& state, const TupleCreate& tuple);
+void collect_fixed_tuples(CodeGenState& state, const std::vector<std::unique_ptr<ASTNode>>& body);
 std::string emit_tuple_method_call(CodeGenState& state, const MethodCall& call, const std::string& obj_str, const std::vector<std::string>& args);
 
+// Fixed-size array (emit_array.cpp)
+std::string emit_array_create(CodeGenState& state, const ArrayCreate& array);
+std::string emit_array_method_call(CodeGenState& state, const MethodCall& call, const std::string& obj_str, const std::vector<std::string>& args);
+
 // Deque (emit_deque.cpp)
 std::string emit_deque_create(const DequeCreate& deque);
 std::string emit_deque_method_call(CodeGenState& state, const MethodCall& call, const std::string& obj_str, const std::vector<std::string>& args);
@@ -139,12 +189,17 @@ std::string emit_set_create(const SetCreate& set);
 std::string emit_set_literal(CodeGenState& state, const SetLiteral& set);
 std::string emit_set_method_call(CodeGenState& state, const MethodCall& call, const std::string& obj_str, const std::vector<std::string>& args);
 
+// SoaList (emit_soa_list.cpp)
+std::string emit_soa_list_create(const SoaListCreate& soa);
+std::string emit_soa_list_method_call(CodeGenState& state, const MethodCall& call, const std::string& obj_str, const std::vector<std::string>& args);
+
 // Method call (emit_method_call.cpp)
 std::string method_call(const std::string& object, const std::string& method, const std::vector<std::string>& args);
 std::string emit_method_call(CodeGenState& state, const MethodCall& call);
 
 // Function call (emit_function_call.cpp)
 std::string function_call(const std::string& name, const std::vector<std::string>& args);
+std::string function_call_target(CodeGenState& state, const FunctionCall& call);
 std::string emit_function_call(CodeGenState& state, const FunctionCall& call);
 
 // Field access (emit_field.cpp)
@@ -158,10 +213,10 @@ std::string generate_with(CodeGenState& state, const WithStmt& stmt);
 std::string variable_decl(const std::string& type, const std::string& name, const std::string& value, bool is_optional = false, bool is_const = false);
 std::string return_stmt(const std::string& value);
 std::string assignment(const std::string& name, const std::string& value);
-std::string if_stmt(const std::string& condition, const std::vector<std::string>& then_body, const std::vector<std::string>& else_body);
+std::string if_stmt(const std::string& condition, const std::vector<std::string>& then_body, const std::vector<std::string>& else_body, bool then_cold = false, bool else_cold = false);
 std::string while_stmt(const std::string& condition, const std::vector<std::string>& body);
 std::string for_range_stmt(const std::string& var, const std::string& start, const std::string& end, const std::vector<std::string>& body);
-std::string for_each_stmt(const std::string& var, const std::string& collection, const std::vector<std::string>& body);
+std::string for_each_stmt(const std::string& var, const std::string& collection, const std::vector<std::string>& body, bool proxy = false);
 std::string print_multi(const std::vector<std::string>& args);
 std::string assert_eq(const std::string& a, const std::string& b, int line);
 std::string assert_ne(const std::string& a, const std::string& b, int line);
@@ -193,6 +248,10 @@ std::string method_def(const std::string& name, const std::vector<std::pair<std:
 // Struct emission (emit_struct.cpp)
 std::string generate_struct(CodeGenState& state, const StructDef& def);
 std::string generate_struct_fields_only(CodeGenState& state, const StructDef& def);
+std::vector<std::pair<std::string, std::string>> struct_layout(const StructDef& def);
+const StructDef* find_struct_def(const CodeGenState& state, const std::string& name);
+std::string soa_members(const std::string& name, const std::vector<std::pair<std::string, std::string>>& fields);
+std::string emit_struct_literal(CodeGenState& state, const StructLiteral& lit, const std::string& struct_name);
 std::string struct_def(const std::string& name, const std::vector<std::pair<std::string, std::string>>& fields);
 std::string struct_def_with_methods(const std::string& name, const std::vector<std::pair<std::string, std::string>>& fields, const std::vector<std::string>& method_bodies);
 std::string struct_literal(const std::string& name, const std::vector<std::pair<std::string, std::string>>& field_values);
@@ -208,6 +267,7 @@ std::string error_literal(const std::string& name, const std::string& message, c
 
 // Fail statement (emit_fail.cpp)
 std::string emit_fail(CodeGenState& state, const FailStmt& stmt);
+std::string static_error(const std::string& message, const std::string& error_type = "");
 
 // Or expression (emit_or.cpp)
 struct OrEmitResult {
@@ -230,6 +290,9 @@ std::string emit_default_expr(CodeGenState& state, const DefaultExpr& expr);
  */
 class CodeGen {
 public:
+    RuntimeOptions runtime;  ///< From the [runtime] section of bishop.toml
+    std::string source_file;  ///< Name of the file being compiled
+
     std::string generate(const std::unique_ptr<Program>& program, bool test_mode = false);
     std::string generate_with_imports(
         const std::unique_ptr<Program>& program,
@@ -0,0 +1,231 @@
+/**
+ * @file emit_arena.cpp
+ * @brief Arena allocation of non-escaping locals for the Bishop code generator.
+ *
+ * A local list or map that is created in a function and only ever used
+ * through its own methods or a for loop cannot outlive the call. Such locals
+ * are allocated from a per-call bishop::rt::Arena that is freed in one shot
+ * when the function returns.
+ */
+
+#include "codegen.hpp"
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <set>
+
+using namespace std;
+
+namespace codegen {
+
+/** @brief C++ variable holding the per-call arena */
+static const string ARENA_VAR = "_bishop_arena";
+
+/**
+ * List methods whose emitted code works on any vector type and never hands
+ * out the container itself.
+ */
+static const set<string> arena_list_methods = {
+    "length", "is_empty", "append", "pop", "get", "set", "clear",
+    "first", "last", "insert", "remove", "contains"
+};
+
+/**
+ * Map methods whose emitted code works on any map type.
+ */
+static const set<string> arena_map_methods = {
+    "length", "is_empty", "contains", "get", "set", "remove", "clear",
+    "keys", "values", "items"
+};
+
+/**
+ * Returns true if the node creates a fresh list or map.
+ */
+static bool creates_container(const ASTNode& value) {
+    return dynamic_cast<const ListCreate*>(&value) || dynamic_cast<const ListLiteral*>(&value) ||
+           dynamic_cast<const MapCreate*>(&value) || dynamic_cast<const MapLiteral*>(&value);
+}
+
+/**
+ * Returns true if the local may escape the function: it is referenced as a
+ * plain value (returned, passed, stored, printed), reassigned, shadowed,
+ * called with a method outside the safe set, or mentioned inside a lambda
+ * or goroutine.
+ */
+bool local_escapes(const ASTNode& node, const VariableDecl& decl, const set<string>& safe_methods) {
+    const string& name = decl.name;
+
+    if (auto* ref = dynamic_cast<const VariableRef*>(&node)) {
+        return ref->name == name;
+    }
+
+    if (auto* assign = dynamic_cast<const Assignment*>(&node); assign && assign->name == name) {
+        return true;
+    }
+
+    if (auto* other = dynamic_cast<const VariableDecl*>(&node); other && other != &decl && other->name == name) {
+        return true;
+    }
+
+    if (dynamic_cast<const LambdaExpr*>(&node) || dynamic_cast<const GoSpawn*>(&node)) {
+        return any_node(node, [&](const ASTNode& n) {
+            auto* ref = dynamic_cast<const VariableRef*>(&n);
+            return ref && ref->name == name;
+        });
+    }
+
+    if (auto* call = dynamic_cast<const MethodCall*>(&node)) {
+        auto* obj = dynamic_cast<const VariableRef*>(call->object.get());
+
+        if (obj && obj->name == name) {
+            if (!safe_methods.count(call->method_name)) {
+                return true;
+            }
+
+            for (const auto& arg : call->args) {
+                if (local_escapes(*arg, decl, safe_methods)) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    }
+
+    if (auto* loop = dynamic_cast<const ForStmt*>(&node)) {
+        auto* iter = dynamic_cast<const VariableRef*>(loop->iterable.get());
+
+        if (iter && iter->name == name) {
+            for (const auto& stmt : loop->body) {
+                if (local_escapes(*stmt, decl, safe_methods)) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    }
+
+    bool escapes = false;
+
+    for_each_child(node, [&](const ASTNode& child) {
+        escapes = escapes || local_escapes(child, decl, safe_methods);
+    });
+
+    return escapes;
+}
+
+/**
+ * Collects container declarations in a statement list. Lambda bodies are
+ * skipped since they may run after the function returns. Declarations
+ * inside loops are only taken when the function opted in with @arena,
+ * because the arena keeps every iteration's storage until return.
+ */
+static void collect_candidates(const ASTNode& node, bool in_loop, bool allow_loops,
+                               vector<const VariableDecl*>& out) {
+    if (dynamic_cast<const LambdaExpr*>(&node)) {
+        return;
+    }
+
+    if (auto* decl = dynamic_cast<const VariableDecl*>(&node)) {
+        if (decl->value && creates_container(*decl->value) && !decl->is_optional && !decl->is_const &&
+            (!in_loop || allow_loops)) {
+            out.push_back(decl);
+        }
+    }
+
+    bool child_in_loop = in_loop || dynamic_cast<const WhileStmt*>(&node) || dynamic_cast<const ForStmt*>(&node);
+
+    for_each_child(node, [&](const ASTNode& child) {
+        collect_candidates(child, child_in_loop, allow_loops, out);
+    });
+}
+
+/**
+ * Finds the local lists and maps of a function body that can live in the
+ * function's arena and records them in state.arena_locals.
+ * Returns true if the function needs an arena.
+ */
+bool collect_arena_locals(CodeGenState& state, const vector<unique_ptr<ASTNode>>& body, bool opt_in) {
+    vector<const VariableDecl*> candidates;
+
+    for (const auto& stmt : body) {
+        collect_candidates(*stmt, false, opt_in, candidates);
+    }
+
+    bool found = false;
+
+    for (const auto* decl : candidates) {
+        const string& type = decl->resolved_type;
+        const set<string>* methods = nullptr;
+
+        if (type.rfind("List<", 0) == 0) {
+            methods = &arena_list_methods;
+        } else if (type.rfind("Map<", 0) == 0) {
+            methods = &arena_map_methods;
+        }
+
+        if (!methods) {
+            continue;
+        }
+
+        bool escapes = false;
+
+        for (const auto& stmt : body) {
+            if (local_escapes(*stmt, *decl, *methods)) {
+                escapes = true;
+                break;
+            }
+        }
+
+        if (!escapes) {
+            state.arena_locals.insert(decl);
+            found = true;
+        }
+    }
+
+    return found || opt_in;
+}
+
+/**
+ * Emits the arena declaration that opens a function body.
+ */
+string arena_binding() {
+    return "bishop::rt::Arena " + ARENA_VAR + ";";
+}
+
+/**
+ * Emits an arena-backed declaration for a local recorded by
+ * collect_arena_locals, e.g. bishop::rt::ArenaList<int> xs({1, 2}, _bishop_arena);
+ */
+string emit_arena_decl(CodeGenState& state, const VariableDecl& decl) {
+    string cpp_type = map_type(decl.resolved_type);
+    string name = escape_reserved_name(decl.name);
+
+    if (cpp_type.rfind("std::vector<", 0) == 0) {
+        cpp_type = "bishop::rt::ArenaList<" + cpp_type.substr(12);
+    } else if (cpp_type.rfind("bishop::FlatMap<", 0) == 0) {
+        cpp_type = "bishop::rt::ArenaMap<" + cpp_type.substr(16);
+    }
+
+    vector<string> elements;
+
+    if (auto* list = dynamic_cast<const ListLiteral*>(decl.value.get())) {
+        for (const auto& elem : list->elements) {
+            elements.push_back(emit(state, *elem));
+        }
+
+        return fmt::format("{} {}({{{}}}, {});", cpp_type, name, fmt::join(elements, ", "), ARENA_VAR);
+    }
+
+    if (auto* map = dynamic_cast<const MapLiteral*>(decl.value.get())) {
+        for (const auto& [key, value] : map->entries) {
+            elements.push_back(fmt::format("{{{}, {}}}", emit(state, *key), emit(state, *value)));
+        }
+
+        return fmt::format("{} {}({{{}}}, {});", cpp_type, name, fmt::join(elements, ", "), ARENA_VAR);
+    }
+
+    return fmt::format("{} {}({});", cpp_type, name, ARENA_VAR);
+}
+
+} // namespace codegen
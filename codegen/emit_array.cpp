@@ -0,0 +1,68 @@
+/**
+ * @file emit_array.cpp
+ * @brief Fixed-size array emission for the Bishop code generator.
+ */
+
+#include "codegen.hpp"
+#include <fmt/format.h>
+
+using namespace std;
+
+namespace codegen {
+
+/**
+ * Emits an array creation: [3]int(1, 2, 3) -> std::array<int, 3>{1, 2, 3}.
+ * [N]T() value-initializes every element.
+ */
+string emit_array_create(CodeGenState& state, const ArrayCreate& array) {
+    string elements;
+
+    for (size_t i = 0; i < array.elements.size(); i++) {
+        if (i > 0) {
+            elements += ", ";
+        }
+
+        elements += emit(state, *array.elements[i]);
+    }
+
+    return fmt::format("std::array<{}, {}>{{{}}}", map_type(array.element_type), array.size, elements);
+}
+
+/**
+ * Emits an array method call, mapping Bishop methods to std::array equivalents.
+ */
+string emit_array_method_call(CodeGenState& state, const MethodCall& call, const string& obj_str, const vector<string>& args) {
+    if (call.method_name == "length") {
+        return obj_str + ".size()";
+    }
+
+    if (call.method_name == "get") {
+        // Indexes proven in bounds skip the check unless built with --checked
+        if (state.unchecked_indexes.count(&call)) {
+            return "bishop::rt::index_in_bounds(" + obj_str + ", " + args[0] + ")";
+        }
+
+        return obj_str + ".at(" + args[0] + ")";
+    }
+
+    if (call.method_name == "set") {
+        return obj_str + ".at(" + args[0] + ") = " + args[1];
+    }
+
+    if (call.method_name == "first") {
+        return obj_str + ".front()";
+    }
+
+    if (call.method_name == "last") {
+        return obj_str + ".back()";
+    }
+
+    if (call.method_name == "contains") {
+        return "(std::find(" + obj_str + ".begin(), " + obj_str + ".end(), " + args[0] + ") != " + obj_str + ".end())";
+    }
+
+    // Unknown array method - fall back to generic method call
+    return method_call(obj_str, call.method_name, args);
+}
+
+} // namespace codegen
@@ -5,6 +5,7 @@
 
 #include "codegen.hpp"
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 
 using namespace std;
 
@@ -17,6 +18,48 @@ string binary_expr(const string& left, const string& op, const string& right) {
     return fmt::format("{} {} {}", left, op, right);
 }
 
+/**
+ * Collects the operands of a chain of str `+`, looking through parentheses
+ * since concatenation is associative.
+ */
+static void collect_concat_parts(const ASTNode& node, vector<const ASTNode*>& parts) {
+    const ASTNode* inner = &node;
+
+    while (auto* paren = dynamic_cast<const ParenExpr*>(inner)) {
+        inner = paren->value.get();
+    }
+
+    if (auto* bin = dynamic_cast<const BinaryExpr*>(inner); bin && bin->str_concat) {
+        collect_concat_parts(*bin->left, parts);
+        collect_concat_parts(*bin->right, parts);
+        return;
+    }
+
+    parts.push_back(&node);
+}
+
+/**
+ * Emits a chain of str `+` as one bishop::rt::concat() call, which reserves
+ * the result once instead of allocating a temporary per `+`. Literal parts
+ * are passed as plain C++ literals so their length is known at compile time.
+ */
+string emit_str_concat(CodeGenState& state, const BinaryExpr& expr) {
+    vector<const ASTNode*> parts;
+    collect_concat_parts(expr, parts);
+
+    vector<string> args;
+
+    for (const ASTNode* part : parts) {
+        if (auto* lit = dynamic_cast<const StringLiteral*>(part)) {
+            args.push_back(c_string_literal(lit->value));
+        } else {
+            args.push_back(emit(state, *part));
+        }
+    }
+
+    return fmt::format("bishop::rt::concat({})", fmt::join(args, ", "));
+}
+
 /**
  * Emits an "is none" check using std::optional::has_value().
  */
@@ -0,0 +1,267 @@
+/**
+ * @file emit_bounds.cpp
+ * @brief Bounds-check elimination for list indexing in the Bishop code generator.
+ *
+ * List.get() is emitted as a checked .at() call. This pass proves some
+ * accesses in bounds so they can use plain indexing instead:
+ *   - xs.get(i) inside for i in <n>..xs.length() with n >= 0
+ *   - xs.get(k) with a constant k below the length of a list literal
+ * In both cases the list must not shrink and the index must not change
+ * while the proof is needed. Fixed-size arrays never change length, so
+ * the same loop form needs no shrink check and a constant index below N
+ * is always in bounds.
+ */
+
+#include "codegen.hpp"
+#include "common/type_utils.hpp"
+#include <algorithm>
+#include <set>
+
+using namespace std;
+
+namespace codegen {
+
+/**
+ * List methods that never make a list shorter.
+ */
+static const set<string> non_shrinking_methods = {
+    "length", "is_empty", "get", "set", "first", "last", "contains", "append", "insert", "join"
+};
+
+/**
+ * Returns true if the node is a reference to the named variable.
+ */
+static bool is_ref_to(const ASTNode* node, const string& name) {
+    auto* ref = dynamic_cast<const VariableRef*>(node);
+    return ref && ref->name == name;
+}
+
+/**
+ * Returns true for a List<T> value type (not a pointer to one).
+ */
+static bool is_list_type(const string& type) {
+    return type.rfind("List<", 0) == 0 && type.back() == '>';
+}
+
+/**
+ * Returns the length of a fixed-size array type, or -1 for other types.
+ */
+static long long array_length(const string& type) {
+    auto [size, element_type] = bishop::extract_array_type(type);
+
+    if (element_type.empty() || size.size() > 18) {
+        return -1;
+    }
+
+    return stoll(size);
+}
+
+/**
+ * Returns the value of a non-negative integer literal, or -1.
+ */
+static long long non_negative_literal(const ASTNode* node) {
+    auto* num = dynamic_cast<const NumberLiteral*>(node);
+
+    if (!num || num->value.empty() || num->value.find_first_not_of("0123456789") != string::npos ||
+        num->value.size() > 18) {
+        return -1;
+    }
+
+    return stoll(num->value);
+}
+
+/**
+ * Returns true if the named list keeps at least its current length
+ * everywhere under node: it is only used as the object of non-shrinking
+ * methods, never reassigned, shadowed, passed elsewhere, or touched by a
+ * lambda or goroutine. The declaring node itself, if any, is skipped.
+ */
+static bool list_keeps_length(const ASTNode& node, const string& name, const ASTNode* decl) {
+    if (is_ref_to(&node, name)) {
+        return false;
+    }
+
+    if (auto* assign = dynamic_cast<const Assignment*>(&node); assign && assign->name == name) {
+        return false;
+    }
+
+    if (auto* other = dynamic_cast<const VariableDecl*>(&node); other && other != decl && other->name == name) {
+        return false;
+    }
+
+    if (dynamic_cast<const LambdaExpr*>(&node) || dynamic_cast<const GoSpawn*>(&node)) {
+        return !any_node(node, [&](const ASTNode& n) { return is_ref_to(&n, name); });
+    }
+
+    if (auto* call = dynamic_cast<const MethodCall*>(&node); call && is_ref_to(call->object.get(), name)) {
+        if (!non_shrinking_methods.count(call->method_name)) {
+            return false;
+        }
+
+        for (const auto& arg : call->args) {
+            if (!list_keeps_length(*arg, name, decl)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool keeps = true;
+
+    for_each_child(node, [&](const ASTNode& child) {
+        keeps = keeps && list_keeps_length(child, name, decl);
+    });
+
+    return keeps;
+}
+
+/**
+ * Statement-list form of list_keeps_length.
+ */
+static bool list_keeps_length(const vector<unique_ptr<ASTNode>>& body, const string& name, const ASTNode* decl) {
+    for (const auto& stmt : body) {
+        if (!list_keeps_length(*stmt, name, decl)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Returns true if the loop variable is never reassigned or shadowed in the body.
+ */
+static bool var_unchanged(const vector<unique_ptr<ASTNode>>& body, const string& name) {
+    return !any_node(body, [&](const ASTNode& n) {
+        auto* assign = dynamic_cast<const Assignment*>(&n);
+        auto* decl = dynamic_cast<const VariableDecl*>(&n);
+        return (assign && assign->name == name) || (decl && decl->name == name);
+    });
+}
+
+/**
+ * Returns true if name is never redeclared in the body, so every
+ * reference to it there sees the same variable.
+ */
+static bool never_shadowed(const vector<unique_ptr<ASTNode>>& body, const string& name) {
+    return !any_node(body, [&](const ASTNode& n) {
+        auto* decl = dynamic_cast<const VariableDecl*>(&n);
+        auto* loop = dynamic_cast<const ForStmt*>(&n);
+        auto* lambda = dynamic_cast<const LambdaExpr*>(&n);
+
+        if (lambda) {
+            return ranges::any_of(lambda->params, [&](const auto& p) { return p.name == name; });
+        }
+
+        return (decl && decl->name == name) || (loop && loop->loop_var == name);
+    });
+}
+
+/**
+ * Records every list.get(index) call under the statements for which
+ * proves_index returns true.
+ */
+static void mark_gets(CodeGenState& state, const vector<unique_ptr<ASTNode>>& body, const string& list,
+                      const function<bool(const ASTNode&)>& proves_index) {
+    any_node(body, [&](const ASTNode& n) {
+        auto* call = dynamic_cast<const MethodCall*>(&n);
+
+        if (call && call->method_name == "get" && call->args.size() == 1 &&
+            (is_list_type(call->object_type) || array_length(call->object_type) >= 0) &&
+            is_ref_to(call->object.get(), list) &&
+            proves_index(*call->args[0])) {
+            state.unchecked_indexes.insert(call);
+        }
+
+        return false;
+    });
+}
+
+/**
+ * Proves xs.get(i) in bounds for loops of the form for i in <n>..xs.length().
+ */
+static void check_range_loop(CodeGenState& state, const ForStmt& loop) {
+    if (loop.kind != ForLoopKind::Range || non_negative_literal(loop.range_start.get()) < 0) {
+        return;
+    }
+
+    auto* end = dynamic_cast<const MethodCall*>(loop.range_end.get());
+
+    if (!end || end->method_name != "length") {
+        return;
+    }
+
+    auto* list = dynamic_cast<const VariableRef*>(end->object.get());
+
+    if (!list || !var_unchanged(loop.body, loop.loop_var)) {
+        return;
+    }
+
+    if (array_length(end->object_type) >= 0) {
+        // Any array reachable by this name has the same length
+        if (!never_shadowed(loop.body, list->name)) {
+            return;
+        }
+    } else if (!is_list_type(end->object_type) || !list_keeps_length(loop.body, list->name, nullptr)) {
+        return;
+    }
+
+    mark_gets(state, loop.body, list->name, [&](const ASTNode& index) {
+        return is_ref_to(&index, loop.loop_var);
+    });
+}
+
+/**
+ * Proves xs.get(k) in bounds for a constant k and a list literal xs.
+ */
+static void check_literal_list(CodeGenState& state, const VariableDecl& decl,
+                               const vector<unique_ptr<ASTNode>>& body) {
+    auto* literal = dynamic_cast<const ListLiteral*>(decl.value.get());
+
+    if (!literal || !list_keeps_length(body, decl.name, &decl)) {
+        return;
+    }
+
+    long long size = static_cast<long long>(literal->elements.size());
+
+    mark_gets(state, body, decl.name, [&](const ASTNode& index) {
+        long long k = non_negative_literal(&index);
+        return k >= 0 && k < size;
+    });
+}
+
+/**
+ * Proves arr.get(k) in bounds for a constant k below the array's length.
+ */
+static void check_constant_array_index(CodeGenState& state, const MethodCall& call) {
+    if (call.method_name != "get" || call.args.size() != 1) {
+        return;
+    }
+
+    long long k = non_negative_literal(call.args[0].get());
+
+    if (k >= 0 && k < array_length(call.object_type)) {
+        state.unchecked_indexes.insert(&call);
+    }
+}
+
+/**
+ * Finds list.get() calls in a function body that are provably in bounds
+ * and records them in state.unchecked_indexes.
+ */
+void collect_unchecked_indexes(CodeGenState& state, const vector<unique_ptr<ASTNode>>& body) {
+    any_node(body, [&](const ASTNode& n) {
+        if (auto* loop = dynamic_cast<const ForStmt*>(&n)) {
+            check_range_loop(state, *loop);
+        } else if (auto* decl = dynamic_cast<const VariableDecl*>(&n)) {
+            check_literal_list(state, *decl, body);
+        } else if (auto* call = dynamic_cast<const MethodCall*>(&n)) {
+            check_constant_array_index(state, *call);
+        }
+
+        return false;
+    });
+}
+
+} // namespace codegen
@@ -0,0 +1,502 @@
+/**
+ * @file emit_const.cpp
+ * @brief Compile-time evaluation of constants for the Bishop code generator.
+ *
+ * Const declarations whose initializer folds to a literal are emitted as
+ * constexpr (int, bool) or static const (str) data. Const list and map
+ * literals of folded values become static tables: a std::array for lists
+ * and a perfect-hash bishop::rt::ConstMap for maps, when the code only
+ * reads them through methods those tables support.
+ */
+
+#include "codegen.hpp"
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <climits>
+#include <cstdint>
+#include <set>
+
+using namespace std;
+
+namespace codegen {
+
+/** List methods a std::array table can serve. */
+static const set<string> table_list_methods = {
+    "length", "is_empty", "get", "first", "last", "contains"
+};
+
+/** Map methods a ConstMap table can serve. */
+static const set<string> table_map_methods = {
+    "length", "is_empty", "contains", "get", "keys", "values", "items"
+};
+
+/**
+ * Pure int helpers from the math module that are folded with literal arguments.
+ */
+static optional<long long> fold_math_call(const string& name, const vector<long long>& args) {
+    if (name == "math.abs_int" && args.size() == 1) {
+        return args[0] < 0 ? -args[0] : args[0];
+    }
+
+    if (name == "math.min_int" && args.size() == 2) {
+        return min(args[0], args[1]);
+    }
+
+    if (name == "math.max_int" && args.size() == 2) {
+        return max(args[0], args[1]);
+    }
+
+    if (name == "math.clamp_int" && args.size() == 3) {
+        return args[0] < args[1] ? args[1] : (args[0] > args[2] ? args[2] : args[0]);
+    }
+
+    if ((name == "math.gcd" || name == "math.lcm") && args.size() == 2) {
+        long long a = args[0] < 0 ? -args[0] : args[0];
+        long long b = args[1] < 0 ? -args[1] : args[1];
+        long long x = a, y = b;
+
+        while (y != 0) {
+            long long t = x % y;
+            x = y;
+            y = t;
+        }
+
+        if (name == "math.gcd") {
+            return x;
+        }
+
+        return (a == 0 || b == 0) ? 0 : a / x * b;
+    }
+
+    return nullopt;
+}
+
+/**
+ * Folds an int/int binary operation. Division by zero is left to runtime.
+ */
+static optional<CodeGenConst> fold_int_op(const string& op, long long a, long long b) {
+    if (op == "+") return a + b;
+    if (op == "-") return a - b;
+    if (op == "*") return a * b;
+    if (op == "/" && b != 0) return a / b;
+    if (op == "%" && b != 0) return a % b;
+    if (op == "==") return a == b;
+    if (op == "!=") return a != b;
+    if (op == "<") return a < b;
+    if (op == "<=") return a <= b;
+    if (op == ">") return a > b;
+    if (op == ">=") return a >= b;
+    return nullopt;
+}
+
+/**
+ * Folds a binary expression whose operands are both constants.
+ */
+static optional<CodeGenConst> fold_binary(const string& op, const CodeGenConst& left, const CodeGenConst& right) {
+    if (auto* a = get_if<long long>(&left)) {
+        if (auto* b = get_if<long long>(&right)) {
+            return fold_int_op(op, *a, *b);
+        }
+    }
+
+    if (auto* a = get_if<string>(&left)) {
+        if (auto* b = get_if<string>(&right)) {
+            if (op == "+") return *a + *b;
+            if (op == "==") return *a == *b;
+            if (op == "!=") return *a != *b;
+        }
+    }
+
+    if (auto* a = get_if<bool>(&left)) {
+        if (auto* b = get_if<bool>(&right)) {
+            if (op == "==") return *a == *b;
+            if (op == "!=") return *a != *b;
+        }
+    }
+
+    return nullopt;
+}
+
+/**
+ * Folds an expression to a constant, or returns nullopt if it depends on
+ * runtime values. Int results must fit Bishop's int so folding never
+ * changes overflow behavior.
+ */
+optional<CodeGenConst> fold_constant(CodeGenState& state, const ASTNode& node) {
+    optional<CodeGenConst> result;
+
+    if (auto* num = dynamic_cast<const NumberLiteral*>(&node)) {
+        if (!num->value.empty() && num->value.size() <= 10 &&
+            num->value.find_first_not_of("0123456789") == string::npos) {
+            result = stoll(num->value);
+        }
+    } else if (auto* b = dynamic_cast<const BoolLiteral*>(&node)) {
+        result = b->value;
+    } else if (auto* str = dynamic_cast<const StringLiteral*>(&node)) {
+        result = str->value;
+    } else if (auto* paren = dynamic_cast<const ParenExpr*>(&node)) {
+        result = fold_constant(state, *paren->value);
+    } else if (auto* neg = dynamic_cast<const NegateExpr*>(&node)) {
+        auto value = fold_constant(state, *neg->value);
+
+        if (value && holds_alternative<long long>(*value)) {
+            result = -get<long long>(*value);
+        }
+    } else if (auto* not_expr = dynamic_cast<const NotExpr*>(&node)) {
+        auto value = fold_constant(state, *not_expr->value);
+
+        if (value && holds_alternative<bool>(*value)) {
+            result = !get<bool>(*value);
+        }
+    } else if (auto* ref = dynamic_cast<const VariableRef*>(&node)) {
+        auto it = state.const_values.find(ref->name);
+
+        if (it != state.const_values.end()) {
+            result = it->second;
+        }
+    } else if (auto* bin = dynamic_cast<const BinaryExpr*>(&node)) {
+        auto left = fold_constant(state, *bin->left);
+        auto right = left ? fold_constant(state, *bin->right) : nullopt;
+
+        if (left && right) {
+            result = fold_binary(bin->op, *left, *right);
+        }
+    } else if (auto* call = dynamic_cast<const MethodCall*>(&node)) {
+        if (call->method_name == "length" && call->args.empty()) {
+            auto value = fold_constant(state, *call->object);
+
+            if (value && holds_alternative<string>(*value)) {
+                result = static_cast<long long>(get<string>(*value).size());
+            }
+        }
+    } else if (auto* call = dynamic_cast<const FunctionCall*>(&node)) {
+        vector<long long> args;
+
+        for (const auto& arg : call->args) {
+            auto value = fold_constant(state, *arg);
+
+            if (!value || !holds_alternative<long long>(*value)) {
+                return nullopt;
+            }
+
+            args.push_back(get<long long>(*value));
+        }
+
+        if (auto value = fold_math_call(call->name, args)) {
+            result = *value;
+        }
+    }
+
+    if (result && holds_alternative<long long>(*result)) {
+        long long v = get<long long>(*result);
+
+        if (v < INT_MIN || v > INT_MAX) {
+            return nullopt;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * Emits a folded constant as a C++ literal.
+ */
+static string const_literal(const CodeGenConst& value) {
+    if (auto* i = get_if<long long>(&value)) {
+        return to_string(*i);
+    }
+
+    if (auto* b = get_if<bool>(&value)) {
+        return *b ? "true" : "false";
+    }
+
+    return string_literal(get<string>(value));
+}
+
+/**
+ * Folds every expression in a list, or returns false if any one is not
+ * constant or the values are of mixed kinds.
+ */
+static bool fold_all(CodeGenState& state, const vector<const ASTNode*>& nodes, vector<CodeGenConst>& out) {
+    for (const auto* node : nodes) {
+        auto value = fold_constant(state, *node);
+
+        if (!value || (!out.empty() && value->index() != out.front().index())) {
+            return false;
+        }
+
+        out.push_back(*value);
+    }
+
+    return !out.empty();
+}
+
+/**
+ * Splits the template arguments of a C++ type at top-level commas:
+ * bishop::FlatMap<std::string, int> -> {"std::string", "int"}
+ */
+static vector<string> template_args(const string& cpp_type) {
+    vector<string> args;
+    size_t open = cpp_type.find('<');
+
+    if (open == string::npos || cpp_type.back() != '>') {
+        return args;
+    }
+
+    int depth = 0;
+    string current;
+
+    for (size_t i = open + 1; i + 1 < cpp_type.size(); i++) {
+        char c = cpp_type[i];
+
+        if (c == '<') depth++;
+        if (c == '>') depth--;
+
+        if (c == ',' && depth == 0) {
+            args.push_back(current);
+            current.clear();
+            continue;
+        }
+
+        if (!(c == ' ' && current.empty())) {
+            current += c;
+        }
+    }
+
+    args.push_back(current);
+    return args;
+}
+
+/**
+ * Transpile-time copy of bishop::rt::const_map_hash (const_map.hpp).
+ */
+static uint64_t const_map_hash(const CodeGenConst& key, uint64_t seed) {
+    uint64_t h;
+
+    if (auto* s = get_if<string>(&key)) {
+        h = 14695981039346656037ull ^ seed;
+
+        for (char c : *s) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 1099511628211ull;
+        }
+    } else {
+        h = (static_cast<uint64_t>(static_cast<int64_t>(get<long long>(key))) ^ seed) * 0x9E3779B97F4A7C15ull;
+    }
+
+    return h ^ (h >> 29);
+}
+
+/**
+ * Finds a seed and power-of-two table size that give every key its own
+ * slot. Fills slots with entry indexes (-1 for empty) and returns the seed.
+ */
+static uint64_t perfect_hash(const vector<CodeGenConst>& keys, vector<int>& slots) {
+    size_t size = 2;
+
+    while (size < keys.size() * 2) {
+        size *= 2;
+    }
+
+    for (;; size *= 2) {
+        for (uint64_t seed = 0; seed < 4096; seed++) {
+            slots.assign(size, -1);
+            bool collided = false;
+
+            for (size_t i = 0; i < keys.size() && !collided; i++) {
+                int& slot = slots[const_map_hash(keys[i], seed) & (size - 1)];
+                collided = slot >= 0;
+                slot = static_cast<int>(i);
+            }
+
+            if (!collided) {
+                return seed;
+            }
+        }
+    }
+}
+
+/**
+ * Returns the elements of a list literal as plain pointers.
+ */
+static vector<const ASTNode*> list_elements(const ListLiteral& list) {
+    vector<const ASTNode*> nodes;
+
+    for (const auto& elem : list.elements) {
+        nodes.push_back(elem.get());
+    }
+
+    return nodes;
+}
+
+/**
+ * Returns true if a map literal's keys are distinct constants usable as
+ * ConstMap keys (all int or all str).
+ */
+static bool table_keys(CodeGenState& state, const MapLiteral& map, vector<CodeGenConst>& keys) {
+    vector<const ASTNode*> nodes;
+
+    for (const auto& [key, value] : map.entries) {
+        nodes.push_back(key.get());
+    }
+
+    if (!fold_all(state, nodes, keys) || holds_alternative<bool>(keys.front())) {
+        return false;
+    }
+
+    set<CodeGenConst> distinct(keys.begin(), keys.end());
+    return distinct.size() == keys.size();
+}
+
+/**
+ * Finds const list and map literals in a function body that are only read
+ * through table-friendly methods and for loops, and records them in
+ * state.const_tables.
+ */
+void collect_const_tables(CodeGenState& state, const vector<unique_ptr<ASTNode>>& body) {
+    any_node(body, [&](const ASTNode& n) {
+        auto* decl = dynamic_cast<const VariableDecl*>(&n);
+
+        if (!decl || !decl->is_const || !decl->value) {
+            return false;
+        }
+
+        const set<string>* methods = nullptr;
+        vector<CodeGenConst> values;
+
+        if (auto* list = dynamic_cast<const ListLiteral*>(decl->value.get())) {
+            if (fold_all(state, list_elements(*list), values) && !holds_alternative<string>(values.front())) {
+                methods = &table_list_methods;
+            }
+        } else if (auto* map = dynamic_cast<const MapLiteral*>(decl->value.get())) {
+            if (table_keys(state, *map, values)) {
+                methods = &table_map_methods;
+            }
+        }
+
+        bool escapes = !methods;
+
+        for (const auto& stmt : body) {
+            escapes = escapes || local_escapes(*stmt, *decl, *methods);
+        }
+
+        if (!escapes) {
+            state.const_tables.insert(decl);
+        }
+
+        return false;
+    });
+}
+
+/**
+ * Emits a const list literal of folded values as static data:
+ * a constexpr std::array for tables, else a static const std::vector.
+ */
+static string emit_const_list(CodeGenState& state, const VariableDecl& decl, const ListLiteral& list) {
+    vector<CodeGenConst> values;
+
+    if (!fold_all(state, list_elements(list), values)) {
+        return "";
+    }
+
+    vector<string> literals;
+
+    for (const auto& value : values) {
+        literals.push_back(const_literal(value));
+    }
+
+    string vector_type = map_type(decl.resolved_type);
+    string name = escape_reserved_name(decl.name);
+
+    if (state.const_tables.count(&decl)) {
+        string elem_type = template_args(vector_type).at(0);
+        return fmt::format("static constexpr std::array<{}, {}> {} = {{{}}};",
+                           elem_type, values.size(), name, fmt::join(literals, ", "));
+    }
+
+    return fmt::format("static const {} {} = {{{}}};", vector_type, name, fmt::join(literals, ", "));
+}
+
+/**
+ * Emits a const map literal of folded keys and values as static data:
+ * a perfect-hash ConstMap for tables, else a static const FlatMap.
+ */
+static string emit_const_map(CodeGenState& state, const VariableDecl& decl, const MapLiteral& map) {
+    vector<CodeGenConst> keys;
+    vector<CodeGenConst> values;
+    vector<const ASTNode*> value_nodes;
+
+    for (const auto& [key, value] : map.entries) {
+        value_nodes.push_back(value.get());
+    }
+
+    if (!table_keys(state, map, keys) || !fold_all(state, value_nodes, values)) {
+        return "";
+    }
+
+    string map_cpp_type = map_type(decl.resolved_type);
+    string name = escape_reserved_name(decl.name);
+    vector<string> entries;
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        entries.push_back(fmt::format("{{{}, {}}}", const_literal(keys[i]), const_literal(values[i])));
+    }
+
+    if (!state.const_tables.count(&decl)) {
+        return fmt::format("static const {} {} = {{{}}};", map_cpp_type, name, fmt::join(entries, ", "));
+    }
+
+    vector<string> args = template_args(map_cpp_type);
+    vector<int> slots;
+    uint64_t seed = perfect_hash(keys, slots);
+    bool is_literal_type = args.at(0) != "std::string" && args.at(1) != "std::string";
+
+    return fmt::format("static {} bishop::rt::ConstMap<{}, {}, {}, {}> {}{{{{{{{}}}}}, {{{{{}}}}}, {}ull}};",
+                       is_literal_type ? "constexpr" : "const", args.at(0), args.at(1),
+                       keys.size(), slots.size(), name, fmt::join(entries, ", "), fmt::join(slots, ", "), seed);
+}
+
+/**
+ * Emits a const declaration evaluated at transpile time and records its
+ * value for later folding. Returns an empty string if the initializer is
+ * not constant, in which case the declaration is emitted normally.
+ */
+string emit_const_decl(CodeGenState& state, const VariableDecl& decl, bool module_level) {
+    state.const_values.erase(decl.name);
+
+    if (!decl.is_const || decl.is_optional || !decl.value) {
+        return "";
+    }
+
+    if (auto* list = dynamic_cast<const ListLiteral*>(decl.value.get())) {
+        return module_level ? "" : emit_const_list(state, decl, *list);
+    }
+
+    if (auto* map = dynamic_cast<const MapLiteral*>(decl.value.get())) {
+        return module_level ? "" : emit_const_map(state, decl, *map);
+    }
+
+    auto value = fold_constant(state, *decl.value);
+
+    if (!value) {
+        return "";
+    }
+
+    state.const_values[decl.name] = *value;
+    string name = escape_reserved_name(decl.name);
+
+    if (holds_alternative<string>(*value)) {
+        return fmt::format("static const std::string {} = {};", name, const_literal(*value));
+    }
+
+    string type = decl.type;
+
+    if (type.empty()) {
+        type = holds_alternative<bool>(*value) ? "bool" : "int";
+    }
+
+    return fmt::format("{}constexpr {} {} = {};", module_level ? "static " : "", map_type(type),
+                       name, const_literal(*value));
+}
+
+} // namespace codegen
@@ -7,6 +7,7 @@
  */
 
 #include "codegen.hpp"
+#include <algorithm>
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
@@ -24,6 +25,10 @@ string emit(CodeGenState& state, const ASTNode& node) {
         return string_literal(lit->value);
     }
 
+    if (auto* fstr = dynamic_cast<const FormatString*>(&node)) {
+        return emit_format_string(state, *fstr);
+    }
+
     if (auto* lit = dynamic_cast<const NumberLiteral*>(&node)) {
         return number_literal(lit->value);
     }
@@ -55,6 +60,10 @@ string emit(CodeGenState& state, const ASTNode& node) {
             return module_name + "::" + alias->member_name;
         }
 
+        if (state.moved_refs.count(ref)) {
+            return "std::move(" + variable_ref(ref->name) + ")";
+        }
+
         return variable_ref(ref->name);
     }
 
@@ -63,6 +72,10 @@ string emit(CodeGenState& state, const ASTNode& node) {
     }
 
     if (auto* expr = dynamic_cast<const BinaryExpr*>(&node)) {
+        if (expr->str_concat) {
+            return emit_str_concat(state, *expr);
+        }
+
         return binary_expr(emit(state, *expr->left), expr->op, emit(state, *expr->right));
     }
 
@@ -114,6 +127,10 @@ string emit(CodeGenState& state, const ASTNode& node) {
         return emit_tuple_create(state, *tuple);
     }
 
+    if (auto* array = dynamic_cast<const ArrayCreate*>(&node)) {
+        return emit_array_create(state, *array);
+    }
+
     if (auto* deque = dynamic_cast<const DequeCreate*>(&node)) {
         return emit_deque_create(*deque);
     }
@@ -138,6 +155,10 @@ string emit(CodeGenState& state, const ASTNode& node) {
         return emit_set_literal(state, *set);
     }
 
+    if (auto* soa = dynamic_cast<const SoaListCreate*>(&node)) {
+        return emit_soa_list_create(*soa);
+    }
+
     if (auto* lambda = dynamic_cast<const LambdaExpr*>(&node)) {
         return emit_lambda_expr(state, *lambda);
     }
@@ -155,6 +176,17 @@ string emit(CodeGenState& state, const ASTNode& node) {
     }
 
     if (auto* decl = dynamic_cast<const VariableDecl*>(&node)) {
+        // Const initializers evaluated at transpile time become static data
+        string const_decl = emit_const_decl(state, *decl, false);
+
+        if (!const_decl.empty()) {
+            return const_decl;
+        }
+
+        if (state.arena_locals.count(decl)) {
+            return emit_arena_decl(state, *decl);
+        }
+
         // Special handling for OrExpr - needs to generate multiple statements
         if (auto* or_expr = dynamic_cast<const OrExpr*>(decl->value.get())) {
             auto result = emit_or_for_decl(state, *or_expr, decl->name);
@@ -178,6 +210,20 @@ string emit(CodeGenState& state, const ASTNode& node) {
             return out;
         }
 
+        // Tuple locals that may be reassigned need the arity-independent type
+        bool tuple_local = decl->type.empty() && decl->resolved_type.rfind("Tuple<", 0) == 0;
+
+        if (tuple_local && !state.fixed_tuples.count(decl)) {
+            return variable_decl(decl->resolved_type, decl->name, emit(state, *decl->value), decl->is_optional, decl->is_const);
+        }
+
+        // A SoaList element is a proxy of references; name the struct so the local is a copy
+        const StructDef* soa_def = decl->type.empty() ? find_struct_def(state, decl->resolved_type) : nullptr;
+
+        if (soa_def && ranges::find(soa_def->attributes, "soa") != soa_def->attributes.end()) {
+            return variable_decl(decl->resolved_type, decl->name, emit(state, *decl->value), decl->is_optional, decl->is_const);
+        }
+
         return variable_decl(decl->type, decl->name, emit(state, *decl->value), decl->is_optional, decl->is_const);
     }
 
@@ -211,12 +257,6 @@ string emit(CodeGenState& state, const ASTNode& node) {
     }
 
     if (auto* lit = dynamic_cast<const StructLiteral*>(&node)) {
-        vector<pair<string, string>> field_values;
-
-        for (const auto& [name, value] : lit->field_values) {
-            field_values.push_back({name, emit(state, *value)});
-        }
-
         // Handle qualified struct name: module.Type -> module::Type
         string struct_name = lit->struct_name;
         size_t dot_pos = struct_name.find('.');
@@ -249,7 +289,7 @@ string emit(CodeGenState& state, const ASTNode& node) {
             }
         }
 
-        return struct_literal(struct_name, field_values);
+        return emit_struct_literal(state, *lit, struct_name);
     }
 
     if (auto* access = dynamic_cast<const FieldAccess*>(&node)) {
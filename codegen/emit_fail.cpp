@@ -13,20 +13,30 @@ using namespace std;
 
 namespace codegen {
 
+/**
+ * Emits a shared error for a fail site with a compile-time message.
+ * The message is wrapped in a lambda so each site gets its own error,
+ * built once: bishop::rt::static_error<ErrorType>([] { return "msg"; })
+ */
+string static_error(const string& message, const string& error_type) {
+    string type_arg = error_type.empty() ? "" : "<" + error_type + ">";
+    return fmt::format("bishop::rt::static_error{}([] {{ return {}; }})", type_arg, message);
+}
+
 /**
  * Generates C++ return statement for a fail expression.
- * For string: return std::make_shared<bishop::rt::Error>("message");
- * For error struct: return std::make_shared<ErrorType>("msg", field1, field2);
+ * For string literal: return bishop::rt::static_error([] { return "message"; });
+ * For bare error type: return bishop::rt::static_error<ErrorType>([] { return "ErrorType"; });
+ * For error struct: return bishop::rt::new_error<ErrorType>("msg", field1, field2);
  */
 string emit_fail(CodeGenState& state, const FailStmt& stmt) {
     if (!stmt.value) {
-        return "return std::make_shared<bishop::rt::Error>(\"error\")";
+        return "return " + static_error("\"error\"");
     }
 
     // Check if it's a string literal
     if (auto* str_lit = dynamic_cast<const StringLiteral*>(stmt.value.get())) {
-        return fmt::format("return std::make_shared<bishop::rt::Error>({})",
-                           string_literal(str_lit->value));
+        return "return " + static_error(string_literal(str_lit->value));
     }
 
     // Check if it's an error struct literal
@@ -34,10 +44,7 @@ string emit_fail(CodeGenState& state, const FailStmt& stmt) {
         // Bare error type: fail ErrorType;
         // Use the error type name as the message and call message-only constructor
         if (struct_lit->field_values.empty()) {
-            return fmt::format(
-                "return std::static_pointer_cast<bishop::rt::Error>(std::make_shared<{}>(\"{}\"))",
-                struct_lit->struct_name,
-                struct_lit->struct_name);
+            return "return " + static_error("\"" + struct_lit->struct_name + "\"", struct_lit->struct_name);
         }
 
         vector<string> args;
@@ -69,11 +76,8 @@ string emit_fail(CodeGenState& state, const FailStmt& stmt) {
             }
         }
 
-        // Cast to base Error type for Result<T> compatibility
-        return fmt::format(
-            "return std::static_pointer_cast<bishop::rt::Error>(std::make_shared<{}>({}))",
-            struct_lit->struct_name,
-            fmt::join(args, ", "));
+        // Built out of line so the allocation stays off the hot path
+        return fmt::format("return bishop::rt::new_error<{}>({})", struct_lit->struct_name, fmt::join(args, ", "));
     }
 
     // For other expressions (variable ref, etc.)
@@ -26,9 +26,10 @@ string for_range_stmt(const string& var, const string& start, const string& end,
 
 /**
  * Emits a foreach loop: for (auto& var : collection)
+ * Collections that yield proxies by value (SoaList) bind with auto&& instead.
  */
-string for_each_stmt(const string& var, const string& collection, const vector<string>& body) {
-    string out = fmt::format("for (auto& {} : {}) {{\n", var, collection);
+string for_each_stmt(const string& var, const string& collection, const vector<string>& body, bool proxy) {
+    string out = fmt::format("for ({} {} : {}) {{\n", proxy ? "auto&&" : "auto&", var, collection);
 
     for (const auto& stmt : body) {
         out += "\t" + stmt + "\n";
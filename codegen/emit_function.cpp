@@ -9,11 +9,63 @@
 #include "codegen.hpp"
 #include <fmt/format.h>
 #include <fmt/ranges.h>
+#include <algorithm>
 
 using namespace std;
 
 namespace codegen {
 
+/**
+ * Returns true if a function-typed parameter may outlive the call: it is
+ * used as a value (returned, stored, passed on), reassigned, or mentioned
+ * inside a lambda or goroutine. Calling it directly does not count.
+ */
+static bool fn_param_escapes(const vector<unique_ptr<ASTNode>>& body, const string& name) {
+    auto mentions = [&](const ASTNode& node) {
+        if (auto* ref = dynamic_cast<const VariableRef*>(&node)) {
+            return ref->name == name;
+        }
+
+        if (auto* call = dynamic_cast<const FunctionCall*>(&node)) {
+            return call->name == name;
+        }
+
+        return false;
+    };
+
+    return any_node(body, [&](const ASTNode& node) {
+        if (auto* ref = dynamic_cast<const VariableRef*>(&node)) {
+            return ref->name == name;
+        }
+
+        if (auto* assign = dynamic_cast<const Assignment*>(&node)) {
+            return assign->name == name;
+        }
+
+        if (dynamic_cast<const LambdaExpr*>(&node) || dynamic_cast<const GoSpawn*>(&node)) {
+            return any_node(node, mentions);
+        }
+
+        return false;
+    });
+}
+
+/**
+ * Emits "type name" for a parameter. Function-typed parameters that never
+ * escape are passed as bishop::rt::FunctionRef, so callers hand over lambdas
+ * without boxing them into a std::function.
+ */
+static string param_decl(const string& type, const string& name, const vector<unique_ptr<ASTNode>>& body) {
+    string cpp_type = map_type(type);
+    const string boxed = "std::function<";
+
+    if (cpp_type.rfind(boxed, 0) == 0 && !fn_param_escapes(body, name)) {
+        cpp_type = "bishop::rt::FunctionRef<" + cpp_type.substr(boxed.size());
+    }
+
+    return fmt::format("{} {}", cpp_type, name);
+}
+
 /**
  * Emits a complete function definition with parameters, return type, and body.
  */
@@ -89,6 +141,83 @@ static string get_cpp_return_type(const string& return_type, const string& error
     return "bishop::rt::Result<" + map_type(return_type) + ">";
 }
 
+/**
+ * Emits the bishop::rt::RuntimeConfig argument for run() from the project's
+ * [runtime] settings, naming only the ones that were set. Returns an empty
+ * string when everything is left at the runtime defaults.
+ */
+static string runtime_config(const RuntimeOptions& opts) {
+    vector<string> fields;
+
+    if (opts.workers) {
+        fields.push_back(fmt::format(".workers = {}", *opts.workers));
+    }
+
+    if (opts.sharded) {
+        fields.push_back(".sharded = true");
+    }
+
+    if (opts.stack_size) {
+        fields.push_back(fmt::format(".stack_size = {}", *opts.stack_size));
+    }
+
+    if (opts.stack_guard) {
+        fields.push_back(fmt::format(".stack_guard = {}", *opts.stack_guard));
+    }
+
+    if (opts.deep_stack_size) {
+        fields.push_back(fmt::format(".deep_stack_size = {}", *opts.deep_stack_size));
+    }
+
+    if (opts.io_uring) {
+        fields.push_back(".io_uring = true");
+    }
+
+    if (opts.metrics) {
+        fields.push_back(".metrics = true");
+    }
+
+    if (opts.blocking_threads) {
+        fields.push_back(fmt::format(".blocking_threads = {}", *opts.blocking_threads));
+    }
+
+    if (opts.stall_ms) {
+        fields.push_back(fmt::format(".stall_ms = {}", *opts.stall_ms));
+    }
+
+    if (fields.empty()) {
+        return "";
+    }
+
+    return fmt::format(", {{{}}}", fmt::join(fields, ", "));
+}
+
+/**
+ * Maps @hot, @cold, @inline and @noinline to GNU attributes, emitted in
+ * front of both the declaration and the definition. Always-inline
+ * functions are also declared inline so GCC can inline them everywhere.
+ */
+static string function_attribute_prefix(const FunctionDef& fn) {
+    vector<string> attrs;
+    bool force_inline = false;
+
+    for (const auto& attr : fn.attributes) {
+        if (attr == "hot" || attr == "cold" || attr == "noinline") {
+            attrs.push_back("gnu::" + attr);
+        } else if (attr == "inline") {
+            attrs.push_back("gnu::always_inline");
+            force_inline = true;
+        }
+    }
+
+    if (attrs.empty()) {
+        return "";
+    }
+
+    string out = fmt::format("[[{}]] ", fmt::join(attrs, ", "));
+    return force_inline ? out + "inline " : out;
+}
+
 /**
  * Generates a forward declaration for a function.
  * Used to allow functions to call other functions defined later in the file.
@@ -104,10 +233,11 @@ string generate_function_declaration(CodeGenState& state, const FunctionDef& fn)
     vector<string> param_strs;
 
     for (const auto& p : fn.params) {
-        param_strs.push_back(fmt::format("{} {}", map_type(p.type), p.name));
+        param_strs.push_back(param_decl(p.type, p.name, fn.body));
     }
 
-    return fmt::format("{} {}({});\n", cpp_rt, fn.name, fmt::join(param_strs, ", "));
+    return fmt::format("{}{}{} {}({});\n", template_header(fn.type_params), function_attribute_prefix(fn),
+                       cpp_rt, fn.name, fmt::join(param_strs, ", "));
 }
 
 /**
@@ -122,16 +252,36 @@ string generate_function(CodeGenState& state, const FunctionDef& fn) {
     // Track fallibility and main status for or-fail handling
     bool prev_fallible = state.in_fallible_function;
     bool prev_in_main = state.in_main;
+    string prev_file = state.source_file;
     state.in_fallible_function = is_fallible;
     state.in_main = is_main;
 
+    if (!fn.source_file.empty()) {
+        state.source_file = fn.source_file;
+    }
+
     vector<FunctionParam> params;
 
+    // Function-local constants go out of scope with the body; params shadow
+    auto saved_consts = state.const_values;
+
     for (const auto& p : fn.params) {
         params.push_back({p.type, p.name});
+        state.const_values.erase(p.name);
     }
 
     vector<string> body;
+    bool opt_in = ranges::find(fn.attributes, "arena") != fn.attributes.end();
+
+    // Non-escaping local lists and maps share one arena freed on return
+    if (collect_arena_locals(state, fn.body, opt_in)) {
+        body.push_back(arena_binding());
+    }
+
+    collect_unchecked_indexes(state, fn.body);
+    collect_const_tables(state, fn.body);
+    collect_last_uses(state, fn.body, fn.params);
+    collect_fixed_tuples(state, fn.body);
 
     for (const auto& stmt : fn.body) {
         body.push_back(generate_statement(state, *stmt));
@@ -152,6 +302,8 @@ string generate_function(CodeGenState& state, const FunctionDef& fn) {
 
     state.in_fallible_function = prev_fallible;
     state.in_main = prev_in_main;
+    state.source_file = move(prev_file);
+    state.const_values = move(saved_consts);
 
     string out;
 
@@ -163,7 +315,9 @@ string generate_function(CodeGenState& state, const FunctionDef& fn) {
         // Generate int main() using runtime wrapper
         out += "\nint main(int argc, char* argv[]) {\n";
         out += "\tprocess::init_args(argc, argv);\n";
-        out += "\tbishop::rt::run(_bishop_main);\n";
+
+        out += "\tbishop::rt::run(_bishop_main" + runtime_config(state.runtime) + ");\n";
+
         out += "\treturn 0;\n";
         out += "}\n";
     } else {
@@ -173,10 +327,11 @@ string generate_function(CodeGenState& state, const FunctionDef& fn) {
         vector<string> param_strs;
 
         for (const auto& p : params) {
-            param_strs.push_back(fmt::format("{} {}", map_type(p.type), p.name));
+            param_strs.push_back(param_decl(p.type, p.name, fn.body));
         }
 
-        out = fmt::format("{} {}({}) {{\n", cpp_rt, fn.name, fmt::join(param_strs, ", "));
+        out = fmt::format("{}{}{} {}({}) {{\n", template_header(fn.type_params), function_attribute_prefix(fn),
+                          cpp_rt, fn.name, fmt::join(param_strs, ", "));
 
         for (const auto& stmt : body) {
             out += fmt::format("\t{}\n", stmt);
@@ -232,8 +387,13 @@ string static_method_def(const string& name,
 string generate_method(CodeGenState& state, const MethodDef& method) {
     // Set current struct for method body generation (enables self.staticMethod() handling)
     string prev_struct = state.current_struct;
+    string prev_file = state.source_file;
     state.current_struct = method.struct_name;
 
+    if (!method.source_file.empty()) {
+        state.source_file = method.source_file;
+    }
+
     if (method.is_static) {
         // Static method: all params are actual params (no self)
         bool is_fallible = !method.error_type.empty();
@@ -254,6 +414,7 @@ string generate_method(CodeGenState& state, const MethodDef& method) {
 
         state.in_fallible_function = prev_fallible;
         state.current_struct = prev_struct;
+        state.source_file = move(prev_file);
         return static_method_def(method.name, params, method.return_type, body, method.error_type);
     }
 
@@ -276,6 +437,7 @@ string generate_method(CodeGenState& state, const MethodDef& method) {
 
     state.in_fallible_function = prev_fallible;
     state.current_struct = prev_struct;
+    state.source_file = move(prev_file);
     return method_def(method.name, params, method.return_type, body, method.error_type);
 }
 
@@ -300,7 +462,7 @@ string generate_method_declaration(CodeGenState& state, const MethodDef& method)
         vector<string> param_strs;
 
         for (const auto& p : method.params) {
-            param_strs.push_back(fmt::format("{} {}", map_type(p.type), p.name));
+            param_strs.push_back(param_decl(p.type, p.name, method.body));
         }
 
         return fmt::format("\tstatic {} {}({});\n", rt, method.name, fmt::join(param_strs, ", "));
@@ -320,7 +482,7 @@ string generate_method_declaration(CodeGenState& state, const MethodDef& method)
     vector<string> param_strs;
 
     for (size_t i = 1; i < method.params.size(); i++) {
-        param_strs.push_back(fmt::format("{} {}", map_type(method.params[i].type), method.params[i].name));
+        param_strs.push_back(param_decl(method.params[i].type, method.params[i].name, method.body));
     }
 
     return fmt::format("\t{} {}({});\n", rt, method.name, fmt::join(param_strs, ", "));
@@ -356,7 +518,7 @@ string generate_standalone_method(CodeGenState& state, const MethodDef& method)
         vector<string> param_strs;
 
         for (const auto& p : method.params) {
-            param_strs.push_back(fmt::format("{} {}", map_type(p.type), p.name));
+            param_strs.push_back(param_decl(p.type, p.name, method.body));
         }
 
         vector<string> body;
@@ -406,7 +568,7 @@ string generate_standalone_method(CodeGenState& state, const MethodDef& method)
     vector<string> param_strs;
 
     for (size_t i = 1; i < method.params.size(); i++) {
-        param_strs.push_back(fmt::format("{} {}", map_type(method.params[i].type), method.params[i].name));
+        param_strs.push_back(param_decl(method.params[i].type, method.params[i].name, method.body));
     }
 
     vector<string> body;
@@ -426,7 +588,8 @@ string generate_standalone_method(CodeGenState& state, const MethodDef& method)
         }
     }
 
-    string out = fmt::format("{} {}::{}({}) {{\n", rt, struct_name, method.name, fmt::join(param_strs, ", "));
+    string out = fmt::format("{}{} {}{}::{}({}) {{\n", template_header(method.type_params), rt, struct_name,
+                             template_args(method.type_params), method.name, fmt::join(param_strs, ", "));
 
     for (const auto& stmt : body) {
         out += fmt::format("\t{}\n", stmt);
@@ -676,7 +839,7 @@ string generate_test_harness(CodeGenState& state, const unique_ptr<Program>& pro
 
     // Forward declare all structs
     for (const auto& s : program->structs) {
-        out += "struct " + s->name + ";\n";
+        out += template_header(s->type_params) + "struct " + s->name + ";\n";
     }
 
     if (!program->structs.empty()) {
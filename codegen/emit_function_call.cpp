@@ -19,19 +19,13 @@ string function_call(const string& name, const vector<string>& args) {
 }
 
 /**
- * Emits a function call AST node.
+ * Resolves the C++ name to call for a function call AST node, handling
+ * unqualified static methods, module-qualified calls and using aliases.
  */
-string emit_function_call(CodeGenState& state, const FunctionCall& call) {
-    vector<string> args;
-
-    for (const auto& arg : call.args) {
-        args.push_back(emit(state, *arg));
-    }
-
+string function_call_target(CodeGenState& state, const FunctionCall& call) {
     // Check if this is an unqualified static method call (resolved by typechecker)
     if (!call.resolved_struct.empty()) {
-        string fn_name = escape_reserved_name(call.name);
-        return function_call(call.resolved_struct + "::" + fn_name, args);
+        return call.resolved_struct + "::" + escape_reserved_name(call.name);
     }
 
     // Handle qualified function call: module.func -> module::func
@@ -78,7 +72,20 @@ string emit_function_call(CodeGenState& state, const FunctionCall& call) {
         }
     }
 
-    return function_call(func_name, args);
+    return func_name + template_args(call.type_args);
+}
+
+/**
+ * Emits a function call AST node.
+ */
+string emit_function_call(CodeGenState& state, const FunctionCall& call) {
+    vector<string> args;
+
+    for (const auto& arg : call.args) {
+        args.push_back(emit(state, *arg));
+    }
+
+    return function_call(function_call_target(state, call), args);
 }
 
 } // namespace codegen
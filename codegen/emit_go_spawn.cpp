@@ -5,23 +5,115 @@
 
 #include "codegen.hpp"
 #include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <algorithm>
 
 using namespace std;
 
 namespace codegen {
 
+/**
+ * Emits init-captures that evaluate each call argument at the spawn site,
+ * and the matching moved-out argument list for the call inside the task.
+ */
+static void capture_args(CodeGenState& state, const vector<unique_ptr<ASTNode>>& args,
+                         vector<string>& captures, vector<string>& call_args) {
+    for (size_t i = 0; i < args.size(); i++) {
+        string name = fmt::format("_go_arg{}", i);
+        captures.push_back(fmt::format("{} = bishop::rt::go_capture({})", name, emit(state, *args[i])));
+        call_args.push_back(fmt::format("std::move({})", name));
+    }
+}
+
+/**
+ * Returns true if the call targets a @deep_stack function defined in this
+ * program or an imported module.
+ */
+static bool calls_deep_stack_function(const CodeGenState& state, const FunctionCall& call) {
+    const Program* program = state.current_program;
+    string name = call.name;
+    size_t dot = name.find('.');
+
+    if (dot != string::npos) {
+        auto it = state.imported_modules.find(name.substr(0, dot));
+        program = it != state.imported_modules.end() ? it->second->ast.get() : nullptr;
+        name = name.substr(dot + 1);
+    }
+
+    if (!program) {
+        return false;
+    }
+
+    for (const auto& fn : program->functions) {
+        if (fn->name == name) {
+            return ranges::find(fn->attributes, "deep_stack") != fn->attributes.end();
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Returns the trailing spawn() arguments: the stack size and the spawn
+ * site, the Bishop file and line that the stall detector reports.
+ */
+static string spawn_options(const CodeGenState& state, const GoSpawn& spawn, const string& stack_size) {
+    string file;
+
+    for (char c : state.source_file) {
+        if (c == '"' || c == '\\') {
+            file += '\\';
+        }
+
+        file += c;
+    }
+
+    return fmt::format(", {}, \"{}:{}\"", stack_size, file, spawn.line);
+}
+
 /**
  * Emits a goroutine spawn using bishop::rt::spawn().
  *
- * Note: Uses [&] capture. The caller must ensure captured variables
- * outlive the goroutine. Proper fix requires shared_ptr for channels.
+ * Call arguments are evaluated eagerly and moved into the task, so loop
+ * variables passed to `go f(i)` are copied rather than referenced after
+ * they change. Non-copyable arguments (channels) are still passed by
+ * reference, and lambda bodies capture their surroundings by reference.
+ * Calls to @deep_stack functions get the runtime's deep stack size.
  */
 string emit_go_spawn(CodeGenState& state, const GoSpawn& spawn) {
-    string call_code = emit(state, *spawn.call);
+    vector<string> captures = {"&"};
+    vector<string> call_args;
+    string callee;
+    string stack_size = "0";
+
+    if (auto* call = dynamic_cast<const FunctionCall*>(spawn.call.get())) {
+        capture_args(state, call->args, captures, call_args);
+        callee = function_call_target(state, *call);
+
+        if (calls_deep_stack_function(state, *call)) {
+            stack_size = "bishop::rt::deep_stack_size()";
+        }
+    } else if (auto* lcall = dynamic_cast<const LambdaCall*>(spawn.call.get());
+               lcall && dynamic_cast<const LambdaExpr*>(lcall->callee.get())) {
+        string lambda = emit(state, *lcall->callee);
+
+        // go fn() { ... }(); spawns the lambda itself
+        if (lcall->args.empty()) {
+            return "bishop::rt::spawn(" + lambda + spawn_options(state, spawn, stack_size) + ")";
+        }
+
+        captures.push_back("_go_fn = " + lambda);
+        capture_args(state, lcall->args, captures, call_args);
+        callee = "_go_fn";
+    } else {
+        // Method calls and other expressions keep the by-reference capture
+        return "bishop::rt::spawn([&]() {\n\t\t" + emit(state, *spawn.call) + ";\n\t}" +
+               spawn_options(state, spawn, stack_size) + ")";
+    }
 
-    string out = "bishop::rt::spawn([&]() {\n";
-    out += "\t\t" + call_code + ";\n";
-    out += "\t})";
+    string out = fmt::format("bishop::rt::spawn([{}]() mutable {{\n", fmt::join(captures, ", "));
+    out += fmt::format("\t\t{}({});\n", callee, fmt::join(call_args, ", "));
+    out += "\t}" + spawn_options(state, spawn, stack_size) + ")";
 
     return out;
 }
@@ -11,10 +11,12 @@ using namespace std;
 namespace codegen {
 
 /**
- * Emits an if statement with optional else block.
+ * Emits an if statement with optional else block. A cold branch is marked
+ * [[unlikely]] so the compiler lays it out away from the fall-through path.
  */
-string if_stmt(const string& condition, const vector<string>& then_body, const vector<string>& else_body) {
-    string out = fmt::format("if ({}) {{\n", condition);
+string if_stmt(const string& condition, const vector<string>& then_body, const vector<string>& else_body,
+               bool then_cold, bool else_cold) {
+    string out = fmt::format("if ({}){} {{\n", condition, then_cold ? " [[unlikely]]" : "");
 
     for (const auto& stmt : then_body) {
         out += "\t" + stmt + "\n";
@@ -23,7 +25,7 @@ string if_stmt(const string& condition, const vector<string>& then_body, const v
     out += "}";
 
     if (!else_body.empty()) {
-        out += " else {\n";
+        out += else_cold ? " else [[unlikely]] {\n" : " else {\n";
 
         for (const auto& stmt : else_body) {
             out += "\t" + stmt + "\n";
@@ -27,6 +27,7 @@ string emit_lambda_expr(CodeGenState& state, const LambdaExpr& lambda) {
         first = false;
 
         out += map_type(param.type) + " " + param.name;
+        state.const_values.erase(param.name);
     }
 
     out += ")";
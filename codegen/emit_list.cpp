@@ -59,6 +59,11 @@ string emit_list_method_call(CodeGenState& state, const MethodCall& call, const
     }
 
     if (call.method_name == "get") {
+        // Indexes proven in bounds skip the check unless built with --checked
+        if (state.unchecked_indexes.count(&call)) {
+            return "bishop::rt::index_in_bounds(" + obj_str + ", " + args[0] + ")";
+        }
+
         return obj_str + ".at(" + args[0] + ")";
     }
 
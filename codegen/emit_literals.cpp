@@ -4,7 +4,9 @@
  */
 
 #include "codegen.hpp"
+#include "common/format_spec.hpp"
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 
 using namespace std;
 
@@ -43,6 +45,63 @@ string string_literal(const string& value) {
     return fmt::format("std::string(\"{}\")", escape_string(value));
 }
 
+/**
+ * Emits a plain C++ string literal, for runtime helpers that take the
+ * characters directly.
+ */
+string c_string_literal(const string& value) {
+    return fmt::format("\"{}\"", escape_string(value));
+}
+
+/**
+ * Emits a C++ char literal for a format spec fill character.
+ */
+static string char_literal(char c) {
+    if (c == '\'' || c == '\\') {
+        return fmt::format("'\\{}'", c);
+    }
+
+    return fmt::format("'{}'", c);
+}
+
+/**
+ * Emits an f-string as a bishop::rt::interpolate() call over its literal
+ * text and values. Values with a spec are wrapped in with_spec(); the
+ * type checker has already validated every spec.
+ */
+string emit_format_string(CodeGenState& state, const FormatString& fstr) {
+    if (fstr.values.empty()) {
+        return string_literal(fstr.literals[0]);
+    }
+
+    vector<string> args;
+
+    for (size_t i = 0; i < fstr.literals.size(); i++) {
+        if (!fstr.literals[i].empty()) {
+            args.push_back(c_string_literal(fstr.literals[i]));
+        }
+
+        if (i >= fstr.values.size()) {
+            continue;
+        }
+
+        string value = emit(state, *fstr.values[i]);
+        bishop::FormatSpec spec;
+
+        if (fstr.specs[i].empty() || !bishop::parse_format_spec(fstr.specs[i], spec)) {
+            args.push_back(value);
+            continue;
+        }
+
+        string align = spec.align ? char_literal(spec.align) : "'\\0'";
+        string type = spec.type ? char_literal(spec.type) : "'\\0'";
+        args.push_back(fmt::format("bishop::rt::with_spec({}, {{{}, {}, {}, {}, {}}})",
+                                   value, char_literal(spec.fill), align, spec.width, spec.precision, type));
+    }
+
+    return fmt::format("bishop::rt::interpolate({})", fmt::join(args, ", "));
+}
+
 /**
  * Emits a C++ integer literal.
  */
@@ -11,16 +11,16 @@ using namespace std;
 namespace codegen {
 
 /**
- * Emits a map creation: Map<K, V>() -> std::unordered_map<K, V>{}.
+ * Emits a map creation: Map<K, V>() -> bishop::FlatMap<K, V>{}.
  */
 string emit_map_create(const MapCreate& map) {
     string cpp_key_type = map_type(map.key_type);
     string cpp_value_type = map_type(map.value_type);
-    return "std::unordered_map<" + cpp_key_type + ", " + cpp_value_type + ">{}";
+    return "bishop::FlatMap<" + cpp_key_type + ", " + cpp_value_type + ">{}";
 }
 
 /**
- * Emits a map literal: {"key": value, ...} -> std::unordered_map{std::make_pair(key, value), ...}.
+ * Emits a map literal: {"key": value, ...} -> bishop::FlatMap{std::make_pair(key, value), ...}.
  *
  * Uses std::make_pair for each entry to help class template argument deduction (CTAD)
  * correctly infer the map types.
@@ -38,11 +38,11 @@ string emit_map_literal(CodeGenState& state, const MapLiteral& map) {
         entries += "std::make_pair(" + key + ", " + value + ")";
     }
 
-    return "std::unordered_map{" + entries + "}";
+    return "bishop::FlatMap{" + entries + "}";
 }
 
 /**
- * Emits a map method call, mapping Bishop methods to std::unordered_map equivalents.
+ * Emits a map method call, mapping Bishop methods to bishop::FlatMap equivalents.
  */
 string emit_map_method_call(CodeGenState& state, const MethodCall& call, const string& obj_str, const vector<string>& args) {
     if (call.method_name == "length") {
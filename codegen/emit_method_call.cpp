@@ -92,7 +92,7 @@ string emit_method_call(CodeGenState& state, const MethodCall& call) {
         return emit_list_method_call(state, call, obj_str, args);
     }
 
-    // Handle Map methods - map to std::unordered_map equivalents
+    // Handle Map methods - map to bishop::FlatMap equivalents
     if (call.object_type.rfind("Map<", 0) == 0) {
         return emit_map_method_call(state, call, obj_str, args);
     }
@@ -118,6 +118,11 @@ string emit_method_call(CodeGenState& state, const MethodCall& call) {
         return emit_tuple_method_call(state, call, obj_str, args);
     }
 
+    // Handle fixed-size array methods
+    if (call.object_type.rfind("[", 0) == 0) {
+        return emit_array_method_call(state, call, obj_str, args);
+    }
+
     // Handle Deque methods
     if (call.object_type.rfind("Deque<", 0) == 0) {
         return emit_deque_method_call(state, call, obj_str, args);
@@ -143,6 +148,11 @@ string emit_method_call(CodeGenState& state, const MethodCall& call) {
         return emit_set_method_call(state, call, obj_str, args);
     }
 
+    // Handle SoaList methods
+    if (call.object_type.rfind("SoaList<", 0) == 0) {
+        return emit_soa_list_method_call(state, call, obj_str, args);
+    }
+
     // Use -> for pointer types (auto-deref like Go)
     if (!call.object_type.empty() && call.object_type.back() == '*') {
         return fmt::format("{}->{}({})", obj_str, call.method_name, fmt::join(args, ", "));
@@ -0,0 +1,341 @@
+/**
+ * @file emit_moves.cpp
+ * @brief Last-use moves of str and List locals for the Bishop code generator.
+ *
+ * Bishop strings and lists are values, so handing one to a variable,
+ * struct field, function argument or container copies it. When that
+ * hand-off is the variable's last use the copy is wasted; this pass finds
+ * such references and codegen emits them as std::move(name), turning the
+ * deep copy into a pointer swap. A reference qualifies when:
+ *   - the variable is a str or List local or by-value parameter, declared
+ *     once in the function, never captured by a lambda or address-of
+ *   - it is the only mention of the variable in the last statement of the
+ *     declaring block that mentions it, outside any loop in that statement
+ *   - it is passed straight into a declaration, assignment, struct field,
+ *     user function or method argument, List.append/insert, Map.set or
+ *     Channel.send, through nodes that emit their operands exactly once
+ */
+
+#include "codegen.hpp"
+#include <map>
+
+using namespace std;
+
+namespace codegen {
+
+/**
+ * Returns true if the node is a reference to the named variable.
+ */
+static bool is_ref_to(const ASTNode* node, const string& name) {
+    auto* ref = dynamic_cast<const VariableRef*>(node);
+    return ref && ref->name == name;
+}
+
+/**
+ * Returns true for value types whose copies are worth eliding.
+ */
+static bool is_movable_type(const string& type) {
+    return type == "str" || (type.rfind("List<", 0) == 0 && type.back() == '>');
+}
+
+/**
+ * Returns true if the call targets a function defined in this program,
+ * which takes its parameters by value and emits each argument once.
+ */
+static bool is_user_function(const CodeGenState& state, const FunctionCall& call) {
+    if (!state.current_program || !call.resolved_struct.empty()) {
+        return false;
+    }
+
+    for (const auto& fn : state.current_program->functions) {
+        if (fn->name == call.name) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Returns true if the method call's object is a struct defined in this program.
+ */
+static bool is_user_method(const CodeGenState& state, const MethodCall& call) {
+    if (!state.current_program) {
+        return false;
+    }
+
+    string type = call.object_type;
+
+    if (!type.empty() && type.back() == '*') {
+        type.pop_back();
+    }
+
+    for (const auto& def : state.current_program->structs) {
+        if (def->name == type) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Returns the argument positions of a method call that store their value.
+ */
+static vector<size_t> consumed_args(const CodeGenState& state, const MethodCall& call) {
+    const string& type = call.object_type;
+    const string& method = call.method_name;
+
+    if (type.rfind("List<", 0) == 0) {
+        if (method == "append") return {0};
+        if (method == "insert") return {1};
+        return {};
+    }
+
+    if (type.rfind("Map<", 0) == 0) {
+        return method == "set" ? vector<size_t>{1} : vector<size_t>{};
+    }
+
+    if (type.rfind("Channel<", 0) == 0) {
+        return method == "send" || method == "send_many" ? vector<size_t>{0} : vector<size_t>{};
+    }
+
+    if (is_user_method(state, call)) {
+        vector<size_t> all(call.args.size());
+
+        for (size_t i = 0; i < all.size(); i++) {
+            all[i] = i;
+        }
+
+        return all;
+    }
+
+    return {};
+}
+
+/**
+ * Finds the reference to name that a statement hands off by value,
+ * walking only through nodes that emit each operand exactly once.
+ * Returns null if the reference sits anywhere else.
+ */
+static const VariableRef* find_handoff(const CodeGenState& state, const ASTNode& node, const string& name) {
+    auto consume = [&](const ASTNode* child) -> const VariableRef* {
+        if (!child) {
+            return nullptr;
+        }
+
+        if (is_ref_to(child, name)) {
+            return static_cast<const VariableRef*>(child);
+        }
+
+        return find_handoff(state, *child, name);
+    };
+
+    auto first_of = [&](const vector<unique_ptr<ASTNode>>& nodes) -> const VariableRef* {
+        for (const auto& child : nodes) {
+            if (auto* ref = consume(child.get())) {
+                return ref;
+            }
+        }
+
+        return nullptr;
+    };
+
+    if (auto* decl = dynamic_cast<const VariableDecl*>(&node)) {
+        return consume(decl->value.get());
+    }
+
+    if (auto* assign = dynamic_cast<const Assignment*>(&node)) {
+        return consume(assign->value.get());
+    }
+
+    if (auto* assign = dynamic_cast<const FieldAssignment*>(&node)) {
+        return consume(assign->value.get());
+    }
+
+    // return name; already moves implicitly
+    if (auto* ret = dynamic_cast<const ReturnStmt*>(&node)) {
+        return ret->value && !is_ref_to(ret->value.get(), name) ? find_handoff(state, *ret->value, name) : nullptr;
+    }
+
+    if (auto* lit = dynamic_cast<const StructLiteral*>(&node)) {
+        for (const auto& [field, value] : lit->field_values) {
+            if (auto* ref = consume(value.get())) {
+                return ref;
+            }
+        }
+
+        return nullptr;
+    }
+
+    if (auto* call = dynamic_cast<const FunctionCall*>(&node)) {
+        return is_user_function(state, *call) ? first_of(call->args) : nullptr;
+    }
+
+    if (auto* call = dynamic_cast<const MethodCall*>(&node)) {
+        for (size_t i : consumed_args(state, *call)) {
+            if (auto* ref = consume(call->args[i].get())) {
+                return ref;
+            }
+        }
+
+        return nullptr;
+    }
+
+    if (auto* spawn = dynamic_cast<const GoSpawn*>(&node)) {
+        return find_handoff(state, *spawn->call, name);
+    }
+
+    if (auto* stmt = dynamic_cast<const IfStmt*>(&node)) {
+        if (auto* ref = first_of(stmt->then_body)) {
+            return ref;
+        }
+
+        return first_of(stmt->else_body);
+    }
+
+    return nullptr;
+}
+
+/**
+ * Counts the references to and assignments of name under node.
+ */
+static int count_mentions(const ASTNode& node, const string& name) {
+    int count = 0;
+
+    any_node(node, [&](const ASTNode& n) {
+        auto* assign = dynamic_cast<const Assignment*>(&n);
+
+        if (is_ref_to(&n, name) || (assign && assign->name == name)) {
+            count++;
+        }
+
+        return false;
+    });
+
+    return count;
+}
+
+/**
+ * Marks the last use of name in a block if it is a by-value hand-off.
+ * The variable is declared just before statement index start.
+ */
+static void mark_last_use(CodeGenState& state, const vector<unique_ptr<ASTNode>>& block, size_t start,
+                          const string& name) {
+    for (size_t i = block.size(); i > start; i--) {
+        const ASTNode& stmt = *block[i - 1];
+        int mentions = count_mentions(stmt, name);
+
+        if (mentions == 0) {
+            continue;
+        }
+
+        if (mentions == 1) {
+            if (auto* ref = find_handoff(state, stmt, name)) {
+                state.moved_refs.insert(ref);
+            }
+        }
+
+        return;
+    }
+}
+
+/**
+ * Counts how many times each name is bound anywhere in the statements:
+ * declarations, loop variables, lambda parameters and case bindings.
+ */
+static void count_bindings(const vector<unique_ptr<ASTNode>>& body, map<string, int>& bindings) {
+    any_node(body, [&](const ASTNode& n) {
+        if (auto* decl = dynamic_cast<const VariableDecl*>(&n)) {
+            bindings[decl->name]++;
+        } else if (auto* loop = dynamic_cast<const ForStmt*>(&n)) {
+            bindings[loop->loop_var]++;
+        } else if (auto* lambda = dynamic_cast<const LambdaExpr*>(&n)) {
+            for (const auto& p : lambda->params) {
+                bindings[p.name]++;
+            }
+        } else if (auto* with = dynamic_cast<const WithStmt*>(&n)) {
+            bindings[with->binding_name]++;
+        } else if (auto* select = dynamic_cast<const SelectCase*>(&n)) {
+            bindings[select->binding_name]++;
+        }
+
+        return false;
+    });
+}
+
+/**
+ * Returns true if name is captured by a lambda or has its address taken.
+ */
+static bool is_aliased(const vector<unique_ptr<ASTNode>>& body, const string& name) {
+    return any_node(body, [&](const ASTNode& n) {
+        if (dynamic_cast<const LambdaExpr*>(&n) || dynamic_cast<const AddressOf*>(&n)) {
+            return any_node(n, [&](const ASTNode& inner) { return is_ref_to(&inner, name); });
+        }
+
+        return false;
+    });
+}
+
+/**
+ * Visits every statement block under the statements, outermost first,
+ * skipping lambda bodies.
+ */
+static void for_each_block(const vector<unique_ptr<ASTNode>>& block,
+                           const function<void(const vector<unique_ptr<ASTNode>>&)>& visit) {
+    visit(block);
+
+    for (const auto& stmt : block) {
+        if (auto* s = dynamic_cast<const IfStmt*>(stmt.get())) {
+            for_each_block(s->then_body, visit);
+            for_each_block(s->else_body, visit);
+        } else if (auto* s = dynamic_cast<const WhileStmt*>(stmt.get())) {
+            for_each_block(s->body, visit);
+        } else if (auto* s = dynamic_cast<const ForStmt*>(stmt.get())) {
+            for_each_block(s->body, visit);
+        } else if (auto* s = dynamic_cast<const WithStmt*>(stmt.get())) {
+            for_each_block(s->body, visit);
+        } else if (auto* s = dynamic_cast<const SelectStmt*>(stmt.get())) {
+            for (const auto& c : s->cases) {
+                for_each_block(c->body, visit);
+            }
+        }
+    }
+}
+
+/**
+ * Finds the last uses of str and List locals and parameters in a function
+ * body that can be moved instead of copied, recording them in
+ * state.moved_refs.
+ */
+void collect_last_uses(CodeGenState& state, const vector<unique_ptr<ASTNode>>& body,
+                       const vector<::FunctionParam>& params) {
+    map<string, int> bindings;
+    count_bindings(body, bindings);
+
+    for (const auto& p : params) {
+        bindings[p.name]++;
+    }
+
+    auto movable = [&](const string& name, const string& type) {
+        return is_movable_type(type) && bindings[name] == 1 && !is_aliased(body, name);
+    };
+
+    for (const auto& p : params) {
+        if (movable(p.name, p.type)) {
+            mark_last_use(state, body, 0, p.name);
+        }
+    }
+
+    for_each_block(body, [&](const vector<unique_ptr<ASTNode>>& block) {
+        for (size_t i = 0; i < block.size(); i++) {
+            auto* decl = dynamic_cast<const VariableDecl*>(block[i].get());
+
+            if (decl && !decl->is_const && !decl->is_optional && movable(decl->name, decl->resolved_type)) {
+                mark_last_use(state, block, i + 1, decl->name);
+            }
+        }
+    });
+}
+
+} // namespace codegen
@@ -78,18 +78,15 @@ string emit_or_fail_handler(CodeGenState& state, const OrFail& handler) {
 
     // String literal: wrap in Error
     if (auto* str_lit = dynamic_cast<const StringLiteral*>(handler.error_expr.get())) {
-        return fmt::format("return std::make_shared<bishop::rt::Error>({});",
-                           string_literal(str_lit->value));
+        return "return " + static_error(string_literal(str_lit->value)) + ";";
     }
 
     // Bare error type: fail ErrorType; (StructLiteral with empty field_values)
     // Pass err as the cause to preserve error chain
     if (auto* struct_lit = dynamic_cast<const StructLiteral*>(handler.error_expr.get())) {
         if (struct_lit->field_values.empty()) {
-            return fmt::format(
-                "return std::static_pointer_cast<bishop::rt::Error>(std::make_shared<{}>(\"{}\", err));",
-                struct_lit->struct_name,
-                struct_lit->struct_name);
+            return fmt::format("return bishop::rt::new_error<{}>(\"{}\", err);",
+                               struct_lit->struct_name, struct_lit->struct_name);
         }
     }
 
@@ -166,6 +163,7 @@ string emit_or_match_handler(CodeGenState& state, const OrMatch& handler, const
  * both Result<T> types (.is_error()) and falsy types (!truthy(value)).
  * Uses bishop::or_value() to extract the value, which returns .value()
  * for Result types or the value as-is for falsy types.
+ * The handler only runs on failure, so every handler branch is [[unlikely]].
  */
 OrEmitResult emit_or_for_decl(CodeGenState& state, const OrExpr& expr, const string& var_name) {
     OrEmitResult result;
@@ -185,7 +183,7 @@ OrEmitResult emit_or_for_decl(CodeGenState& state, const OrExpr& expr, const str
 
     if (auto* ret = dynamic_cast<const OrReturn*>(expr.handler.get())) {
         handler_code = emit_or_return_handler(state, *ret);
-        result.check = fmt::format("if ({}) {{ {} }}", condition, handler_code);
+        result.check = fmt::format("if ({}) [[unlikely]] {{ {} }}", condition, handler_code);
         result.value_expr = value_extraction;
     } else if (auto* fail = dynamic_cast<const OrFail*>(expr.handler.get())) {
         // For or fail with Result types, we need to define err before returning it
@@ -206,7 +204,7 @@ OrEmitResult emit_or_for_decl(CodeGenState& state, const OrExpr& expr, const str
             handler_code = emit_or_fail_handler(state, *fail);
         }
 
-        result.check = fmt::format("if ({}) {{ {} }}", condition, handler_code);
+        result.check = fmt::format("if ({}) [[unlikely]] {{ {} }}", condition, handler_code);
         result.value_expr = value_extraction;
     } else if (auto* block = dynamic_cast<const OrBlock*>(expr.handler.get())) {
         // For blocks, bind 'err' using bishop::or_error() which handles both Result and falsy types
@@ -214,24 +212,24 @@ OrEmitResult emit_or_for_decl(CodeGenState& state, const OrExpr& expr, const str
         handler_code = emit_or_block_handler(state, *block);
         // Bind err using or_error() - for Result types this gets .error(),
         // for falsy types it returns a synthetic error (but should never be accessed)
-        result.check = fmt::format("if ({}) {{ auto err = bishop::or_error({}); {} }}",
+        result.check = fmt::format("if ({}) [[unlikely]] {{ auto err = bishop::or_error({}); {} }}",
                                    condition, temp, handler_code);
         result.value_expr = value_extraction;
     } else if (auto* match = dynamic_cast<const OrMatch*>(expr.handler.get())) {
         // Match is only valid for Result types (typechecker already validated this)
         string match_code = emit_or_match_handler(state, *match, var_name);
         result.check = fmt::format(
-            "if ({}.is_error()) {{\n\t\tauto err = {}.error();\n\t\t{}\n\t}} else {{\n\t\t{} = {}.value();\n\t}}",
+            "if ({}.is_error()) [[unlikely]] {{\n\t\tauto err = {}.error();\n\t\t{}\n\t}} else {{\n\t\t{} = {}.value();\n\t}}",
             temp, temp, match_code, var_name, temp);
         result.value_expr = "";  // Empty - variable is assigned in the check
         result.is_match = true;
     } else if (dynamic_cast<const OrContinue*>(expr.handler.get())) {
         handler_code = emit_or_continue_handler();
-        result.check = fmt::format("if ({}) {{ {} }}", condition, handler_code);
+        result.check = fmt::format("if ({}) [[unlikely]] {{ {} }}", condition, handler_code);
         result.value_expr = value_extraction;
     } else if (dynamic_cast<const OrBreak*>(expr.handler.get())) {
         handler_code = emit_or_break_handler();
-        result.check = fmt::format("if ({}) {{ {} }}", condition, handler_code);
+        result.check = fmt::format("if ({}) [[unlikely]] {{ {} }}", condition, handler_code);
         result.value_expr = value_extraction;
     }
 
@@ -12,10 +12,11 @@ using namespace std;
 namespace codegen {
 
 /**
- * Emits std::cout for multiple values.
+ * Emits a buffered runtime print for multiple values.
+ * Output is flushed at exit, on flush(), or per line when stdout is a TTY.
  */
 string print_multi(const vector<string>& args) {
-    return fmt::format("std::cout << {} << std::endl", fmt::join(args, " << "));
+    return fmt::format("bishop::rt::print({})", fmt::join(args, ", "));
 }
 
 } // namespace codegen
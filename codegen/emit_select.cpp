@@ -5,46 +5,86 @@
 
 #include "codegen.hpp"
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 
 using namespace std;
 
 namespace codegen {
 
 /**
- * Generates C++ for a select statement using polling with stackful coroutines.
+ * Generates C++ for a select statement. Each channel case becomes a
+ * RecvOp/SendOp, bishop::rt::select() parks the fiber on all of them and
+ * returns the index of the case that completed (-1 for default/timeout),
+ * and an if/else chain runs that case's body. The bodies sit outside any
+ * runtime loop, so break and continue reach the enclosing loop.
  */
 string generate_select(CodeGenState& state, const SelectStmt& stmt) {
-    string out;
-
-    // Generate a polling loop that checks each channel
-    out += "while (true) {\n";
+    string out = "{\n";
+    vector<string> ops;
+    const SelectCase* fallback = nullptr;
 
     for (const auto& c : stmt.cases) {
+        if (c->operation == "default" || c->operation == "timeout") {
+            fallback = c.get();
+            continue;
+        }
+
+        string op = fmt::format("_sel_op{}", ops.size());
         string channel_code = emit(state, *c->channel);
 
-        if (c->operation == "recv") {
-            out += "\t{\n";
-            out += "\t\tauto _try_result = " + channel_code + ".try_recv();\n";
-            out += "\t\tif (_try_result.first) {\n";
+        if (c->operation == "send") {
+            out += fmt::format("\tauto {} = bishop::rt::send_op({}, {});\n", op, channel_code, emit(state, *c->send_value));
+        } else {
+            out += fmt::format("\tauto {} = bishop::rt::recv_op({});\n", op, channel_code);
+        }
+
+        ops.push_back("&" + op);
+    }
+
+    string op_list = fmt::format("{{{}}}", fmt::join(ops, ", "));
+
+    if (!fallback) {
+        out += fmt::format("\tint _sel = bishop::rt::select({});\n", op_list);
+    } else if (fallback->operation == "default") {
+        out += fmt::format("\tint _sel = bishop::rt::select_ready({});\n", op_list);
+    } else {
+        out += fmt::format("\tint _sel = bishop::rt::select_for({}, {});\n", op_list, emit(state, *fallback->timeout));
+    }
+
+    string chain;
+    size_t index = 0;
 
-            if (!c->binding_name.empty()) {
-                out += "\t\t\tauto " + c->binding_name + " = _try_result.second;\n";
-            }
+    auto emit_body = [&](const SelectCase& c) {
+        for (const auto& s : c.body) {
+            chain += "\t\t" + generate_statement(state, *s) + "\n";
+        }
+    };
 
-            for (const auto& s : c->body) {
-                out += "\t\t\t" + generate_statement(state, *s) + "\n";
-            }
+    for (const auto& c : stmt.cases) {
+        if (c.get() == fallback) {
+            continue;
+        }
 
-            out += "\t\t\tbreak;\n";
-            out += "\t\t}\n";
-            out += "\t}\n";
+        chain += fmt::format("\t{}if (_sel == {}) {{\n", chain.empty() ? "" : "} else ", index);
+
+        if (c->operation == "recv" && !c->binding_name.empty()) {
+            chain += fmt::format("\t\tauto {} = _sel_op{}.take();\n", c->binding_name, index);
         }
+
+        emit_body(*c);
+        index++;
     }
 
-    // Yield to let other fibers run
-    out += "\tboost::this_fiber::yield();\n";
-    out += "}\n";
+    if (fallback) {
+        chain += chain.empty() ? "\t{\n" : "\t} else {\n";
+        emit_body(*fallback);
+    }
 
+    if (!chain.empty()) {
+        out += chain + "\t}\n";
+    }
+
+    out += "}\n";
     return out;
 }
 
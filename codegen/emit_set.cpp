@@ -3,7 +3,7 @@
  * @brief Set code generation for the Bishop code generator.
  *
  * Generates C++ code for Set<T> creation, literals, and method calls.
- * Sets are implemented using std::unordered_set.
+ * Sets are implemented using bishop::FlatSet.
  */
 
 #include "codegen.hpp"
@@ -14,20 +14,20 @@ using namespace std;
 namespace codegen {
 
 /**
- * Emits a set creation expression: Set<int>() -> std::unordered_set<int>{}
+ * Emits a set creation expression: Set<int>() -> bishop::FlatSet<int>{}
  */
 string emit_set_create(const SetCreate& set) {
-    return fmt::format("std::unordered_set<{}>{{}}",
+    return fmt::format("bishop::FlatSet<{}>{{}}",
                        map_type(set.element_type));
 }
 
 /**
- * Emits a set literal expression: {1, 2, 3} -> std::unordered_set<int>{1, 2, 3}
+ * Emits a set literal expression: {1, 2, 3} -> bishop::FlatSet{1, 2, 3}
  */
 string emit_set_literal(CodeGenState& state, const SetLiteral& set) {
     if (set.elements.empty()) {
         // This shouldn't happen due to parser validation, but handle it
-        return "std::unordered_set<void>{}";
+        return "bishop::FlatSet<void>{}";
     }
 
     // Infer element type from first element
@@ -45,7 +45,7 @@ string emit_set_literal(CodeGenState& state, const SetLiteral& set) {
     }
 
     // The type will be deduced from the elements using initializer_list
-    return fmt::format("std::unordered_set{{{}}}", elements_str);
+    return fmt::format("bishop::FlatSet{{{}}}", elements_str);
 }
 
 /**
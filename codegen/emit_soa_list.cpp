@@ -0,0 +1,74 @@
+/**
+ * @file emit_soa_list.cpp
+ * @brief SoaList emission for the Bishop code generator.
+ */
+
+#include "codegen.hpp"
+#include <fmt/format.h>
+
+using namespace std;
+
+namespace codegen {
+
+/**
+ * Emits a SoaList creation: SoaList<T>() -> bishop::SoaList<T>{}.
+ */
+string emit_soa_list_create(const SoaListCreate& soa) {
+    return "bishop::SoaList<" + map_type(soa.element_type) + ">{}";
+}
+
+/**
+ * Emits a SoaList method call, mapping Bishop methods to bishop::SoaList.
+ * Element reads gather a copy of the struct from its columns.
+ */
+string emit_soa_list_method_call(CodeGenState& state, const MethodCall& call, const string& obj_str, const vector<string>& args) {
+    (void)state;
+
+    if (call.method_name == "length") {
+        return obj_str + ".size()";
+    }
+
+    if (call.method_name == "is_empty") {
+        return obj_str + ".empty()";
+    }
+
+    if (call.method_name == "append") {
+        return obj_str + ".push_back(" + args[0] + ")";
+    }
+
+    if (call.method_name == "pop") {
+        return fmt::format(
+            "[](auto& v) {{ auto tmp = v.back(); v.pop_back(); return tmp; }}({})",
+            obj_str
+        );
+    }
+
+    if (call.method_name == "get") {
+        return obj_str + ".at(" + args[0] + ")";
+    }
+
+    if (call.method_name == "set") {
+        return obj_str + ".set(" + args[0] + ", " + args[1] + ")";
+    }
+
+    if (call.method_name == "clear") {
+        return obj_str + ".clear()";
+    }
+
+    if (call.method_name == "first") {
+        return obj_str + ".front()";
+    }
+
+    if (call.method_name == "last") {
+        return obj_str + ".back()";
+    }
+
+    if (call.method_name == "remove") {
+        return obj_str + ".erase(" + args[0] + ")";
+    }
+
+    // Unknown SoaList method - fall back to generic method call
+    return method_call(obj_str, call.method_name, args);
+}
+
+} // namespace codegen
@@ -9,6 +9,7 @@
 #include "codegen.hpp"
 #include <fmt/format.h>
 #include <fmt/ranges.h>
+#include <algorithm>
 
 using namespace std;
 
@@ -16,6 +17,14 @@ namespace codegen {
 
 static int or_stmt_counter = 0;
 
+/**
+ * Returns true if the branch always ends in a fail. Only the branch's own
+ * statements count; a fail nested in an inner if may not run.
+ */
+static bool branch_fails(const vector<unique_ptr<ASTNode>>& body) {
+    return ranges::any_of(body, [](const auto& stmt) { return dynamic_cast<const FailStmt*>(stmt.get()) != nullptr; });
+}
+
 /**
  * Generates C++ code for a statement. Handles print(), assert_eq() (in test mode),
  * if/while statements, method calls, field assignments, and other statements.
@@ -87,6 +96,10 @@ string generate_statement(CodeGenState& state, const ASTNode& node) {
             return "bishop::rt::sleep(" + emit(state, *call->args[0]) + ");";
         }
 
+        if (call->name == "flush" && call->args.empty()) {
+            return "bishop::rt::flush();";
+        }
+
         // Check if this is an extern function call
         auto ext_it = state.extern_functions.find(call->name);
 
@@ -134,7 +147,12 @@ string generate_statement(CodeGenState& state, const ASTNode& node) {
             else_body.push_back(generate_statement(state, *s));
         }
 
-        return if_stmt(emit(state, *stmt->condition), then_body, else_body);
+        // A branch that fails is the cold one, unless both do
+        bool then_fails = branch_fails(stmt->then_body);
+        bool else_fails = branch_fails(stmt->else_body);
+
+        return if_stmt(emit(state, *stmt->condition), then_body, else_body,
+                       then_fails && !else_fails, else_fails && !then_fails);
     }
 
     if (auto* stmt = dynamic_cast<const WhileStmt*>(&node)) {
@@ -149,6 +167,7 @@ string generate_statement(CodeGenState& state, const ASTNode& node) {
 
     if (auto* stmt = dynamic_cast<const ForStmt*>(&node)) {
         vector<string> body;
+        state.const_values.erase(stmt->loop_var);
 
         for (const auto& s : stmt->body) {
             body.push_back(generate_statement(state, *s));
@@ -165,7 +184,8 @@ string generate_statement(CodeGenState& state, const ASTNode& node) {
             return for_each_stmt(
                 stmt->loop_var,
                 emit(state, *stmt->iterable),
-                body
+                body,
+                stmt->iterable_type.rfind("SoaList<", 0) == 0
             );
         }
     }
@@ -219,8 +239,7 @@ string generate_statement(CodeGenState& state, const ASTNode& node) {
             // or fail "message" generates error return
             // Check if it's a string literal
             if (auto* str_lit = dynamic_cast<const StringLiteral*>(fail->error_expr.get())) {
-                handler_code = fmt::format("return std::make_shared<bishop::rt::Error>({});",
-                                           string_literal(str_lit->value));
+                handler_code = "return " + static_error(string_literal(str_lit->value)) + ";";
             } else if (auto* var = dynamic_cast<const VariableRef*>(fail->error_expr.get())) {
                 if (var->name == "err") {
                     // 'or fail err' - need to extract error from Result type
@@ -231,10 +250,8 @@ string generate_statement(CodeGenState& state, const ASTNode& node) {
             } else if (auto* struct_lit = dynamic_cast<const StructLiteral*>(fail->error_expr.get())) {
                 // Bare error type: or fail ErrorType (StructLiteral with empty field_values)
                 if (struct_lit->field_values.empty()) {
-                    handler_code = fmt::format(
-                        "return std::static_pointer_cast<bishop::rt::Error>(std::make_shared<{}>(\"{}\"));",
-                        struct_lit->struct_name,
-                        struct_lit->struct_name);
+                    handler_code = "return " +
+                        static_error("\"" + struct_lit->struct_name + "\"", struct_lit->struct_name) + ";";
                 } else {
                     handler_code = "return " + emit(state, *fail->error_expr) + ";";
                 }
@@ -288,7 +305,8 @@ string generate_statement(CodeGenState& state, const ASTNode& node) {
             handler_code = fmt::format("auto err = {}.error(); {}", temp, match_code);
         }
 
-        return preamble + "\n\tif (" + condition + ") { " + handler_code + " }";
+        // Every handler runs only on failure, so it is the cold path
+        return preamble + "\n\tif (" + condition + ") [[unlikely]] { " + handler_code + " }";
     }
 
     return emit(state, node);
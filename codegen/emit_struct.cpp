@@ -4,9 +4,17 @@
  *
  * Handles emitting C++ code for struct definitions, struct literals,
  * and field access/assignment.
+ *
+ * Bishop never exposes a struct's memory layout (FFI only passes C
+ * scalars), so fields are emitted in the order that minimises padding
+ * rather than declaration order. Struct literals follow the emitted order,
+ * since C++ designated initializers must.
  */
 
 #include "codegen.hpp"
+#include "common/type_utils.hpp"
+#include "stdlib/http.hpp"
+#include <algorithm>
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
@@ -14,6 +22,139 @@ using namespace std;
 
 namespace codegen {
 
+/**
+ * Returns the {size, alignment} of a field type on the 64-bit targets Bishop
+ * builds for. Types whose layout isn't known here (structs, containers)
+ * are treated as 8-byte aligned, which at worst leaves some padding behind.
+ */
+static pair<size_t, size_t> field_layout(const string& type) {
+    if (type == "bool") return {1, 1};
+    if (type == "int" || type == "cint" || type == "f32" || type == "u32") return {4, 4};
+    if (type == "str") return {32, 8};
+
+    if (type.rfind("[", 0) == 0) {
+        auto [count, element_type] = bishop::extract_array_type(type);
+
+        if (!element_type.empty()) {
+            auto [size, align] = field_layout(element_type);
+            return {size * stoul(count), align};
+        }
+    }
+
+    return {8, 8};
+}
+
+/**
+ * Returns the padded size of a struct with fields in the given order.
+ */
+static size_t padded_size(const vector<pair<string, string>>& fields) {
+    size_t size = 0;
+    size_t max_align = 1;
+
+    for (const auto& [field_name, field_type] : fields) {
+        auto [field_size, align] = field_layout(field_type);
+        size = (size + align - 1) / align * align + field_size;
+        max_align = max(max_align, align);
+    }
+
+    return (size + max_align - 1) / max_align * max_align;
+}
+
+/**
+ * Returns the struct's fields in emission order. Sorting by descending
+ * alignment leaves no interior padding; declaration order is kept when
+ * sorting would not make the struct smaller.
+ */
+vector<pair<string, string>> struct_layout(const StructDef& def) {
+    vector<pair<string, string>> fields;
+
+    for (const auto& f : def.fields) {
+        fields.push_back({f.name, f.type});
+    }
+
+    // Field sizes of a generic struct depend on its type arguments
+    if (!def.type_params.empty()) {
+        return fields;
+    }
+
+    vector<pair<string, string>> packed = fields;
+    ranges::stable_sort(packed, [](const auto& a, const auto& b) {
+        return field_layout(a.second).second > field_layout(b.second).second;
+    });
+
+    return padded_size(packed) < padded_size(fields) ? packed : fields;
+}
+
+/**
+ * Finds the definition of a struct emitted by this compilation, either in
+ * the current program or in an imported Bishop module. Returns nullptr for
+ * unknown names and for built-in module structs, which are hand-written C++.
+ */
+const StructDef* find_struct_def(const CodeGenState& state, const string& name) {
+    string module_name;
+    string type_name = name;
+    size_t dot_pos = name.find('.');
+
+    if (dot_pos != string::npos) {
+        module_name = name.substr(0, dot_pos);
+        type_name = name.substr(dot_pos + 1);
+    } else if (const CodeGenUsingAlias* alias = get_using_alias(state, name)) {
+        module_name = alias->module_alias;
+        type_name = alias->member_name;
+    }
+
+    const Program* program = state.current_program;
+
+    if (!module_name.empty()) {
+        auto it = state.imported_modules.find(module_name);
+
+        if (it == state.imported_modules.end() || bishop::stdlib::is_builtin_module(it->second->name)) {
+            return nullptr;
+        }
+
+        program = it->second->ast.get();
+    }
+
+    if (!program) {
+        return nullptr;
+    }
+
+    for (const auto& s : program->structs) {
+        if (s->name == type_name) {
+            return s.get();
+        }
+    }
+
+    return nullptr;
+}
+
+/**
+ * Emits the members a SoaList<T> needs from a @soa struct: soa_fields(),
+ * the member pointers that give one column per field, and soa_ref, a
+ * proxy of references into those columns that converts back to the struct.
+ */
+string soa_members(const string& name, const vector<pair<string, string>>& fields) {
+    vector<string> pointers;
+    vector<string> inits;
+    string refs;
+    string stores;
+
+    for (const auto& [field_name, field_type] : fields) {
+        pointers.push_back("&" + name + "::" + field_name);
+        inits.push_back(fmt::format(".{} = {}", field_name, field_name));
+        refs += fmt::format("\t\t{}& {};\n", map_type_for_decl(field_type), field_name);
+        stores += fmt::format(" {} = v.{};", field_name, field_name);
+    }
+
+    string out = fmt::format("\tstatic constexpr auto soa_fields() {{ return std::make_tuple({}); }}\n", fmt::join(pointers, ", "));
+    out += "\tstruct soa_ref {\n";
+    out += refs;
+    out += fmt::format("\t\toperator {}() const {{ return {} {{ {} }}; }}\n", name, name, fmt::join(inits, ", "));
+    out += fmt::format("\t\tsoa_ref& operator=(const {}& v) {{{} return *this; }}\n", name, stores);
+    out += "\t};\n";
+    return out;
+}
+
 /**
  * Emits a C++ struct definition with fields.
  */
@@ -76,6 +217,75 @@ string struct_literal(const string& name, const vector<pair<string, string>>& fi
     return fmt::format("{} {{ {} }}", name, fmt::join(inits, ", "));
 }
 
+/**
+ * Emits a struct literal with its initializers in the struct's emitted field
+ * order. If that order would run two calls in a different order than the
+ * source, the calls are evaluated into temporaries first.
+ */
+string emit_struct_literal(CodeGenState& state, const StructLiteral& lit, const string& struct_name) {
+    string cpp_name = struct_name + template_args(lit.type_args);
+    vector<pair<string, string>> field_values;
+
+    for (const auto& [name, value] : lit.field_values) {
+        field_values.push_back({name, emit(state, *value)});
+    }
+
+    const StructDef* def = find_struct_def(state, lit.struct_name);
+
+    if (!def) {
+        return struct_literal(cpp_name, field_values);
+    }
+
+    vector<pair<string, string>> layout = struct_layout(*def);
+
+    auto position = [&](const string& field) {
+        return ranges::find_if(layout, [&](const auto& f) { return f.first == field; }) - layout.begin();
+    };
+
+    vector<size_t> calls;
+
+    for (size_t i = 0; i < lit.field_values.size(); i++) {
+        bool has_call = any_node(*lit.field_values[i].second, [](const ASTNode& n) {
+            return dynamic_cast<const FunctionCall*>(&n) || dynamic_cast<const MethodCall*>(&n) ||
+                   dynamic_cast<const LambdaCall*>(&n);
+        });
+
+        if (has_call) {
+            calls.push_back(i);
+        }
+    }
+
+    bool calls_reordered = false;
+
+    for (size_t k = 1; k < calls.size(); k++) {
+        if (position(field_values[calls[k - 1]].first) > position(field_values[calls[k]].first)) {
+            calls_reordered = true;
+        }
+    }
+
+    string preamble;
+
+    if (calls_reordered) {
+        for (size_t i : calls) {
+            string temp = "_init_" + field_values[i].first;
+            preamble += fmt::format("auto {} = {}; ", temp, field_values[i].second);
+            field_values[i].second = "std::move(" + temp + ")";
+        }
+    }
+
+    ranges::stable_sort(field_values, [&](const auto& a, const auto& b) {
+        return position(a.first) < position(b.first);
+    });
+
+    string literal = struct_literal(cpp_name, field_values);
+
+    if (preamble.empty()) {
+        return literal;
+    }
+
+    return fmt::format("[&] {{ {}return {}; }}()", preamble, literal);
+}
+
 /**
  * Emits field access: object.field.
  */
@@ -95,15 +305,15 @@ string field_assignment(const string& object, const string& field, const string&
  * Methods become member functions with 'self' mapped to 'this'.
  */
 string generate_struct(CodeGenState& state, const StructDef& def) {
-    vector<pair<string, string>> fields;
-
-    for (const auto& f : def.fields) {
-        fields.push_back({f.name, f.type});
-    }
+    vector<pair<string, string>> fields = struct_layout(def);
 
     // Find methods for this struct
     vector<string> method_bodies;
 
+    if (ranges::find(def.attributes, "soa") != def.attributes.end()) {
+        method_bodies.push_back(soa_members(def.name, fields));
+    }
+
     if (state.current_program) {
         for (const auto& method : state.current_program->methods) {
             if (method->struct_name == def.name) {
@@ -113,10 +323,10 @@ string generate_struct(CodeGenState& state, const StructDef& def) {
     }
 
     if (method_bodies.empty()) {
-        return struct_def(def.name, fields);
+        return template_header(def.type_params) + struct_def(def.name, fields);
     }
 
-    return struct_def_with_methods(def.name, fields, method_bodies);
+    return template_header(def.type_params) + struct_def_with_methods(def.name, fields, method_bodies);
 }
 
 /**
@@ -124,15 +334,15 @@ string generate_struct(CodeGenState& state, const StructDef& def) {
  * Used for forward-declaration-friendly code generation.
  */
 string generate_struct_fields_only(CodeGenState& state, const StructDef& def) {
-    vector<pair<string, string>> fields;
-
-    for (const auto& f : def.fields) {
-        fields.push_back({f.name, f.type});
-    }
+    vector<pair<string, string>> fields = struct_layout(def);
 
     // Find methods for this struct and generate declarations only
     vector<string> method_decls;
 
+    if (ranges::find(def.attributes, "soa") != def.attributes.end()) {
+        method_decls.push_back(soa_members(def.name, fields));
+    }
+
     if (state.current_program) {
         for (const auto& method : state.current_program->methods) {
             if (method->struct_name == def.name) {
@@ -142,10 +352,10 @@ string generate_struct_fields_only(CodeGenState& state, const StructDef& def) {
     }
 
     if (method_decls.empty()) {
-        return struct_def(def.name, fields);
+        return template_header(def.type_params) + struct_def(def.name, fields);
     }
 
-    return struct_def_with_methods(def.name, fields, method_decls);
+    return template_header(def.type_params) + struct_def_with_methods(def.name, fields, method_decls);
 }
 
 } // namespace codegen
@@ -11,7 +11,8 @@ using namespace std;
 namespace codegen {
 
 /**
- * Emits a tuple creation: Tuple<T>(v1, v2, ...) -> std::vector<T>{v1, v2, ...}.
+ * Emits a tuple creation: Tuple<T>(v1, v2, ...) -> std::array<T, N>{v1, v2, ...}.
+ * The array converts to bishop::Tuple<T> where a declared Tuple<T> is expected.
  */
 string emit_tuple_create(CodeGenState& state, const TupleCreate& tuple) {
     string cpp_type = map_type(tuple.element_type);
@@ -25,11 +26,38 @@ string emit_tuple_create(CodeGenState& state, const TupleCreate& tuple) {
         elements += emit(state, *tuple.elements[i]);
     }
 
-    return "std::vector<" + cpp_type + ">{" + elements + "}";
+    return fmt::format("std::array<{}, {}>{{{}}}", cpp_type, tuple.elements.size(), elements);
 }
 
 /**
- * Emits a tuple method call, mapping Bishop methods to std::vector equivalents.
+ * Records inferred Tuple locals that are never reassigned in the body.
+ * Those keep the exact std::array<T, N> of their initializer; any other
+ * Tuple local is declared as bishop::Tuple<T> so it can take a tuple of
+ * a different arity later.
+ */
+void collect_fixed_tuples(CodeGenState& state, const vector<unique_ptr<ASTNode>>& body) {
+    any_node(body, [&](const ASTNode& n) {
+        auto* decl = dynamic_cast<const VariableDecl*>(&n);
+
+        if (!decl || !decl->type.empty() || decl->is_optional || decl->resolved_type.rfind("Tuple<", 0) != 0) {
+            return false;
+        }
+
+        bool reassigned = any_node(body, [&](const ASTNode& other) {
+            auto* assign = dynamic_cast<const Assignment*>(&other);
+            return assign && assign->name == decl->name;
+        });
+
+        if (!reassigned) {
+            state.fixed_tuples.insert(decl);
+        }
+
+        return false;
+    });
+}
+
+/**
+ * Emits a tuple method call, mapping Bishop methods to std::array equivalents.
  *
  * Note: When get() is used with the `default` expression pattern, bounds
  * checking is handled by emit_default_expr in emit_or.cpp. When used
@@ -62,7 +62,7 @@ string map_type(const string& t) {
         return "std::vector<" + map_type(element_type) + ">";
     }
 
-    // Handle Map<K, V> types: Map<str, int> -> std::unordered_map<std::string, int>
+    // Handle Map<K, V> types: Map<str, int> -> bishop::FlatMap<std::string, int>
     if (t.rfind("Map<", 0) == 0 && t.back() == '>') {
         // Extract key and value types by finding the comma at depth 1
         size_t start = 4;  // After "Map<"
@@ -81,7 +81,7 @@ string map_type(const string& t) {
         assert(comma_pos != string::npos && "malformed Map type passed typechecker");
         string key_type = t.substr(start, comma_pos - start);
         string value_type = t.substr(comma_pos + 2, t.size() - comma_pos - 3);  // Skip ", " and ">"
-        return "std::unordered_map<" + map_type(key_type) + ", " + map_type(value_type) + ">";
+        return "bishop::FlatMap<" + map_type(key_type) + ", " + map_type(value_type) + ">";
     }
 
     // Handle MapItem<K, V> types for iteration
@@ -115,12 +115,20 @@ string map_type(const string& t) {
         return "std::pair<" + cpp_type + ", " + cpp_type + ">";
     }
 
-    // Handle Tuple<T> types: Tuple<int> -> std::vector<int>
-    // We use vector for homogeneous tuples since all elements are the same type
+    // Handle Tuple<T> types: Tuple<int> -> bishop::Tuple<int>
+    // The arity is not part of the type, so declared tuples use inline storage
+    // for the maximum five elements; creation sites emit std::array<T, N>
     if (t.rfind("Tuple<", 0) == 0 && t.back() == '>') {
         string element_type = extract_element_type(t, "Tuple<");
         assert(!element_type.empty() && "malformed Tuple type passed typechecker");
-        return "std::vector<" + map_type(element_type) + ">";
+        return "bishop::Tuple<" + map_type(element_type) + ">";
+    }
+
+    // Handle fixed-size array types: [3]int -> std::array<int, 3>
+    if (t.rfind("[", 0) == 0) {
+        auto [size, element_type] = bishop::extract_array_type(t);
+        assert(!element_type.empty() && "malformed array type passed typechecker");
+        return "std::array<" + map_type(element_type) + ", " + size + ">";
     }
 
     // Handle Deque<T> types: Deque<int> -> std::deque<int>
@@ -152,11 +160,18 @@ string map_type(const string& t) {
         return "bishop::PriorityQueueBase<" + map_type(element_type) + ">";
     }
 
-    // Handle Set<T> types: Set<int> -> std::unordered_set<int>
+    // Handle Set<T> types: Set<int> -> bishop::FlatSet<int>
     if (t.rfind("Set<", 0) == 0 && t.back() == '>') {
         string element_type = extract_element_type(t, "Set<");
         assert(!element_type.empty() && "malformed Set type passed typechecker");
-        return "std::unordered_set<" + map_type(element_type) + ">";
+        return "bishop::FlatSet<" + map_type(element_type) + ">";
+    }
+
+    // Handle SoaList<T> types: SoaList<Particle> -> bishop::SoaList<Particle>
+    if (t.rfind("SoaList<", 0) == 0 && t.back() == '>') {
+        string element_type = extract_element_type(t, "SoaList<");
+        assert(!element_type.empty() && "malformed SoaList type passed typechecker");
+        return "bishop::SoaList<" + map_type(element_type) + ">";
     }
 
     // Handle function types: fn(int, str) -> bool -> std::function<bool(int, std::string)>
@@ -220,6 +235,13 @@ string map_type(const string& t) {
         return "std::function<" + ret_type + "(" + cpp_params + ")>";
     }
 
+    // Instance of a generic struct: Box<str> -> Box<std::string>
+    auto [generic_name, type_args] = bishop::split_generic_type(t);
+
+    if (!type_args.empty()) {
+        return map_type(generic_name) + template_args(type_args);
+    }
+
     // Handle qualified types: module.Type -> module::Type
     size_t dot_pos = t.find('.');
 
@@ -256,4 +278,40 @@ string map_type_for_decl(const string& t) {
     return mapped;
 }
 
+/**
+ * Emits the template header for a generic function or struct:
+ * {T, U} -> "template<typename T, typename U> ". Empty when not generic.
+ */
+string template_header(const vector<string>& type_params) {
+    if (type_params.empty()) {
+        return "";
+    }
+
+    string out = "template<";
+
+    for (size_t i = 0; i < type_params.size(); i++) {
+        out += (i == 0 ? "typename " : ", typename ") + type_params[i];
+    }
+
+    return out + "> ";
+}
+
+/**
+ * Emits explicit template arguments for a generic instance:
+ * {int, str} -> "<int, std::string>". Empty when there are none.
+ */
+string template_args(const vector<string>& type_args) {
+    if (type_args.empty()) {
+        return "";
+    }
+
+    string out = "<";
+
+    for (size_t i = 0; i < type_args.size(); i++) {
+        out += (i == 0 ? "" : ", ") + map_type_for_decl(type_args[i]);
+    }
+
+    return out + ">";
+}
+
 } // namespace codegen
@@ -46,11 +46,18 @@ string assignment(const string& name, const string& value) {
 
 /**
  * Generates a module-level constant declaration.
- * Emits: static const type name = value;
+ * Constant initializers are folded to static constexpr data; otherwise
+ * emits: static const type name = value;
  * Uses map_type_for_decl to strip reference suffixes from Channel types.
  * Escapes C++ reserved keywords in constant names.
  */
 string generate_module_constant(CodeGenState& state, const VariableDecl& decl) {
+    string folded = emit_const_decl(state, decl, true);
+
+    if (!folded.empty()) {
+        return folded + "\n";
+    }
+
     string val_str = emit(state, *decl.value);
     string t = decl.type.empty() ? "auto" : map_type_for_decl(decl.type);
     string escaped_name = escape_reserved_name(decl.name);
@@ -0,0 +1,80 @@
+/**
+ * @file format_spec.hpp
+ * @brief f-string format spec parsing shared between typechecker and codegen.
+ *
+ * A spec follows the value in an f-string placeholder, `{x:>8.2f}`, and
+ * uses a subset of the Python/fmt mini-language:
+ *
+ *   [[fill]align][width][.precision][type]
+ *
+ * The typechecker rejects specs that don't parse or don't suit the value's
+ * type; codegen lowers the parsed fields to a bishop::rt::FormatSpec.
+ */
+
+#pragma once
+#include <string>
+
+namespace bishop {
+
+struct FormatSpec {
+    char fill = ' ';
+    char align = '\0';   ///< '<', '>', '^', or '\0' for the type's default
+    int width = 0;
+    int precision = -1;  ///< -1 when no precision is given
+    char type = '\0';    ///< Presentation type, or '\0' when none is given
+};
+
+/** Largest width or precision a spec may ask for. */
+inline constexpr int MAX_FORMAT_SPEC_NUMBER = 100;
+
+/**
+ * Parses a format spec (the text after ':'). Returns false when the spec
+ * is malformed or a width or precision exceeds MAX_FORMAT_SPEC_NUMBER.
+ */
+inline bool parse_format_spec(const std::string& spec, FormatSpec& out) {
+    auto is_align = [](char c) { return c == '<' || c == '>' || c == '^'; };
+    auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+    size_t pos = 0;
+
+    if (spec.size() >= 2 && is_align(spec[1])) {
+        out.fill = spec[0];
+        out.align = spec[1];
+        pos = 2;
+    } else if (!spec.empty() && is_align(spec[0])) {
+        out.align = spec[0];
+        pos = 1;
+    }
+
+    auto read_number = [&](int& value) {
+        size_t start = pos;
+        value = 0;
+
+        while (pos < spec.size() && is_digit(spec[pos]) && value <= MAX_FORMAT_SPEC_NUMBER) {
+            value = value * 10 + (spec[pos] - '0');
+            pos++;
+        }
+
+        return pos > start && value <= MAX_FORMAT_SPEC_NUMBER;
+    };
+
+    if (pos < spec.size() && is_digit(spec[pos]) && !read_number(out.width)) {
+        return false;
+    }
+
+    if (pos < spec.size() && spec[pos] == '.') {
+        pos++;
+
+        if (!read_number(out.precision)) {
+            return false;
+        }
+    }
+
+    if (pos < spec.size()) {
+        out.type = spec[pos];
+        pos++;
+    }
+
+    return pos == spec.size();
+}
+
+}  // namespace bishop
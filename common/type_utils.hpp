@@ -8,6 +8,8 @@
 
 #pragma once
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace bishop {
 
@@ -92,4 +94,142 @@ inline std::pair<std::string, std::string> extract_map_types(const std::string&
     return {"", ""};
 }
 
+/**
+ * Splits a fixed-size array type string into its size and element type.
+ *
+ * For example:
+ *   - extract_array_type("[3]int") returns {"3", "int"}
+ *   - extract_array_type("[2]List<str>") returns {"2", "List<str>"}
+ *
+ * @param array_type The full array type string (e.g., "[3]f64")
+ * @return A pair of {size, element_type}, or {"", ""} if not an array type
+ */
+inline std::pair<std::string, std::string> extract_array_type(const std::string& array_type) {
+    if (array_type.size() < 4 || array_type[0] != '[') {
+        return {"", ""};
+    }
+
+    size_t close = array_type.find(']');
+
+    if (close == std::string::npos || close == 1 || close + 1 == array_type.size()) {
+        return {"", ""};
+    }
+
+    std::string size = array_type.substr(1, close - 1);
+
+    if (size.find_first_not_of("0123456789") != std::string::npos) {
+        return {"", ""};
+    }
+
+    return {size, array_type.substr(close + 1)};
+}
+
+/**
+ * Splits a comma-separated list of types at depth zero, so commas inside
+ * nested generic or function types stay with their type. The '>' of a
+ * function type's "->" does not close a bracket.
+ *
+ * For example:
+ *   - split_type_list("int, Map<str, int>") returns {"int", "Map<str, int>"}
+ */
+inline std::vector<std::string> split_type_list(const std::string& list) {
+    std::vector<std::string> types;
+    int depth = 0;
+    size_t start = 0;
+
+    for (size_t i = 0; i <= list.size(); i++) {
+        char c = i < list.size() ? list[i] : ',';
+
+        if (c == '<' || c == '(' || c == '[') {
+            depth++;
+        } else if ((c == '>' && !(i > 0 && list[i - 1] == '-')) || c == ')' || c == ']') {
+            depth--;
+        } else if (c == ',' && depth == 0) {
+            size_t first = list.find_first_not_of(' ', start);
+            size_t last = list.find_last_not_of(' ', i - 1);
+
+            if (first != std::string::npos && first < i) {
+                types.push_back(list.substr(first, last - first + 1));
+            }
+
+            start = i + 1;
+        }
+    }
+
+    return types;
+}
+
+/**
+ * Splits a named generic type into its name and type arguments.
+ *
+ * For example:
+ *   - split_generic_type("Box<int>") returns {"Box", {"int"}}
+ *   - split_generic_type("Map<str, List<int>>") returns {"Map", {"str", "List<int>"}}
+ *   - split_generic_type("Person") returns {"Person", {}}
+ */
+inline std::pair<std::string, std::vector<std::string>> split_generic_type(const std::string& type) {
+    size_t open = type.find('<');
+
+    if (open == std::string::npos || open == 0 || type.back() != '>' ||
+        type.find_first_of("([ ") < open) {
+        return {type, {}};
+    }
+
+    std::string name = type.substr(0, open);
+    std::string args = extract_element_type(type, name + "<");
+
+    if (args.empty() || open + args.size() + 2 != type.size()) {
+        return {type, {}};
+    }
+
+    return {name, split_type_list(args)};
+}
+
+/**
+ * Replaces each type parameter named in params with the matching entry of
+ * args. Only whole names are replaced, so T does not touch Tree or mod.T.
+ *
+ * For example:
+ *   - substitute_type_params("Map<K, List<V>>", {"K", "V"}, {"str", "int"})
+ *     returns "Map<str, List<int>>"
+ */
+inline std::string substitute_type_params(const std::string& type,
+                                          const std::vector<std::string>& params,
+                                          const std::vector<std::string>& args) {
+    auto is_name_char = [](char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+    };
+
+    std::string out;
+    size_t i = 0;
+
+    while (i < type.size()) {
+        if (!is_name_char(type[i])) {
+            out += type[i++];
+            continue;
+        }
+
+        size_t end = i;
+
+        while (end < type.size() && is_name_char(type[end])) {
+            end++;
+        }
+
+        std::string name = type.substr(i, end - i);
+        bool qualified = i > 0 && type[i - 1] == '.';
+
+        for (size_t k = 0; k < params.size() && k < args.size() && !qualified; k++) {
+            if (params[k] == name) {
+                name = args[k];
+                break;
+            }
+        }
+
+        out += name;
+        i = end;
+    }
+
+    return out;
+}
+
 } // namespace bishop
@@ -390,6 +390,7 @@ module.exports = grammar({
       seq("'", /[^']*/, "'"),
       seq('r"', /[^"]*/, '"'),
       seq("r'", /[^']*/, "'"),
+      seq('f"', /[^"]*/, '"'),
     ),
 
     boolean_literal: _ => choice('true', 'false'),
@@ -289,6 +289,7 @@
     "assert_eq"
     "print"
     "println"
+    "flush"
     "len"
     "sleep"))
 
@@ -42,6 +42,7 @@ static unordered_map<string, TokenType> keywords = {
     {"Queue", TokenType::QUEUE},
     {"PriorityQueue", TokenType::PRIORITY_QUEUE},
     {"Set", TokenType::SET},
+    {"SoaList", TokenType::SOA_LIST},
     {"select", TokenType::SELECT},
     {"case", TokenType::CASE},
     {"extern", TokenType::EXTERN},
@@ -226,10 +227,81 @@ Token Lexer::read_raw_single_quoted() {
     return {TokenType::STRING, value, start_line};
 }
 
+/**
+ * Reads an f-string literal. Assumes current char is '"'.
+ * Text outside braces gets the usual escape processing. Placeholders are
+ * kept verbatim, braces included, for the parser to split out; they may
+ * contain string literals, so a quote inside braces does not end the
+ * f-string. Escaped braces are kept doubled, the same as `{{` and `}}`.
+ */
+Token Lexer::read_format_string() {
+    int start_line = line;
+    advance();  // skip opening quote
+    string value;
+    int depth = 0;
+
+    while (current() != '\0' && (depth > 0 || current() != '"')) {
+        char c = current();
+
+        if (depth > 0 && (c == '"' || c == '\'')) {
+            value += c;
+            advance();
+
+            while (current() != c && current() != '\0') {
+                if (current() == '\\') {
+                    value += current();
+                    advance();
+                }
+
+                value += current();
+                advance();
+            }
+
+            value += current();
+            advance();
+        } else if (depth == 0 && c == '\\') {
+            advance();  // skip backslash
+            char escaped = current();
+
+            switch (escaped) {
+                case 'n': value += '\n'; break;
+                case 't': value += '\t'; break;
+                case 'r': value += '\r'; break;
+                case '{': value += "{{"; break;
+                case '}': value += "}}"; break;
+                default: value += escaped; break;
+            }
+
+            advance();
+        } else if (depth == 0 && c == '{' && peek() == '{') {
+            value += "{{";
+            advance();
+            advance();
+        } else {
+            if (c == '{') {
+                depth++;
+            } else if (c == '}' && depth > 0) {
+                depth--;
+            }
+
+            value += c;
+            advance();
+        }
+    }
+
+    if (current() == '\0') {
+        throw runtime_error("Unterminated f-string literal at line " + to_string(start_line));
+    }
+
+    advance();  // skip closing quote
+    return {TokenType::FSTRING, value, start_line};
+}
+
 /**
  * Reads an identifier or keyword. Identifiers start with a letter or underscore
  * and contain letters, digits, or underscores. Checks against keyword table.
- * Special case: 'r' followed by a quote is a raw string literal.
+ * Special case: 'r' followed by a quote is a raw string literal, and 'f'
+ * followed by a double quote is an f-string.
  */
 Token Lexer::read_identifier() {
     int start_line = line;
@@ -248,6 +320,10 @@ Token Lexer::read_identifier() {
         }
     }
 
+    if (value == "f" && current() == '"') {
+        return read_format_string();
+    }
+
     auto it = keywords.find(value);
     if (it != keywords.end()) {
         return {it->second, value, start_line};
@@ -51,6 +51,7 @@ private:
     Token read_single_quoted();      ///< Reads a single-quoted string literal
     Token read_raw_string();         ///< Reads a raw double-quoted string (r"...")
     Token read_raw_single_quoted();  ///< Reads a raw single-quoted string (r'...')
+    Token read_format_string();      ///< Reads an f-string (f"...")
     Token read_identifier();         ///< Reads identifier or keyword
     Token read_number();      ///< Reads integer or float literal
 };
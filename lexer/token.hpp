@@ -88,6 +88,20 @@
  * @note Use `is none` to check for none, or use a truthy check
  */
 
+/**
+ * @bishop_syntax Fixed-size Arrays
+ * @category Types
+ * @order 10
+ * @description A fixed number of elements of one type, stored inline without a heap allocation. Create one with [N]T(values...) or [N]T() for zero values.
+ * @syntax [N]T
+ * @example
+ * [3]f64 origin = [3]f64();
+ * v := [3]f64(1.0, 2.0, 3.0);
+ * v.set(0, 4.0);
+ * len := v.length();  // 3
+ * @note Arrays have get, set, length, first, last and contains, and work in for-each loops
+ */
+
 // =============================================================================
 // Bishop Syntax Documentation: Operators
 // =============================================================================
@@ -127,6 +141,19 @@
  * @description Join strings with the + operator.
  * @syntax str + str
  * @example msg := "Hello, " + name + "!";
+ * @note A chain of `+` on str builds the result in one allocation.
+ */
+
+/**
+ * @bishop_syntax String Interpolation
+ * @category Operators
+ * @order 4
+ * @description Embed values in a string with an f-string. Each `{expr}` is replaced by the value, formatted as print() would; `{expr:spec}` applies a format spec.
+ * @syntax f"text {expr} text {expr:spec}"
+ * @example
+ * msg := f"{name} is {age} years old";
+ * line := f"{label:<10}|{price:>8.2f}|{flags:0>4x}";
+ * @note Values must be int, u32, u64, cint, f32, f64, bool or str. Specs are `[[fill]align][width][.precision][type]`: align is `<`, `>` or `^`, integer types are d x X o b, float types are f e g, and precision is for floats only. Write `{{` and `}}` for literal braces.
  */
 
 #pragma once
@@ -167,6 +194,7 @@ enum class TokenType {
     QUEUE,
     PRIORITY_QUEUE,
     SET,
+    SOA_LIST,
     SELECT,
     CASE,
     EXTERN,
@@ -201,6 +229,7 @@ enum class TokenType {
     // Literals
     IDENT,
     STRING,
+    FSTRING,      ///< f"..." with placeholders left in place
     NUMBER,
     FLOAT,
 
@@ -74,6 +74,9 @@ pair<fs::path, fs::path> get_runtime_paths() {
     return {install_base / "lib" / "bishop", install_base / "include"};
 }
 
+/// Set by --checked: keep runtime bounds checks the compiler proved unnecessary
+static bool checked_build = false;
+
 /**
  * Builds the g++ compile command (source to object file).
  * Uses ccache for caching compiled objects.
@@ -85,6 +88,11 @@ string build_compile_cmd(const string& obj_output, const string& input) {
     auto [lib_path, include_path] = get_runtime_paths();
     string cmd = "CCACHE_SLOPPINESS=pch_defines,time_macros CCACHE_DEPEND=1 ccache g++ -std=c++23 -pipe -c -MD -o " + obj_output + " " + input;
     cmd += " -I" + include_path.string();
+
+    if (checked_build) {
+        cmd += " -DBISHOP_CHECKED";
+    }
+
     cmd += " 2>&1";
     return cmd;
 }
@@ -241,11 +249,13 @@ unique_ptr<Program> merge_package_files(const fs::path& dir, const string& filen
 
         // Merge functions
         for (auto& f : ast->functions) {
+            f->source_file = file.filename().string();
             merged->functions.push_back(move(f));
         }
 
         // Merge methods
         for (auto& m : ast->methods) {
+            m->source_file = file.filename().string();
             merged->methods.push_back(move(m));
         }
 
@@ -344,6 +354,12 @@ TranspileResult transpile_ast(unique_ptr<Program> ast, const string& filename, b
     // Generate code with imports
     CodeGen codegen;
 
+    codegen.source_file = fs::path(filename).filename().string();
+
+    if (config) {
+        codegen.runtime = config->runtime;
+    }
+
     if (imports.empty()) {
         result.cpp_code = codegen.generate(ast, test_mode);
     } else {
@@ -837,10 +853,29 @@ int build_file(const string& path) {
  *   bishop run <file|dir>   - Build and run
  *   bishop test <path>      - Run tests
  *   bishop init <name>      - Initialize project
+ *
+ * --checked (anywhere before the program arguments) builds with every
+ * list bounds check kept, for debugging.
  */
 int main(int argc, char* argv[]) {
+    // Strip --checked so the commands below see their usual arguments
+    int kept = 1;
+
+    for (int i = 1; i < argc; i++) {
+        bool program_arg = kept > 2 && string(argv[1]) == "run";
+
+        if (!program_arg && string(argv[i]) == "--checked") {
+            checked_build = true;
+            continue;
+        }
+
+        argv[kept++] = argv[i];
+    }
+
+    argc = kept;
+
     if (argc < 2) {
-        cerr << "Usage: bishop <file|dir>" << endl;
+        cerr << "Usage: bishop [--checked] <file|dir>" << endl;
         cerr << "       bishop run <file|dir>" << endl;
         cerr << "       bishop test <path>" << endl;
         cerr << "       bishop init <name>" << endl;
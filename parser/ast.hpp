@@ -4,7 +4,7 @@
  *
  * Defines all AST node types used to represent parsed Bishop programs. The hierarchy:
  * - ASTNode: Base class with line number tracking
- * - Literals: StringLiteral, NumberLiteral, FloatLiteral, BoolLiteral, NoneLiteral
+ * - Literals: StringLiteral, FormatString, NumberLiteral, FloatLiteral, BoolLiteral, NoneLiteral
  * - Expressions: VariableRef, BinaryExpr, IsNone, FunctionCall, MethodCall, FieldAccess, StructLiteral
  * - Statements: VariableDecl, Assignment, FieldAssignment, ReturnStmt, IfStmt, WhileStmt
  * - Definitions: FunctionDef, MethodDef, StructDef
@@ -82,6 +82,13 @@ struct StringLiteral : ASTNode {
     explicit StringLiteral(const string& v) : value(v) {}
 };
 
+/** @brief Interpolated string: f"x = {x}, y = {y:.2f}" */
+struct FormatString : ASTNode {
+    vector<string> literals;             ///< Text around the values; literals[i] precedes values[i]
+    vector<unique_ptr<ASTNode>> values;  ///< Interpolated expressions
+    vector<string> specs;                ///< Format spec after ':' for each value (may be empty)
+};
+
 /** @brief Integer literal: 42 */
 struct NumberLiteral : ASTNode {
     string value;  ///< String representation of the number
@@ -132,6 +139,7 @@ struct BinaryExpr : ASTNode {
     string op;
     unique_ptr<ASTNode> left;
     unique_ptr<ASTNode> right;
+    mutable bool str_concat = false;  ///< True for + on two str values (set by type checker)
 };
 
 /** @brief Check if optional value is none: x is none */
@@ -214,6 +222,13 @@ struct TupleCreate : ASTNode {
     vector<unique_ptr<ASTNode>> elements;   ///< Element expressions (2-5 elements)
 };
 
+/** @brief Fixed-size array creation: [N]T(v1, v2, ...) or [N]T() */
+struct ArrayCreate : ASTNode {
+    string element_type;                    ///< Type of elements
+    size_t size = 0;                        ///< Number of elements, fixed at compile time
+    vector<unique_ptr<ASTNode>> elements;   ///< Element expressions (none for value-initialized)
+};
+
 /** @brief Deque creation: Deque<T>() */
 struct DequeCreate : ASTNode {
     string element_type;  ///< Type of elements the deque holds
@@ -240,6 +255,11 @@ struct SetCreate : ASTNode {
     string element_type;  ///< Type of elements the set holds
 };
 
+/** @brief Struct-of-arrays list creation: SoaList<T>() */
+struct SoaListCreate : ASTNode {
+    string element_type;  ///< @soa struct the list holds, one column per field
+};
+
 /** @brief Set literal: {1, 2, 3} */
 struct SetLiteral : ASTNode {
     vector<unique_ptr<ASTNode>> elements;  ///< Set element expressions
@@ -249,8 +269,9 @@ struct SetLiteral : ASTNode {
 struct SelectCase : ASTNode {
     string binding_name;              ///< Variable to bind result (empty for send)
     unique_ptr<ASTNode> channel;      ///< Channel expression (e.g., ch1)
-    string operation;                 ///< "recv" or "send"
+    string operation;                 ///< "recv", "send", "default" or "timeout"
     unique_ptr<ASTNode> send_value;   ///< Value to send (null for recv)
+    unique_ptr<ASTNode> timeout;      ///< Milliseconds to wait (timeout cases only)
     vector<unique_ptr<ASTNode>> body; ///< Case body statements
 };
 
@@ -264,6 +285,7 @@ struct FunctionCall : ASTNode {
     string name;                        ///< Function name
     vector<unique_ptr<ASTNode>> args;   ///< Arguments to pass
     mutable string resolved_struct;     ///< For unqualified static method calls, the struct name (set by type checker)
+    mutable vector<string> type_args;   ///< Inferred type arguments of a generic function (set by type checker)
 };
 
 /** @brief Method call on an object: obj.method(args) */
@@ -292,6 +314,7 @@ struct VariableDecl : ASTNode {
     unique_ptr<ASTNode> value;     ///< Initial value expression
     bool is_optional = false;      ///< True if declared with ? (e.g., int?)
     bool is_const = false;         ///< True if declared with const keyword
+    mutable string resolved_type;  ///< Declared or inferred type (set by type checker)
 };
 
 /** @brief Assignment to existing variable: x = value */
@@ -406,6 +429,7 @@ struct ForStmt : ASTNode {
     unique_ptr<ASTNode> range_end;       ///< End value (Range only)
     unique_ptr<ASTNode> iterable;        ///< Collection to iterate (Foreach only)
     vector<unique_ptr<ASTNode>> body;    ///< Loop body statements
+    mutable string iterable_type;        ///< Type of the iterable (Foreach only, set by type checker)
 };
 
 //------------------------------------------------------------------------------
@@ -444,12 +468,15 @@ struct LambdaCall : ASTNode {
 /** @brief Function definition: fn name(params) -> ret_type { body } */
 struct FunctionDef : ASTNode {
     string name;                          ///< Function name
+    vector<string> type_params;           ///< Generic type parameters (e.g., T in fn max<T>)
     vector<FunctionParam> params;         ///< Parameter list
     string return_type;                   ///< Return type (empty for void)
     string error_type;                    ///< Error type if fallible ("err" or specific type, empty if not fallible)
     vector<unique_ptr<ASTNode>> body;     ///< Function body statements
     Visibility visibility = Visibility::Public;  ///< Access modifier
     string doc_comment;                   ///< Documentation comment (from ///)
+    vector<string> attributes;            ///< Attributes without the @ (e.g., "arena")
+    string source_file;                   ///< File name, set when files are merged into one Program
 };
 
 /** @brief External function declaration: @extern("lib") fn name(params) -> ret_type; */
@@ -465,6 +492,7 @@ struct ExternFunctionDef : ASTNode {
 /** @brief Method definition: StructName :: method_name(self, params) -> ret_type { body } */
 struct MethodDef : ASTNode {
     string struct_name;                   ///< Struct this method belongs to
+    vector<string> type_params;           ///< Type parameters of a generic struct (e.g., T in Box<T> :: get)
     string name;                          ///< Method name
     vector<FunctionParam> params;         ///< Includes self as first param (empty for static methods)
     string return_type;                   ///< Return type (empty for void)
@@ -473,6 +501,7 @@ struct MethodDef : ASTNode {
     Visibility visibility = Visibility::Public;  ///< Access modifier
     string doc_comment;                   ///< Documentation comment (from ///)
     bool is_static = false;               ///< True if @static decorator was used
+    string source_file;                   ///< File name, set when files are merged into one Program
 };
 
 //------------------------------------------------------------------------------
@@ -489,9 +518,11 @@ struct StructField {
 /** @brief Struct definition: Name :: struct { fields } */
 struct StructDef : ASTNode {
     string name;                  ///< Struct name
+    vector<string> type_params;   ///< Generic type parameters (e.g., T in Box<T> :: struct)
     vector<StructField> fields;   ///< List of fields
     Visibility visibility = Visibility::Public;  ///< Access modifier
     string doc_comment;           ///< Documentation comment (from ///)
+    vector<string> attributes;    ///< Attributes without the @ (e.g., "soa")
 };
 
 /** @brief Error type definition: Name :: err or Name :: err { fields } */
@@ -505,6 +536,7 @@ struct ErrorDef : ASTNode {
 /** @brief Struct literal: TypeName { field: value, ... } */
 struct StructLiteral : ASTNode {
     string struct_name;   ///< Name of struct type
+    mutable vector<string> type_args;  ///< Type arguments of a generic struct, written or inferred (set by type checker)
     vector<pair<string, unique_ptr<ASTNode>>> field_values;  ///< Field initializers
 };
 
@@ -0,0 +1,148 @@
+/**
+ * @file parse_format_string.cpp
+ * @brief f-string parsing for the Bishop parser.
+ *
+ * The lexer hands over an f-string with its placeholders intact. This
+ * splits it into literal text and `{expr}` / `{expr:spec}` placeholders,
+ * and parses each expression with its own lexer and parser state.
+ */
+
+#include "parser.hpp"
+#include "lexer/lexer.hpp"
+
+using namespace std;
+
+namespace parser {
+
+/**
+ * Finds the '}' closing the placeholder that starts after `start`, skipping
+ * nested brackets and string literals. Also records the first top-level
+ * ':' that is not part of '::', which separates the expression from its
+ * format spec. Returns string::npos if the placeholder is unterminated.
+ */
+static size_t find_placeholder_end(const string& text, size_t start, size_t& colon) {
+    int depth = 0;
+    colon = string::npos;
+
+    for (size_t i = start; i < text.size(); i++) {
+        char c = text[i];
+
+        if (c == '"' || c == '\'') {
+            for (i++; i < text.size() && text[i] != c; i++) {
+                if (text[i] == '\\') {
+                    i++;
+                }
+            }
+        } else if (c == '(' || c == '[' || c == '{') {
+            depth++;
+        } else if (c == ')' || c == ']') {
+            depth--;
+        } else if (c == '}') {
+            if (depth == 0) {
+                return i;
+            }
+
+            depth--;
+        } else if (c == ':' && depth == 0 && colon == string::npos) {
+            if (i + 1 < text.size() && text[i + 1] == ':') {
+                i++;
+            } else {
+                colon = i;
+            }
+        }
+    }
+
+    return string::npos;
+}
+
+/**
+ * Parses one placeholder expression. Names known to the enclosing parser
+ * (structs, functions, imports) are copied so the expression parses the
+ * same as it would outside the f-string.
+ */
+static unique_ptr<ASTNode> parse_placeholder(const ParserState& outer, const string& source, int line) {
+    Lexer lexer(source);
+    vector<Token> tokens = lexer.tokenize();
+
+    for (auto& tok : tokens) {
+        tok.line += line - 1;
+    }
+
+    ParserState state(tokens);
+    state.struct_names = outer.struct_names;
+    state.function_names = outer.function_names;
+    state.imported_modules = outer.imported_modules;
+    state.using_aliases = outer.using_aliases;
+    state.has_wildcard_using = outer.has_wildcard_using;
+    state.type_params = outer.type_params;
+
+    auto expr = parse_expression(state);
+
+    if (!check(state, TokenType::EOF_TOKEN)) {
+        throw runtime_error("unexpected '" + current(state).value + "' in f-string placeholder '{" +
+                            source + "}' at line " + to_string(line));
+    }
+
+    return expr;
+}
+
+/**
+ * Parses an f-string: f"text {expr} text {expr:spec}".
+ * `{{` and `}}` stand for literal braces.
+ */
+unique_ptr<FormatString> parse_format_string(ParserState& state) {
+    Token tok = consume(state, TokenType::FSTRING);
+    const string& text = tok.value;
+
+    auto fstr = make_unique<FormatString>();
+    fstr->line = tok.line;
+
+    string literal;
+    size_t i = 0;
+
+    while (i < text.size()) {
+        char c = text[i];
+
+        if ((c == '{' || c == '}') && i + 1 < text.size() && text[i + 1] == c) {
+            literal += c;
+            i += 2;
+            continue;
+        }
+
+        if (c == '}') {
+            throw runtime_error("unmatched '}' in f-string at line " + to_string(tok.line) +
+                                " (use '}}' for a literal brace)");
+        }
+
+        if (c != '{') {
+            literal += c;
+            i++;
+            continue;
+        }
+
+        size_t colon;
+        size_t end = find_placeholder_end(text, i + 1, colon);
+
+        if (end == string::npos) {
+            throw runtime_error("unterminated '{' in f-string at line " + to_string(tok.line));
+        }
+
+        size_t expr_end = colon == string::npos ? end : colon;
+        string expr = text.substr(i + 1, expr_end - i - 1);
+
+        if (expr.find_first_not_of(" \t\n") == string::npos) {
+            throw runtime_error("empty placeholder in f-string at line " + to_string(tok.line));
+        }
+
+        fstr->literals.push_back(literal);
+        fstr->values.push_back(parse_placeholder(state, expr, tok.line));
+        fstr->specs.push_back(colon == string::npos ? "" : text.substr(colon + 1, end - colon - 1));
+        literal.clear();
+        i = end + 1;
+    }
+
+    fstr->literals.push_back(literal);
+    return fstr;
+}
+
+} // namespace parser
@@ -7,6 +7,7 @@
  */
 
 #include "parser.hpp"
+#include <algorithm>
 
 using namespace std;
 
@@ -29,6 +30,145 @@ Visibility parse_visibility(ParserState& state) {
     return Visibility::Public;
 }
 
+/** @brief Attributes accepted before a function definition */
+static const vector<string> function_attributes = {"arena", "hot", "cold", "inline", "noinline", "deep_stack"};
+
+/** @brief Attributes accepted before a struct definition */
+static const vector<string> struct_attributes = {"soa"};
+
+/**
+ * Returns true if the attribute may precede a function definition.
+ */
+bool is_function_attribute(const string& name) {
+    return find(function_attributes.begin(), function_attributes.end(), name) != function_attributes.end();
+}
+
+/**
+ * Returns true if the attribute may precede a struct definition.
+ */
+bool is_struct_attribute(const string& name) {
+    return find(struct_attributes.begin(), struct_attributes.end(), name) != struct_attributes.end();
+}
+
+/**
+ * Rejects function attributes that contradict each other.
+ */
+void check_function_attributes(const vector<string>& attrs, int line) {
+    auto has = [&](const string& name) { return find(attrs.begin(), attrs.end(), name) != attrs.end(); };
+
+    if (has("hot") && has("cold")) {
+        throw runtime_error("function cannot be both @hot and @cold at line " + to_string(line));
+    }
+
+    if (has("inline") && has("noinline")) {
+        throw runtime_error("function cannot be both @inline and @noinline at line " + to_string(line));
+    }
+}
+
+/**
+ * @bishop_syntax Function Attributes
+ * @category Functions
+ * @order 4
+ * @description Annotate a function with compiler hints. @arena allocates the function's local lists and maps from a per-call arena that is freed in one shot on return, including ones declared inside loops. @hot and @cold tell the C++ compiler how often the function runs, so it optimizes hot functions harder and moves cold ones out of the way. @inline forces the function to be inlined at every call; @noinline keeps it out of line. @deep_stack gives goroutines spawned with `go` on the function a large stack for deep recursion.
+ * @syntax @attribute fn name(params) -> return_type { }
+ * @example
+ * @arena
+ * fn total(int n) -> int {
+ *     sum := 0;
+ *     for i in 0..n {
+ *         row := [i, i * 2];
+ *         sum = sum + row.last();
+ *     }
+ *     return sum;
+ * }
+ *
+ * @hot @inline
+ * fn square(int x) -> int {
+ *     return x * x;
+ * }
+ *
+ * @cold
+ * fn report(str msg) {
+ *     print(msg);
+ * }
+ *
+ * @deep_stack
+ * fn walk(int depth) -> int {
+ *     if depth == 0 {
+ *         return 0;
+ *     }
+ *     return walk(depth - 1) + 1;
+ * }
+ * @note Error branches (or handlers and fail) are already treated as unlikely; @cold is for whole functions that rarely run
+ * @note Goroutines get 128K stacks by default and @deep_stack ones 1M; set stack_size, deep_stack_size and stack_guard under [runtime] in bishop.toml to change them
+ */
+vector<string> parse_attributes(ParserState& state) {
+    vector<string> attrs;
+
+    while (check(state, TokenType::AT) && check_ahead(state, 1, TokenType::IDENT)) {
+        advance(state);
+        Token name = consume(state, TokenType::IDENT);
+
+        if (!is_function_attribute(name.value) && !is_struct_attribute(name.value)) {
+            throw runtime_error("unknown attribute '@" + name.value + "' at line " + to_string(name.line));
+        }
+
+        attrs.push_back(name.value);
+    }
+
+    return attrs;
+}
+
+/**
+ * Parses the type parameters of a generic definition: <T> or <K, V>.
+ */
+vector<string> parse_type_params(ParserState& state) {
+    consume(state, TokenType::LT);
+    vector<string> params;
+
+    while (true) {
+        Token name = consume(state, TokenType::IDENT);
+
+        if (find(params.begin(), params.end(), name.value) != params.end()) {
+            throw runtime_error("duplicate type parameter '" + name.value + "' at line " + to_string(name.line));
+        }
+
+        params.push_back(name.value);
+
+        if (!check(state, TokenType::COMMA)) {
+            break;
+        }
+
+        advance(state);
+    }
+
+    consume(state, TokenType::GT);
+    return params;
+}
+
+/**
+ * @bishop_syntax Generic Functions
+ * @category Functions
+ * @order 5
+ * @description Declare type parameters after the function name to write one function for many types. The body is type checked once; each call infers the type arguments from its arguments and compiles to its own specialized copy, as fast as a hand-written version.
+ * @syntax fn name<T, ...>(T param, ...) -> T { }
+ * @example
+ * fn largest<T>(List<T> items) -> T {
+ *     best := items.get(0);
+ *     for item in items {
+ *         if item > best {
+ *             best = item;
+ *         }
+ *     }
+ *     return best;
+ * }
+ *
+ * n := largest([3, 9, 4]);
+ * s := largest(["b", "a"]);
+ * @note Every type parameter must appear in a parameter type so calls can infer it
+ * @note Values of a type parameter can be compared, added, printed and stored, but not used as structs
+ */
+
 /**
  * @bishop_syntax Function Declaration
  * @category Functions
@@ -43,13 +183,22 @@ Visibility parse_visibility(ParserState& state) {
 unique_ptr<FunctionDef> parse_function(ParserState& state, Visibility vis) {
     consume(state, TokenType::FN);
     Token name = consume(state, TokenType::IDENT);
-    consume(state, TokenType::LPAREN);
 
     auto func = make_unique<FunctionDef>();
     func->name = name.value;
     func->line = name.line;
     func->visibility = vis;
 
+    if (check(state, TokenType::LT)) {
+        func->type_params = parse_type_params(state);
+    }
+
+    // Type parameters are in scope for the signature and the body
+    vector<string> outer_type_params = move(state.type_params);
+    state.type_params = func->type_params;
+
+    consume(state, TokenType::LPAREN);
+
     // Parse parameters: fn foo(int a, int b) or fn foo(Person p) or fn foo(fn(int) -> int callback)
     while (!check(state, TokenType::RPAREN) && !check(state, TokenType::EOF_TOKEN)) {
         FunctionParam param;
@@ -101,6 +250,7 @@ unique_ptr<FunctionDef> parse_function(ParserState& state, Visibility vis) {
     }
 
     consume(state, TokenType::RBRACE);
+    state.type_params = move(outer_type_params);
     return func;
 }
 
@@ -139,13 +289,27 @@ unique_ptr<MethodDef> parse_method_def(ParserState& state, const string& struct_
     method->line = method_name.line;
     method->visibility = vis;
 
+    // Methods of a generic struct restate its parameters: Box<T> :: get(self)
+    method->type_params = state.type_params;
+    string self_type = struct_name;
+
+    if (!method->type_params.empty()) {
+        self_type += "<" + method->type_params[0];
+
+        for (size_t i = 1; i < method->type_params.size(); i++) {
+            self_type += ", " + method->type_params[i];
+        }
+
+        self_type += ">";
+    }
+
     // Parse parameters (first should be 'self' for instance methods)
     while (!check(state, TokenType::RPAREN) && !check(state, TokenType::EOF_TOKEN)) {
         FunctionParam param;
 
         // Check for 'self' (special case - type is the struct)
         if (current(state).value == "self") {
-            param.type = struct_name;
+            param.type = self_type;
             param.name = "self";
             advance(state);
         } else {
@@ -78,6 +78,21 @@ void prescan_definitions(ParserState& state) {
             string name = current(state).value;
             advance(state);
 
+            // Generic struct: Name<T> :: struct
+            if (check(state, TokenType::LT) && !check_ahead(state, 1, TokenType::LT)) {
+                size_t scan = state.pos + 1;
+
+                while (scan < state.tokens.size() &&
+                       (state.tokens[scan].type == TokenType::IDENT || state.tokens[scan].type == TokenType::COMMA)) {
+                    scan++;
+                }
+
+                if (scan + 1 < state.tokens.size() && state.tokens[scan].type == TokenType::GT &&
+                    state.tokens[scan + 1].type == TokenType::DOUBLE_COLON) {
+                    state.pos = scan + 1;
+                }
+            }
+
             if (check(state, TokenType::DOUBLE_COLON)) {
                 advance(state);
 
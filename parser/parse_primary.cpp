@@ -357,6 +357,22 @@ unique_ptr<ASTNode> parse_primary(ParserState& state) {
         return set;
     }
 
+    // Handle struct-of-arrays list creation: SoaList<Particle>()
+    if (check(state, TokenType::SOA_LIST)) {
+        int start_line = current(state).line;
+        advance(state);
+        consume(state, TokenType::LT);
+        string element_type = parse_type(state);
+        consume(state, TokenType::GT);
+        consume(state, TokenType::LPAREN);
+        consume(state, TokenType::RPAREN);
+
+        auto soa = make_unique<SoaListCreate>();
+        soa->element_type = element_type;
+        soa->line = start_line;
+        return soa;
+    }
+
     // Handle map literal: {"key": value, ...}
     // Must be checked BEFORE set literal since both start with LBRACE
     // Distinguished from struct literal by having STRING : at start instead of IDENT :
@@ -419,6 +435,41 @@ unique_ptr<ASTNode> parse_primary(ParserState& state) {
         return set;
     }
 
+    // Handle fixed-size array creation: [3]int(1, 2, 3) or [3]int()
+    if (is_array_type_start(state)) {
+        int start_line = current(state).line;
+        advance(state);
+        string size = consume(state, TokenType::NUMBER).value;
+        consume(state, TokenType::RBRACKET);
+
+        auto array = make_unique<ArrayCreate>();
+        array->element_type = parse_type(state);
+        array->line = start_line;
+
+        try {
+            array->size = stoul(size);
+        } catch (const out_of_range&) {
+            throw runtime_error("array size '" + size + "' is too large at line " + to_string(start_line));
+        }
+
+        consume(state, TokenType::LPAREN);
+
+        while (!check(state, TokenType::RPAREN) && !check(state, TokenType::EOF_TOKEN)) {
+            auto elem = parse_expression(state);
+
+            if (elem) {
+                array->elements.push_back(move(elem));
+            }
+
+            if (check(state, TokenType::COMMA)) {
+                advance(state);
+            }
+        }
+
+        consume(state, TokenType::RPAREN);
+        return array;
+    }
+
     // Handle list literal: [expr, expr, ...]
     if (check(state, TokenType::LBRACKET)) {
         int start_line = current(state).line;
@@ -467,6 +518,10 @@ unique_ptr<ASTNode> parse_primary(ParserState& state) {
         return lit;
     }
 
+    if (check(state, TokenType::FSTRING)) {
+        return parse_format_string(state);
+    }
+
     if (check(state, TokenType::TRUE)) {
         int start_line = current(state).line;
         advance(state);
@@ -563,6 +618,14 @@ unique_ptr<ASTNode> parse_primary(ParserState& state) {
             return parse_struct_literal(state, tok.value);
         }
 
+        // Generic struct literal with explicit type arguments: Box<int> { value: 1 }
+        if (check(state, TokenType::LT) && is_struct_type(state, tok.value)) {
+            vector<string> type_args = parse_type_args(state);
+            auto lit = parse_struct_literal(state, tok.value);
+            lit->type_args = move(type_args);
+            return lit;
+        }
+
         // Check if it's a function call
         if (check(state, TokenType::LPAREN)) {
             auto call = make_unique<FunctionCall>();
@@ -9,21 +9,64 @@ using namespace std;
 
 namespace parser {
 
+/**
+ * Parses the statements of a select case body: { statements }
+ */
+static void parse_select_body(ParserState& state, SelectCase& select_case) {
+    consume(state, TokenType::LBRACE);
+
+    while (!check(state, TokenType::RBRACE) && !check(state, TokenType::EOF_TOKEN)) {
+        auto s = parse_statement(state);
+
+        if (s) {
+            select_case.body.push_back(move(s));
+        }
+    }
+
+    consume(state, TokenType::RBRACE);
+}
+
+/**
+ * Parses a select fallback case: default { ... } or timeout(ms) { ... }
+ */
+static unique_ptr<SelectCase> parse_select_fallback(ParserState& state) {
+    auto select_case = make_unique<SelectCase>();
+    select_case->line = current(state).line;
+
+    if (check(state, TokenType::DEFAULT)) {
+        advance(state);
+        select_case->operation = "default";
+    } else {
+        advance(state);  // consume 'timeout'
+        consume(state, TokenType::LPAREN);
+        select_case->operation = "timeout";
+        select_case->timeout = parse_expression(state);
+        consume(state, TokenType::RPAREN);
+    }
+
+    parse_select_body(state, *select_case);
+    return select_case;
+}
+
 /**
  * @bishop_syntax select
  * @category Channels
  * @order 4
- * @description Wait on multiple channel operations.
- * @syntax select { case val := ch.recv() { ... } }
+ * @description Wait on multiple channel operations. The fiber sleeps until one case can proceed; if several can, one is picked in turn so no channel is starved. A `default` case runs when no case is ready right away, and a `timeout(ms)` case runs when none becomes ready within ms milliseconds. A select has at most one of the two.
+ * @syntax select { case val := ch.recv() { ... } case ch.send(value) { ... } timeout(ms) { ... } }
  * @example
  * select {
  *     case val := ch1.recv() {
  *         x := val + 1;
  *     }
- *     case val := ch2.recv() {
- *         x := val + 2;
+ *     case ch2.send(10) {
+ *         sent = true;
+ *     }
+ *     timeout(100) {
+ *         print("nothing ready");
  *     }
  * }
+ * @note Send values are evaluated once, when the select starts. `break` and `continue` in a case body apply to the enclosing loop.
  */
 unique_ptr<SelectStmt> parse_select(ParserState& state) {
     int start_line = current(state).line;
@@ -33,7 +76,16 @@ unique_ptr<SelectStmt> parse_select(ParserState& state) {
     auto stmt = make_unique<SelectStmt>();
     stmt->line = start_line;
 
-    while (check(state, TokenType::CASE)) {
+    while (!check(state, TokenType::RBRACE) && !check(state, TokenType::EOF_TOKEN)) {
+        if (check(state, TokenType::DEFAULT) || (check(state, TokenType::IDENT) && current(state).value == "timeout")) {
+            stmt->cases.push_back(parse_select_fallback(state));
+            continue;
+        }
+
+        if (!check(state, TokenType::CASE)) {
+            throw runtime_error("expected 'case', 'default' or 'timeout' in select at line " + to_string(current(state).line));
+        }
+
         auto select_case = make_unique<SelectCase>();
         select_case->line = current(state).line;
         advance(state);  // consume 'case'
@@ -84,18 +136,7 @@ unique_ptr<SelectStmt> parse_select(ParserState& state) {
             }
         }
 
-        // Parse the case body: { statements }
-        consume(state, TokenType::LBRACE);
-
-        while (!check(state, TokenType::RBRACE) && !check(state, TokenType::EOF_TOKEN)) {
-            auto s = parse_statement(state);
-
-            if (s) {
-                select_case->body.push_back(move(s));
-            }
-        }
-
-        consume(state, TokenType::RBRACE);
+        parse_select_body(state, *select_case);
         stmt->cases.push_back(move(select_case));
     }
 
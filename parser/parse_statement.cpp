@@ -210,6 +210,20 @@ unique_ptr<ASTNode> parse_statement(ParserState& state) {
         return decl;
     }
 
+    // Fixed-size array variable declaration: [3]int v = [3]int(1, 2, 3);
+    if (is_array_type_start(state)) {
+        int start_line = current(state).line;
+
+        auto decl = make_unique<VariableDecl>();
+        decl->type = parse_type(state);
+        decl->line = start_line;
+        decl->name = consume(state, TokenType::IDENT).value;
+        consume(state, TokenType::ASSIGN);
+        decl->value = parse_expression(state);
+        consume(state, TokenType::SEMICOLON);
+        return decl;
+    }
+
     // Channel<T> variable declaration: Channel<int> ch = Channel<int>(); or Channel<List<int>> x = ...;
     if (check(state, TokenType::CHANNEL)) {
         int start_line = current(state).line;
@@ -340,6 +354,24 @@ unique_ptr<ASTNode> parse_statement(ParserState& state) {
         return decl;
     }
 
+    // SoaList<T> variable declaration: SoaList<Particle> ps = SoaList<Particle>();
+    if (check(state, TokenType::SOA_LIST)) {
+        int start_line = current(state).line;
+        advance(state);
+        consume(state, TokenType::LT);
+        string element_type = parse_type(state);
+        consume(state, TokenType::GT);
+
+        auto decl = make_unique<VariableDecl>();
+        decl->type = "SoaList<" + element_type + ">";
+        decl->line = start_line;
+        decl->name = consume(state, TokenType::IDENT).value;
+        consume(state, TokenType::ASSIGN);
+        decl->value = parse_expression(state);
+        consume(state, TokenType::SEMICOLON);
+        return decl;
+    }
+
     // NOT expression statement: !expr or fail "msg"; !valid or continue; etc.
     if (check(state, TokenType::NOT)) {
         auto expr = parse_expression(state);
@@ -354,6 +386,25 @@ unique_ptr<ASTNode> parse_statement(ParserState& state) {
         string ident = ident_tok.value;
         advance(state);
 
+        // Generic struct-typed variable: Box<int> b = ...
+        if (check(state, TokenType::LT) && is_struct_type(state, ident)) {
+            state.pos = saved_pos;
+            auto decl = make_unique<VariableDecl>();
+            decl->type = parse_type(state);
+            decl->line = ident_tok.line;
+
+            if (check(state, TokenType::OPTIONAL)) {
+                decl->is_optional = true;
+                advance(state);
+            }
+
+            decl->name = consume(state, TokenType::IDENT).value;
+            consume(state, TokenType::ASSIGN);
+            decl->value = parse_expression(state);
+            consume(state, TokenType::SEMICOLON);
+            return decl;
+        }
+
         // Expression statement: x or fail "msg"; x >= 3 or fail "msg"; etc.
         // If the next token is 'or' or a comparison/arithmetic operator, parse as expression
         if (check(state, TokenType::OR) ||
@@ -374,7 +425,9 @@ unique_ptr<ASTNode> parse_statement(ParserState& state) {
         }
 
         // struct-typed variable: Person p = ... or Person? p = ...
-        if (is_struct_type(state, ident) && (check(state, TokenType::IDENT) || check(state, TokenType::OPTIONAL))) {
+        // A type parameter declares the same way: T best = ...
+        if ((is_struct_type(state, ident) || is_type_param(state, ident)) &&
+            (check(state, TokenType::IDENT) || check(state, TokenType::OPTIONAL))) {
             auto decl = make_unique<VariableDecl>();
             decl->type = ident;
             decl->line = ident_tok.line;
@@ -602,6 +655,8 @@ unique_ptr<ASTNode> parse_function_call(ParserState& state) {
  * @order 1
  * @description Spawn a goroutine to run a function call concurrently.
  * @syntax go func();
+ * @note Goroutines run on one thread by default; set [runtime] workers in bishop.toml or BISHOP_WORKERS (0 = one per core) to spread them across threads
+ * @note With [runtime] scheduler = "sharded" each core runs its own pinned scheduler and a goroutine stays on the core that spawned it; http servers listen on every core
  * @example
  * go worker(ch);
  * go process_data();
@@ -36,6 +36,38 @@ bool is_struct_type(const ParserState& state, const string& name) {
     return false;
 }
 
+/**
+ * Checks if the given name is a type parameter of the generic function or
+ * struct being parsed.
+ */
+bool is_type_param(const ParserState& state, const string& name) {
+    for (const auto& p : state.type_params) {
+        if (p == name) return true;
+    }
+
+    return false;
+}
+
+/**
+ * @bishop_syntax Struct-of-Arrays Layout
+ * @category Structs
+ * @order 4
+ * @description Mark a struct @soa to store it in a SoaList<T>, which keeps one contiguous column per field instead of one record per element. Loops that touch a few fields read only those columns and can be vectorized.
+ * @syntax @soa Name :: struct { field type, ... }
+ * @example
+ * @soa
+ * Particle :: struct {
+ *     x f64,
+ *     vx f64
+ * }
+ * ps := SoaList<Particle>();
+ * ps.append(Particle { x: 0.0, vx: 1.5 });
+ * for p in ps {
+ *     p.x = p.x + p.vx;
+ * }
+ * @note Loop variables write straight into the columns; copy an element with get(i) to call its methods
+ */
+
 /**
  * @bishop_syntax Struct Definition
  * @category Structs
@@ -70,16 +102,12 @@ unique_ptr<StructDef> parse_struct_def(ParserState& state, const string& name, V
         if (is_type_token(state)) {
             field.type = token_to_type(current(state).type);
             advance(state);
-        } else if (check(state, TokenType::IDENT)) {
+        } else if (is_array_type_start(state)) {
+            field.type = parse_type(state);
+        } else {
             // Custom type (another struct), possibly qualified (e.g., yaml.Value)
-            field.type = current(state).value;
-            advance(state);
-
-            // Check for qualified type: module.Type
-            if (check(state, TokenType::DOT)) {
-                advance(state);  // consume '.'
-                field.type += "." + consume(state, TokenType::IDENT).value;
-            }
+            // or generic (e.g., Box<T>), or a container such as List<T>
+            field.type = parse_type(state);
         }
 
         def->fields.push_back(field);
@@ -93,6 +121,27 @@ unique_ptr<StructDef> parse_struct_def(ParserState& state, const string& name, V
     return def;
 }
 
+/**
+ * @bishop_syntax Generic Structs
+ * @category Structs
+ * @order 5
+ * @description Declare type parameters after the struct name to define one struct for many element types. Methods restate the parameters. Literals take the type arguments explicitly or infer them from the field values.
+ * @syntax Name<T, ...> :: struct { field T, ... }
+ * @example
+ * Bag<T> :: struct {
+ *     items List<T>
+ * }
+ *
+ * Bag<T> :: first(self) -> T {
+ *     return self.items.get(0);
+ * }
+ *
+ * s := Bag<int> { items: [3, 1] };
+ * n := s.first();
+ * names := Bag { items: ["a", "b"] };
+ * @note Methods of a generic struct must be instance methods
+ */
+
 /**
  * @bishop_syntax Struct Instantiation
  * @category Structs
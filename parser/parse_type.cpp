@@ -75,10 +75,46 @@ string token_to_type(TokenType type) {
     }
 }
 
+/**
+ * Checks if the tokens at the current position start a fixed-size array
+ * type: [N] followed by an element type. Distinguishes [3]int from a
+ * one-element list literal like [3].
+ */
+bool is_array_type_start(const ParserState& state) {
+    if (!check(state, TokenType::LBRACKET) || !check_ahead(state, 1, TokenType::NUMBER) ||
+        !check_ahead(state, 2, TokenType::RBRACKET)) {
+        return false;
+    }
+
+    static const TokenType element_starts[] = {
+        TokenType::TYPE_INT, TokenType::TYPE_STR, TokenType::TYPE_BOOL,
+        TokenType::TYPE_F32, TokenType::TYPE_F64, TokenType::TYPE_U32, TokenType::TYPE_U64,
+        TokenType::IDENT, TokenType::LBRACKET, TokenType::LIST, TokenType::MAP,
+        TokenType::PAIR, TokenType::TUPLE, TokenType::DEQUE, TokenType::STACK,
+        TokenType::QUEUE, TokenType::PRIORITY_QUEUE, TokenType::SET, TokenType::SOA_LIST,
+    };
+
+    for (TokenType t : element_starts) {
+        if (check_ahead(state, 3, t)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 /**
  * Parses a base type (without pointer suffix).
  */
 string parse_base_type(ParserState& state) {
+    // Fixed-size array type: [N]T
+    if (is_array_type_start(state)) {
+        advance(state);
+        string size = consume(state, TokenType::NUMBER).value;
+        consume(state, TokenType::RBRACKET);
+        return "[" + size + "]" + parse_type(state);
+    }
+
     // Function type: fn(params) -> return_type
     if (check(state, TokenType::FN)) {
         advance(state);
@@ -212,16 +248,30 @@ string parse_base_type(ParserState& state) {
         return "Set<" + element_type + ">";
     }
 
+    // SoaList<T> type
+    if (check(state, TokenType::SOA_LIST)) {
+        advance(state);
+        consume(state, TokenType::LT);
+        string element_type = parse_type(state);
+        consume(state, TokenType::GT);
+        return "SoaList<" + element_type + ">";
+    }
+
     // Custom type (struct name), qualified type (module.Type), or generic (Type<T>)
     if (check(state, TokenType::IDENT)) {
         string type = current(state).value;
         advance(state);
 
-        // Check for generic type parameters: Type<T>
+        // Check for generic type arguments: Type<T> or Type<K, V>
         if (check(state, TokenType::LT)) {
-            advance(state);
-            type += "<" + parse_type(state) + ">";
-            consume(state, TokenType::GT);
+            vector<string> args = parse_type_args(state);
+            type += "<" + args[0];
+
+            for (size_t i = 1; i < args.size(); i++) {
+                type += ", " + args[i];
+            }
+
+            type += ">";
         }
 
         // Check for qualified type: module.Type
@@ -236,6 +286,22 @@ string parse_base_type(ParserState& state) {
     throw runtime_error("expected type at line " + to_string(current(state).line));
 }
 
+/**
+ * Parses the type arguments of a generic struct: <int> or <str, List<int>>.
+ */
+vector<string> parse_type_args(ParserState& state) {
+    consume(state, TokenType::LT);
+    vector<string> args = {parse_type(state)};
+
+    while (check(state, TokenType::COMMA)) {
+        advance(state);
+        args.push_back(parse_type(state));
+    }
+
+    consume(state, TokenType::GT);
+    return args;
+}
+
 /**
  * Parses a type, including function types like fn(int, int) -> int.
  * Also handles qualified types like module.Type.
@@ -67,12 +67,13 @@ unique_ptr<VariableDecl> parse_inferred_decl(ParserState& state, bool is_const)
  * @bishop_syntax Const Declaration
  * @category Variables
  * @order 3
- * @description Declare a constant with an explicit type or inferred type.
+ * @description Declare a constant with an explicit type or inferred type. Initializers built from literals, other constants and pure math helpers are evaluated at compile time; const list and map literals become static lookup tables.
  * @syntax const type name = expr; or const name := expr;
  * @example
  * const int MAX_SIZE = 100;
  * const PI := 3.14159;
  * const str NAME = "Bishop";
+ * const STATUS := {"ok": 200, "not_found": 404};
  */
 unique_ptr<VariableDecl> parse_const_decl(ParserState& state) {
     int start_line = current(state).line;
@@ -135,16 +135,42 @@ unique_ptr<Program> parse(ParserState& state) {
             state.pos = at_pos;
         }
 
-        // Check for visibility annotation
+        // Attributes (@arena, @soa) may come before or after @private
+        vector<string> attrs = parse_attributes(state);
         Visibility vis = parse_visibility(state);
 
+        for (const auto& attr : parse_attributes(state)) {
+            attrs.push_back(attr);
+        }
+
         if (check(state, TokenType::FN)) {
+            for (const auto& attr : attrs) {
+                if (!is_function_attribute(attr)) {
+                    throw runtime_error("attribute '@" + attr + "' must precede a struct at line " + to_string(current(state).line));
+                }
+            }
+
+            check_function_attributes(attrs, current(state).line);
+
             auto fn = parse_function(state, vis);
             fn->doc_comment = doc;
+            fn->attributes = move(attrs);
             program->functions.push_back(move(fn));
             continue;
         }
 
+        // Struct attributes are checked once the definition is reached
+        bool struct_next = check(state, TokenType::IDENT) &&
+                           check_ahead(state, 1, TokenType::DOUBLE_COLON) &&
+                           check_ahead(state, 2, TokenType::STRUCT);
+
+        for (const auto& attr : attrs) {
+            if (!struct_next || !is_struct_attribute(attr)) {
+                string target = is_struct_attribute(attr) ? "struct" : "function";
+                throw runtime_error("attribute '@" + attr + "' must precede a " + target + " at line " + to_string(current(state).line));
+            }
+        }
+
         // Module-level const declaration
         if (check(state, TokenType::CONST)) {
             auto decl = parse_const_decl(state);
@@ -159,11 +185,18 @@ unique_ptr<Program> parse(ParserState& state) {
 
         // Check for struct definition: Name :: struct { ... }
         // or method definition: Name :: method_name(...) -> type { ... }
+        // Generic structs and their methods name their parameters: Box<T> :: ...
         size_t saved_pos = state.pos;
         Token name_tok = current(state);
         string name = name_tok.value;
         advance(state);
 
+        vector<string> type_params;
+
+        if (check(state, TokenType::LT)) {
+            type_params = parse_type_params(state);
+        }
+
         if (!check(state, TokenType::DOUBLE_COLON)) {
             state.pos = saved_pos;
             advance(state);
@@ -173,12 +206,21 @@ unique_ptr<Program> parse(ParserState& state) {
         advance(state);
 
         if (check(state, TokenType::STRUCT)) {
+            state.type_params = type_params;
             auto s = parse_struct_def(state, name, vis);
+            state.type_params.clear();
             s->doc_comment = doc;
+            s->attributes = move(attrs);
+            s->type_params = move(type_params);
             program->structs.push_back(move(s));
             continue;
         }
 
+        if (!type_params.empty() && !check(state, TokenType::IDENT)) {
+            throw runtime_error("type parameters on '" + name + "' must be followed by a struct or method definition at line " +
+                                to_string(name_tok.line));
+        }
+
         if (check(state, TokenType::ERR)) {
             auto e = parse_error_def(state, name, vis);
             e->doc_comment = doc;
@@ -187,7 +229,9 @@ unique_ptr<Program> parse(ParserState& state) {
         }
 
         if (check(state, TokenType::IDENT)) {
+            state.type_params = move(type_params);
             auto m = parse_method_def(state, name, vis);
+            state.type_params.clear();
             m->doc_comment = doc;
             program->methods.push_back(move(m));
             continue;
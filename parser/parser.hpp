@@ -36,6 +36,7 @@ struct ParserState {
     std::vector<std::string> imported_modules;
     std::vector<UsingAlias> using_aliases;  ///< Aliases from using statements
     bool has_wildcard_using = false;        ///< True if any using module.* was parsed
+    std::vector<std::string> type_params;   ///< Type parameters of the generic definition being parsed
 
     explicit ParserState(const std::vector<Token>& toks) : tokens(toks) {}
 };
@@ -63,10 +64,13 @@ bool is_type_token(const ParserState& state);
 bool is_type_keyword_token(const ParserState& state);
 std::string get_type_keyword_name(const ParserState& state);
 std::string token_to_type(TokenType type);
+bool is_array_type_start(const ParserState& state);
 std::string parse_type(ParserState& state);
+std::vector<std::string> parse_type_args(ParserState& state);
 
 // Struct utilities (parse_struct.cpp)
 bool is_struct_type(const ParserState& state, const std::string& name);
+bool is_type_param(const ParserState& state, const std::string& name);
 std::unique_ptr<StructDef> parse_struct_def(ParserState& state, const std::string& name, Visibility vis);
 std::unique_ptr<StructLiteral> parse_struct_literal(ParserState& state, const std::string& name);
 
@@ -85,6 +89,11 @@ std::unique_ptr<UsingStmt> parse_using(ParserState& state);
 
 // Function parsing (parse_function.cpp)
 Visibility parse_visibility(ParserState& state);
+std::vector<std::string> parse_attributes(ParserState& state);
+std::vector<std::string> parse_type_params(ParserState& state);
+bool is_function_attribute(const std::string& name);
+void check_function_attributes(const std::vector<std::string>& attrs, int line);
+bool is_struct_attribute(const std::string& name);
 std::unique_ptr<FunctionDef> parse_function(ParserState& state, Visibility vis);
 std::unique_ptr<ExternFunctionDef> parse_extern_function(ParserState& state, const std::string& library);
 std::unique_ptr<MethodDef> parse_method_def(ParserState& state, const std::string& struct_name, Visibility vis);
@@ -116,6 +125,9 @@ std::unique_ptr<ASTNode> parse_additive(ParserState& state);
 std::unique_ptr<ASTNode> parse_primary(ParserState& state);
 std::unique_ptr<ASTNode> parse_postfix(ParserState& state, std::unique_ptr<ASTNode> left);
 
+// f-string parsing (parse_format_string.cpp)
+std::unique_ptr<FormatString> parse_format_string(ParserState& state);
+
 // Or expression handler parsing (parse_or.cpp)
 std::unique_ptr<OrReturn> parse_or_return(ParserState& state);
 std::unique_ptr<OrFail> parse_or_fail(ParserState& state);
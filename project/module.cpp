@@ -24,6 +24,7 @@
 #include "stdlib/algo.hpp"
 #include "stdlib/yaml.hpp"
 #include "stdlib/markdown.hpp"
+#include "stdlib/runtime.hpp"
 #include <fstream>
 #include <sstream>
 
@@ -208,6 +209,8 @@ unique_ptr<Module> ModuleManager::create_builtin_module(const string& name) {
         mod->ast = bishop::stdlib::create_yaml_module();
     } else if (name == "markdown") {
         mod->ast = bishop::stdlib::create_markdown_module();
+    } else if (name == "runtime") {
+        mod->ast = bishop::stdlib::create_runtime_module();
     } else {
         return nullptr;
     }
@@ -295,11 +298,13 @@ unique_ptr<Program> ModuleManager::merge_files(const vector<fs::path>& files, co
 
         // Merge functions
         for (auto& f : ast->functions) {
+            f->source_file = file.filename().string();
             merged->functions.push_back(move(f));
         }
 
         // Merge methods
         for (auto& m : ast->methods) {
+            m->source_file = file.filename().string();
             merged->methods.push_back(move(m));
         }
 
@@ -47,12 +47,54 @@ optional<ProjectConfig> find_project(const fs::path& start_path) {
     return nullopt;
 }
 
+/**
+ * @brief Reads a byte size written as an integer or a string such as "64K" or "1M".
+ */
+static optional<size_t> parse_size(toml::node_view<toml::node> node) {
+    if (auto bytes = node.value<int64_t>()) {
+        return *bytes > 0 ? optional<size_t>(static_cast<size_t>(*bytes)) : nullopt;
+    }
+
+    auto text = node.value<string>();
+
+    if (!text || text->empty()) {
+        return nullopt;
+    }
+
+    size_t multiplier = 1;
+    string digits = *text;
+    char suffix = digits.back();
+
+    if (suffix == 'K' || suffix == 'k') {
+        multiplier = 1024;
+        digits.pop_back();
+    } else if (suffix == 'M' || suffix == 'm') {
+        multiplier = 1024 * 1024;
+        digits.pop_back();
+    }
+
+    if (digits.empty() || digits.find_first_not_of("0123456789") != string::npos) {
+        return nullopt;
+    }
+
+    return stoull(digits) * multiplier;
+}
+
 /**
  * @brief Parses a bishop.toml file and returns the project configuration.
  *
  * Expects TOML format:
  *   [project]
  *   name = "projectname"
+ *
+ *   [runtime]
+ *   workers = 4
+ *   scheduler = "sharded"
+ *   stack_size = "64K"
+ *   io = "uring"
+ *   metrics = true
+ *   blocking_threads = 16
+ *   stall_ms = 100
  */
 optional<ProjectConfig> parse_init_file(const fs::path& init_file) {
     try {
@@ -75,6 +117,22 @@ optional<ProjectConfig> parse_init_file(const fs::path& init_file) {
             config.entry = *entry;
         }
 
+        auto runtime = tbl["runtime"];
+        config.runtime.workers = runtime["workers"].value<int>();
+
+        auto scheduler = runtime["scheduler"].value<string>();
+        config.runtime.sharded = scheduler && *scheduler == "sharded";
+
+        config.runtime.stack_size = parse_size(runtime["stack_size"]);
+        config.runtime.stack_guard = runtime["stack_guard"].value<bool>();
+        config.runtime.deep_stack_size = parse_size(runtime["deep_stack_size"]);
+
+        auto io = runtime["io"].value<string>();
+        config.runtime.io_uring = io && *io == "uring";
+        config.runtime.metrics = runtime["metrics"].value_or(false);
+        config.runtime.blocking_threads = runtime["blocking_threads"].value<int>();
+        config.runtime.stall_ms = runtime["stall_ms"].value<int>();
+
         return config;
     } catch (const toml::parse_error&) {
         return nullopt;
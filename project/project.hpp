@@ -14,6 +14,23 @@
 
 namespace fs = std::filesystem;
 
+/**
+ * @brief Fiber runtime settings from the [runtime] section of bishop.toml.
+ *
+ * Unset values keep the runtime's defaults.
+ */
+struct RuntimeOptions {
+    std::optional<int> workers;                 ///< Scheduler threads (0 = one per core)
+    bool sharded = false;                       ///< scheduler = "sharded": one pinned scheduler per core
+    std::optional<std::size_t> stack_size;      ///< Fiber stack size in bytes
+    std::optional<bool> stack_guard;            ///< Guard page below each fiber stack
+    std::optional<std::size_t> deep_stack_size; ///< Stack size for @deep_stack spawns
+    bool io_uring = false;                      ///< io = "uring": socket and file I/O through io_uring
+    bool metrics = false;                       ///< Scheduler metrics and the SIGUSR1 dump
+    std::optional<int> blocking_threads;        ///< Blocking pool threads (0 = one per core, at least 4)
+    std::optional<int> stall_ms;                ///< Report goroutines running this long without yielding
+};
+
 /**
  * @brief Project configuration loaded from bishop.toml
  */
@@ -22,6 +39,7 @@ struct ProjectConfig {
     fs::path root;         ///< Absolute path to project root directory
     fs::path init_file;    ///< Path to the bishop.toml file
     std::optional<std::string> entry;  ///< Optional entry point file for building
+    RuntimeOptions runtime;            ///< Settings from [runtime] section
 };
 
 /**
@@ -38,6 +56,15 @@ std::optional<ProjectConfig> find_project(const fs::path& start_path);
  * Expects TOML-like format:
  *   [project]
  *   name = "projectname"
+ *
+ *   [runtime]
+ *   workers = 4
+ *   scheduler = "sharded"
+ *   stack_size = "64K"
+ *   io = "uring"
+ *   metrics = true
+ *   blocking_threads = 16
+ *   stall_ms = 100
  */
 std::optional<ProjectConfig> parse_init_file(const fs::path& init_file);
 
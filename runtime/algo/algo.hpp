@@ -12,6 +12,7 @@
 #include <bishop/std.hpp>
 #include <bishop/error.hpp>
 #include <algorithm>
+#include <concepts>
 #include <functional>
 #include <numeric>
 #include <vector>
@@ -210,9 +211,11 @@ inline bishop::rt::Result<double> average_float(const std::vector<double>& list)
 /**
  * Returns true if all elements satisfy the predicate.
  */
+template<typename Pred>
+    requires std::predicate<Pred&, int>
 inline bool all_int(
     const std::vector<int>& list,
-    const std::function<bool(int)>& predicate
+    Pred&& predicate
 ) {
     return std::all_of(list.begin(), list.end(), predicate);
 }
@@ -220,9 +223,11 @@ inline bool all_int(
 /**
  * Returns true if any element satisfies the predicate.
  */
+template<typename Pred>
+    requires std::predicate<Pred&, int>
 inline bool any_int(
     const std::vector<int>& list,
-    const std::function<bool(int)>& predicate
+    Pred&& predicate
 ) {
     return std::any_of(list.begin(), list.end(), predicate);
 }
@@ -230,9 +235,11 @@ inline bool any_int(
 /**
  * Returns true if no elements satisfy the predicate.
  */
+template<typename Pred>
+    requires std::predicate<Pred&, int>
 inline bool none_int(
     const std::vector<int>& list,
-    const std::function<bool(int)>& predicate
+    Pred&& predicate
 ) {
     return std::none_of(list.begin(), list.end(), predicate);
 }
@@ -240,9 +247,11 @@ inline bool none_int(
 /**
  * Returns the count of elements that satisfy the predicate.
  */
+template<typename Pred>
+    requires std::predicate<Pred&, int>
 inline int count_int(
     const std::vector<int>& list,
-    const std::function<bool(int)>& predicate
+    Pred&& predicate
 ) {
     return static_cast<int>(std::count_if(list.begin(), list.end(), predicate));
 }
@@ -250,9 +259,11 @@ inline int count_int(
 /**
  * Returns the first element that satisfies the predicate, or error if not found.
  */
+template<typename Pred>
+    requires std::predicate<Pred&, int>
 inline bishop::rt::Result<int> find_int(
     const std::vector<int>& list,
-    const std::function<bool(int)>& predicate
+    Pred&& predicate
 ) {
     auto it = std::find_if(list.begin(), list.end(), predicate);
 
@@ -266,9 +277,11 @@ inline bishop::rt::Result<int> find_int(
 /**
  * Returns the index of the first element that satisfies the predicate, or -1.
  */
+template<typename Pred>
+    requires std::predicate<Pred&, int>
 inline int find_index_int(
     const std::vector<int>& list,
-    const std::function<bool(int)>& predicate
+    Pred&& predicate
 ) {
     auto it = std::find_if(list.begin(), list.end(), predicate);
 
@@ -282,9 +295,11 @@ inline int find_index_int(
 /**
  * Returns true if all string elements satisfy the predicate.
  */
+template<typename Pred>
+    requires std::predicate<Pred&, std::string>
 inline bool all_str(
     const std::vector<std::string>& list,
-    const std::function<bool(std::string)>& predicate
+    Pred&& predicate
 ) {
     return std::all_of(list.begin(), list.end(), predicate);
 }
@@ -292,9 +307,11 @@ inline bool all_str(
 /**
  * Returns true if any string element satisfies the predicate.
  */
+template<typename Pred>
+    requires std::predicate<Pred&, std::string>
 inline bool any_str(
     const std::vector<std::string>& list,
-    const std::function<bool(std::string)>& predicate
+    Pred&& predicate
 ) {
     return std::any_of(list.begin(), list.end(), predicate);
 }
@@ -302,9 +319,11 @@ inline bool any_str(
 /**
  * Returns true if no string elements satisfy the predicate.
  */
+template<typename Pred>
+    requires std::predicate<Pred&, std::string>
 inline bool none_str(
     const std::vector<std::string>& list,
-    const std::function<bool(std::string)>& predicate
+    Pred&& predicate
 ) {
     return std::none_of(list.begin(), list.end(), predicate);
 }
@@ -312,9 +331,11 @@ inline bool none_str(
 /**
  * Returns the count of string elements that satisfy the predicate.
  */
+template<typename Pred>
+    requires std::predicate<Pred&, std::string>
 inline int count_str(
     const std::vector<std::string>& list,
-    const std::function<bool(std::string)>& predicate
+    Pred&& predicate
 ) {
     return static_cast<int>(std::count_if(list.begin(), list.end(), predicate));
 }
@@ -322,9 +343,11 @@ inline int count_str(
 /**
  * Returns the first string element that satisfies the predicate, or error.
  */
+template<typename Pred>
+    requires std::predicate<Pred&, std::string>
 inline bishop::rt::Result<std::string> find_str(
     const std::vector<std::string>& list,
-    const std::function<bool(std::string)>& predicate
+    Pred&& predicate
 ) {
     auto it = std::find_if(list.begin(), list.end(), predicate);
 
@@ -338,9 +361,11 @@ inline bishop::rt::Result<std::string> find_str(
 /**
  * Returns the index of the first string element that satisfies the predicate.
  */
+template<typename Pred>
+    requires std::predicate<Pred&, std::string>
 inline int find_index_str(
     const std::vector<std::string>& list,
-    const std::function<bool(std::string)>& predicate
+    Pred&& predicate
 ) {
     auto it = std::find_if(list.begin(), list.end(), predicate);
 
@@ -358,9 +383,11 @@ inline int find_index_str(
 /**
  * Maps each integer to a new integer using a transform function.
  */
+template<typename F>
+    requires std::is_invocable_r_v<int, F&, int>
 inline std::vector<int> map_int(
     const std::vector<int>& list,
-    const std::function<int(int)>& transform
+    F&& transform
 ) {
     std::vector<int> result;
     result.reserve(list.size());
@@ -375,9 +402,11 @@ inline std::vector<int> map_int(
 /**
  * Maps each string to a new string using a transform function.
  */
+template<typename F>
+    requires std::is_invocable_r_v<std::string, F&, std::string>
 inline std::vector<std::string> map_str(
     const std::vector<std::string>& list,
-    const std::function<std::string(std::string)>& transform
+    F&& transform
 ) {
     std::vector<std::string> result;
     result.reserve(list.size());
@@ -392,9 +421,11 @@ inline std::vector<std::string> map_str(
 /**
  * Filters integers by a predicate, keeping only matching elements.
  */
+template<typename Pred>
+    requires std::predicate<Pred&, int>
 inline std::vector<int> filter_int(
     const std::vector<int>& list,
-    const std::function<bool(int)>& predicate
+    Pred&& predicate
 ) {
     std::vector<int> result;
 
@@ -410,9 +441,11 @@ inline std::vector<int> filter_int(
 /**
  * Filters strings by a predicate, keeping only matching elements.
  */
+template<typename Pred>
+    requires std::predicate<Pred&, std::string>
 inline std::vector<std::string> filter_str(
     const std::vector<std::string>& list,
-    const std::function<bool(std::string)>& predicate
+    Pred&& predicate
 ) {
     std::vector<std::string> result;
 
@@ -428,9 +461,11 @@ inline std::vector<std::string> filter_str(
 /**
  * Reduces an integer list to a single value using an accumulator function.
  */
+template<typename F>
+    requires std::is_invocable_r_v<int, F&, int, int>
 inline int reduce_int(
     const std::vector<int>& list,
-    const std::function<int(int, int)>& accumulator,
+    F&& accumulator,
     int initial
 ) {
     int result = initial;
@@ -445,9 +480,11 @@ inline int reduce_int(
 /**
  * Reduces a string list to a single string using an accumulator function.
  */
+template<typename F>
+    requires std::is_invocable_r_v<std::string, F&, std::string, std::string>
 inline std::string reduce_str(
     const std::vector<std::string>& list,
-    const std::function<std::string(std::string, std::string)>& accumulator,
+    F&& accumulator,
     const std::string& initial
 ) {
     std::string result = initial;
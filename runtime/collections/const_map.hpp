@@ -0,0 +1,77 @@
+/**
+ * @file const_map.hpp
+ * @brief Read-only perfect-hash map for Bishop const Map literals.
+ *
+ * The compiler picks a hash seed and table size at transpile time so that
+ * every key of a const Map literal lands in its own slot. A lookup is one
+ * hash, one slot read and one key comparison, with no allocation.
+ *
+ * const_map_hash() must stay in sync with the copy in codegen/emit_const.cpp.
+ */
+
+#ifndef BISHOP_COLLECTIONS_CONST_MAP_HPP
+#define BISHOP_COLLECTIONS_CONST_MAP_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+namespace bishop::rt {
+
+/**
+ * Seeded FNV-1a hash of a string key.
+ */
+constexpr std::uint64_t const_map_hash(std::string_view key, std::uint64_t seed) {
+    std::uint64_t h = 14695981039346656037ull ^ seed;
+
+    for (char c : key) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ull;
+    }
+
+    return h ^ (h >> 29);
+}
+
+/**
+ * Seeded multiplicative hash of an integer key.
+ */
+constexpr std::uint64_t const_map_hash(std::int64_t key, std::uint64_t seed) {
+    std::uint64_t h = (static_cast<std::uint64_t>(key) ^ seed) * 0x9E3779B97F4A7C15ull;
+    return h ^ (h >> 29);
+}
+
+/**
+ * Immutable map of N entries over a table of M slots (M a power of two).
+ * slots[hash(key) & (M - 1)] holds the entry index for that key, or -1.
+ * Iterates over entries in source order, like a Map of pairs.
+ */
+template<typename K, typename V, std::size_t N, std::size_t M>
+struct ConstMap {
+    std::array<std::pair<K, V>, N> entries;
+    std::array<int, M> slots;
+    std::uint64_t seed;
+
+    /**
+     * Returns a pointer to the entry for key, or end() if absent.
+     */
+    constexpr const std::pair<K, V>* find(const K& key) const {
+        int index = slots[const_map_hash(key, seed) & (M - 1)];
+
+        if (index < 0 || !(entries[index].first == key)) {
+            return end();
+        }
+
+        return &entries[index];
+    }
+
+    constexpr const std::pair<K, V>* begin() const { return entries.data(); }
+    constexpr const std::pair<K, V>* end() const { return entries.data() + N; }
+    constexpr std::size_t size() const { return N; }
+    constexpr bool empty() const { return N == 0; }
+};
+
+}  // namespace bishop::rt
+
+#endif  // BISHOP_COLLECTIONS_CONST_MAP_HPP
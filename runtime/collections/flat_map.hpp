@@ -0,0 +1,716 @@
+/**
+ * @file flat_map.hpp
+ * @brief Open-addressing hash map and set backing Bishop's Map and Set.
+ *
+ * FlatMap and FlatSet keep their elements in one flat slot array next to
+ * an array of one-byte control codes, SwissTable style. Each control byte
+ * is empty, deleted, or the low 7 bits of the element's hash. A lookup
+ * loads a group of 16 control bytes and compares them all at once (SSE2
+ * where available, a scalar loop otherwise), so most probes touch one
+ * cache line of metadata and at most one slot.
+ *
+ * Probing is by group: the table size is a multiple of 16 and groups are
+ * visited in triangular order. A group that still has an empty byte ends
+ * every probe that reaches it, which lets erase() free a slot outright
+ * instead of leaving a tombstone whenever its group has an empty byte.
+ */
+
+#ifndef BISHOP_COLLECTIONS_FLAT_MAP_HPP
+#define BISHOP_COLLECTIONS_FLAT_MAP_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace bishop {
+
+namespace detail {
+
+/**
+ * Finalizes a 64-bit value so every output bit depends on every input bit.
+ */
+inline std::uint64_t flat_mix(std::uint64_t x) noexcept {
+    x ^= x >> 32;
+    x *= 0xd6e8feb86659fd93ull;
+    x ^= x >> 32;
+    x *= 0xd6e8feb86659fd93ull;
+    x ^= x >> 32;
+    return x;
+}
+
+/**
+ * Hashes a byte string eight bytes at a time.
+ */
+inline std::uint64_t flat_hash_bytes(const char* data, std::size_t size) noexcept {
+    std::uint64_t h = 0x9E3779B97F4A7C15ull ^ (size * 0xff51afd7ed558ccdull);
+
+    while (size >= 8) {
+        std::uint64_t word;
+        std::memcpy(&word, data, 8);
+        h = (h ^ word) * 0xff51afd7ed558ccdull;
+        h ^= h >> 32;
+        data += 8;
+        size -= 8;
+    }
+
+    if (size > 0) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, data, size);
+        h = (h ^ word) * 0xff51afd7ed558ccdull;
+    }
+
+    return flat_mix(h);
+}
+
+/** Control byte of a slot that has never held an element. */
+inline constexpr std::int8_t kFlatEmpty = -128;
+
+/** Control byte of a slot whose element was erased. */
+inline constexpr std::int8_t kFlatDeleted = -2;
+
+/**
+ * Sixteen control bytes loaded together. Each match returns a bitmask
+ * with bit i set when byte i matches.
+ */
+class FlatGroup {
+public:
+    static constexpr std::size_t width = 16;
+
+    explicit FlatGroup(const std::int8_t* ctrl) noexcept {
+#ifdef __SSE2__
+        ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+        std::memcpy(ctrl_, ctrl, width);
+#endif
+    }
+
+    /**
+     * Bytes equal to the given 7-bit hash fragment.
+     */
+    std::uint32_t match(std::int8_t h2) const noexcept {
+#ifdef __SSE2__
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, _mm_set1_epi8(h2))));
+#else
+        std::uint32_t mask = 0;
+
+        for (std::size_t i = 0; i < width; i++) {
+            if (ctrl_[i] == h2) {
+                mask |= 1u << i;
+            }
+        }
+
+        return mask;
+#endif
+    }
+
+    /**
+     * Bytes that have never held an element.
+     */
+    std::uint32_t match_empty() const noexcept {
+        return match(kFlatEmpty);
+    }
+
+    /**
+     * Bytes that are empty or deleted (both have the sign bit set).
+     */
+    std::uint32_t match_free() const noexcept {
+#ifdef __SSE2__
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl_));
+#else
+        std::uint32_t mask = 0;
+
+        for (std::size_t i = 0; i < width; i++) {
+            if (ctrl_[i] < 0) {
+                mask |= 1u << i;
+            }
+        }
+
+        return mask;
+#endif
+    }
+
+private:
+#ifdef __SSE2__
+    __m128i ctrl_;
+#else
+    std::int8_t ctrl_[width];
+#endif
+};
+
+/** Key of a map slot. */
+struct FlatMapKey {
+    template<typename K, typename V>
+    const K& operator()(const std::pair<K, V>& slot) const noexcept { return slot.first; }
+};
+
+/** Key of a set slot: the element itself. */
+struct FlatSetKey {
+    template<typename T>
+    const T& operator()(const T& slot) const noexcept { return slot; }
+};
+
+/**
+ * Shared open-addressing table behind FlatMap and FlatSet. Slot is the
+ * stored element and KeyOf extracts its key.
+ */
+template<typename Key, typename Slot, typename KeyOf, typename Hash, typename Eq, typename Alloc>
+class FlatTable {
+    using SlotAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Slot>;
+    using SlotTraits = std::allocator_traits<SlotAlloc>;
+    using CtrlAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<std::int8_t>;
+
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+public:
+    using key_type = Key;
+    using value_type = Slot;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = Eq;
+    using allocator_type = Alloc;
+
+    /**
+     * Forward iterator over full slots.
+     */
+    template<bool Const>
+    class Iter {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Slot;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const Slot*, Slot*>;
+        using reference = std::conditional_t<Const, const Slot&, Slot&>;
+
+        Iter() = default;
+
+        Iter(const std::int8_t* ctrl, pointer slot, const std::int8_t* ctrl_end) noexcept
+            : ctrl_(ctrl), slot_(slot), ctrl_end_(ctrl_end) {
+            skip_free();
+        }
+
+        template<bool C = Const, typename = std::enable_if_t<C>>
+        Iter(const Iter<false>& other) noexcept
+            : ctrl_(other.ctrl_), slot_(other.slot_), ctrl_end_(other.ctrl_end_) {}
+
+        reference operator*() const noexcept { return *slot_; }
+        pointer operator->() const noexcept { return slot_; }
+
+        Iter& operator++() noexcept {
+            ++ctrl_;
+            ++slot_;
+            skip_free();
+            return *this;
+        }
+
+        Iter operator++(int) noexcept {
+            Iter old = *this;
+            ++*this;
+            return old;
+        }
+
+        friend bool operator==(const Iter& a, const Iter& b) noexcept { return a.slot_ == b.slot_; }
+
+    private:
+        template<bool>
+        friend class Iter;
+
+        void skip_free() noexcept {
+            while (ctrl_ != ctrl_end_ && *ctrl_ < 0) {
+                ++ctrl_;
+                ++slot_;
+            }
+        }
+
+        const std::int8_t* ctrl_ = nullptr;
+        pointer slot_ = nullptr;
+        const std::int8_t* ctrl_end_ = nullptr;
+    };
+
+    using iterator = Iter<false>;
+    using const_iterator = Iter<true>;
+
+    FlatTable() = default;
+
+    explicit FlatTable(const Alloc& alloc) : alloc_(alloc) {}
+
+    FlatTable(std::initializer_list<Slot> init, const Alloc& alloc = Alloc()) : alloc_(alloc) {
+        reserve(init.size());
+
+        for (const auto& slot : init) {
+            insert(slot);
+        }
+    }
+
+    FlatTable(const FlatTable& other)
+        : hash_(other.hash_), eq_(other.eq_),
+          alloc_(std::allocator_traits<Alloc>::select_on_container_copy_construction(other.alloc_)) {
+        copy_from(other);
+    }
+
+    FlatTable(FlatTable&& other) noexcept
+        : hash_(std::move(other.hash_)), eq_(std::move(other.eq_)), alloc_(std::move(other.alloc_)),
+          ctrl_(std::exchange(other.ctrl_, nullptr)), slots_(std::exchange(other.slots_, nullptr)),
+          capacity_(std::exchange(other.capacity_, 0)), size_(std::exchange(other.size_, 0)),
+          deleted_(std::exchange(other.deleted_, 0)) {}
+
+    FlatTable& operator=(FlatTable other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    ~FlatTable() {
+        release();
+    }
+
+    iterator begin() noexcept { return iterator(ctrl_, slots_, ctrl_ + capacity_); }
+    iterator end() noexcept { return iterator(ctrl_ + capacity_, slots_ + capacity_, ctrl_ + capacity_); }
+    const_iterator begin() const noexcept { return const_iterator(ctrl_, slots_, ctrl_ + capacity_); }
+    const_iterator end() const noexcept { return const_iterator(ctrl_ + capacity_, slots_ + capacity_, ctrl_ + capacity_); }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    size_type capacity() const noexcept { return capacity_; }
+
+    /**
+     * Returns an iterator to the element with the given key, or end().
+     */
+    iterator find(const Key& key) {
+        std::size_t index = find_index(key);
+        return index == npos ? end() : iterator(ctrl_ + index, slots_ + index, ctrl_ + capacity_);
+    }
+
+    const_iterator find(const Key& key) const {
+        std::size_t index = find_index(key);
+        return index == npos ? end() : const_iterator(ctrl_ + index, slots_ + index, ctrl_ + capacity_);
+    }
+
+    size_type count(const Key& key) const { return find_index(key) == npos ? 0 : 1; }
+    bool contains(const Key& key) const { return find_index(key) != npos; }
+
+    /**
+     * Inserts the element unless one with the same key is present.
+     */
+    std::pair<iterator, bool> insert(const Slot& slot) {
+        return emplace_slot(KeyOf{}(slot), slot);
+    }
+
+    std::pair<iterator, bool> insert(Slot&& slot) {
+        return emplace_slot(KeyOf{}(slot), std::move(slot));
+    }
+
+    /**
+     * Removes the element with the given key. Returns the number removed.
+     */
+    size_type erase(const Key& key) {
+        std::size_t index = find_index(key);
+
+        if (index == npos) {
+            return 0;
+        }
+
+        SlotAlloc slot_alloc(alloc_);
+        SlotTraits::destroy(slot_alloc, slots_ + index);
+
+        std::size_t group = index & ~(FlatGroup::width - 1);
+
+        if (FlatGroup(ctrl_ + group).match_empty()) {
+            ctrl_[index] = kFlatEmpty;
+        } else {
+            ctrl_[index] = kFlatDeleted;
+            deleted_++;
+        }
+
+        size_--;
+        return 1;
+    }
+
+    /**
+     * Removes every element but keeps the slot array.
+     */
+    void clear() noexcept {
+        destroy_slots();
+
+        if (capacity_ > 0) {
+            std::memset(ctrl_, static_cast<unsigned char>(kFlatEmpty), capacity_);
+        }
+
+        size_ = 0;
+        deleted_ = 0;
+    }
+
+    /**
+     * Grows the table so it can hold n elements without rehashing.
+     */
+    void reserve(size_type n) {
+        std::size_t capacity = std::max(FlatGroup::width, capacity_);
+
+        while (capacity * 7 / 8 < n) {
+            capacity *= 2;
+        }
+
+        if (capacity > capacity_) {
+            rehash(capacity);
+        }
+    }
+
+    void swap(FlatTable& other) noexcept {
+        using std::swap;
+        swap(hash_, other.hash_);
+        swap(eq_, other.eq_);
+        swap(alloc_, other.alloc_);
+        swap(ctrl_, other.ctrl_);
+        swap(slots_, other.slots_);
+        swap(capacity_, other.capacity_);
+        swap(size_, other.size_);
+        swap(deleted_, other.deleted_);
+    }
+
+    /**
+     * Tables are equal when they hold equal elements, in any order.
+     */
+    friend bool operator==(const FlatTable& a, const FlatTable& b) {
+        if (a.size_ != b.size_) {
+            return false;
+        }
+
+        for (const auto& slot : a) {
+            auto it = b.find(KeyOf{}(slot));
+
+            if (it == b.end() || !(*it == slot)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+protected:
+    /**
+     * Where an insert of a key lands: the slot holding the key if found,
+     * else the free slot to construct it in.
+     */
+    struct Probe {
+        std::size_t index;
+        bool found;
+        std::int8_t h2;
+    };
+
+    /**
+     * Finds the key or the first free slot on its probe sequence,
+     * growing the table first if it is at its load limit.
+     */
+    Probe probe_insert(const Key& key) {
+        if (size_ + deleted_ >= capacity_ * 7 / 8) {
+            grow();
+        }
+
+        std::size_t hash = hash_(key);
+        std::int8_t h2 = static_cast<std::int8_t>(hash & 0x7F);
+        std::size_t mask = capacity_ / FlatGroup::width - 1;
+        std::size_t group = (hash >> 7) & mask;
+        std::size_t free = npos;
+
+        for (std::size_t step = 1;; step++) {
+            std::size_t base = group * FlatGroup::width;
+            FlatGroup ctrl(ctrl_ + base);
+
+            for (std::uint32_t m = ctrl.match(h2); m; m &= m - 1) {
+                std::size_t index = base + std::countr_zero(m);
+
+                if (eq_(KeyOf{}(slots_[index]), key)) {
+                    return {index, true, h2};
+                }
+            }
+
+            if (free == npos) {
+                if (std::uint32_t m = ctrl.match_free()) {
+                    free = base + std::countr_zero(m);
+                }
+            }
+
+            if (ctrl.match_empty()) {
+                return {free, false, h2};
+            }
+
+            group = (group + step) & mask;
+        }
+    }
+
+    /**
+     * Constructs an element in the free slot chosen by probe_insert.
+     */
+    template<typename... Args>
+    Slot& construct_at(const Probe& probe, Args&&... args) {
+        SlotAlloc slot_alloc(alloc_);
+        SlotTraits::construct(slot_alloc, slots_ + probe.index, std::forward<Args>(args)...);
+
+        if (ctrl_[probe.index] == kFlatDeleted) {
+            deleted_--;
+        }
+
+        ctrl_[probe.index] = probe.h2;
+        size_++;
+        return slots_[probe.index];
+    }
+
+    /**
+     * Returns the slot at index.
+     */
+    Slot& slot_at(std::size_t index) noexcept { return slots_[index]; }
+
+private:
+    template<typename S>
+    std::pair<iterator, bool> emplace_slot(const Key& key, S&& slot) {
+        Probe probe = probe_insert(key);
+
+        if (!probe.found) {
+            construct_at(probe, std::forward<S>(slot));
+        }
+
+        return {iterator(ctrl_ + probe.index, slots_ + probe.index, ctrl_ + capacity_), !probe.found};
+    }
+
+    std::size_t find_index(const Key& key) const {
+        if (capacity_ == 0) {
+            return npos;
+        }
+
+        std::size_t hash = hash_(key);
+        std::int8_t h2 = static_cast<std::int8_t>(hash & 0x7F);
+        std::size_t mask = capacity_ / FlatGroup::width - 1;
+        std::size_t group = (hash >> 7) & mask;
+
+        for (std::size_t step = 1;; step++) {
+            std::size_t base = group * FlatGroup::width;
+            FlatGroup ctrl(ctrl_ + base);
+
+            for (std::uint32_t m = ctrl.match(h2); m; m &= m - 1) {
+                std::size_t index = base + std::countr_zero(m);
+
+                if (eq_(KeyOf{}(slots_[index]), key)) {
+                    return index;
+                }
+            }
+
+            if (ctrl.match_empty()) {
+                return npos;
+            }
+
+            group = (group + step) & mask;
+        }
+    }
+
+    /**
+     * Rehashes into a table with room to spare. A table full of
+     * tombstones is rebuilt at the same size instead of doubling.
+     */
+    void grow() {
+        std::size_t capacity = std::max(FlatGroup::width, capacity_);
+
+        while (size_ >= capacity * 7 / 16) {
+            capacity *= 2;
+        }
+
+        rehash(capacity);
+    }
+
+    void rehash(std::size_t capacity) {
+        std::int8_t* old_ctrl = ctrl_;
+        Slot* old_slots = slots_;
+        std::size_t old_capacity = capacity_;
+
+        allocate(capacity);
+        deleted_ = 0;
+
+        SlotAlloc slot_alloc(alloc_);
+        std::size_t mask = capacity_ / FlatGroup::width - 1;
+
+        for (std::size_t i = 0; i < old_capacity; i++) {
+            if (old_ctrl[i] < 0) {
+                continue;
+            }
+
+            std::size_t hash = hash_(KeyOf{}(old_slots[i]));
+            std::size_t group = (hash >> 7) & mask;
+
+            for (std::size_t step = 1;; step++) {
+                std::size_t base = group * FlatGroup::width;
+
+                if (std::uint32_t m = FlatGroup(ctrl_ + base).match_free()) {
+                    std::size_t index = base + std::countr_zero(m);
+                    SlotTraits::construct(slot_alloc, slots_ + index, std::move(old_slots[i]));
+                    ctrl_[index] = static_cast<std::int8_t>(hash & 0x7F);
+                    break;
+                }
+
+                group = (group + step) & mask;
+            }
+
+            SlotTraits::destroy(slot_alloc, old_slots + i);
+        }
+
+        deallocate(old_ctrl, old_slots, old_capacity);
+    }
+
+    void copy_from(const FlatTable& other) {
+        if (other.capacity_ == 0) {
+            return;
+        }
+
+        allocate(other.capacity_);
+        SlotAlloc slot_alloc(alloc_);
+
+        for (std::size_t i = 0; i < capacity_; i++) {
+            if (other.ctrl_[i] >= 0) {
+                SlotTraits::construct(slot_alloc, slots_ + i, other.slots_[i]);
+                size_++;
+            } else if (other.ctrl_[i] == kFlatDeleted) {
+                deleted_++;
+            }
+
+            ctrl_[i] = other.ctrl_[i];
+        }
+    }
+
+    void allocate(std::size_t capacity) {
+        CtrlAlloc ctrl_alloc(alloc_);
+        SlotAlloc slot_alloc(alloc_);
+        ctrl_ = std::allocator_traits<CtrlAlloc>::allocate(ctrl_alloc, capacity);
+        slots_ = SlotTraits::allocate(slot_alloc, capacity);
+        capacity_ = capacity;
+        std::memset(ctrl_, static_cast<unsigned char>(kFlatEmpty), capacity);
+    }
+
+    void deallocate(std::int8_t* ctrl, Slot* slots, std::size_t capacity) noexcept {
+        if (capacity == 0) {
+            return;
+        }
+
+        CtrlAlloc ctrl_alloc(alloc_);
+        SlotAlloc slot_alloc(alloc_);
+        std::allocator_traits<CtrlAlloc>::deallocate(ctrl_alloc, ctrl, capacity);
+        SlotTraits::deallocate(slot_alloc, slots, capacity);
+    }
+
+    void destroy_slots() noexcept {
+        SlotAlloc slot_alloc(alloc_);
+
+        for (std::size_t i = 0; i < capacity_; i++) {
+            if (ctrl_[i] >= 0) {
+                SlotTraits::destroy(slot_alloc, slots_ + i);
+            }
+        }
+    }
+
+    void release() noexcept {
+        destroy_slots();
+        deallocate(ctrl_, slots_, capacity_);
+        ctrl_ = nullptr;
+        slots_ = nullptr;
+        capacity_ = 0;
+        size_ = 0;
+        deleted_ = 0;
+    }
+
+    [[no_unique_address]] Hash hash_{};
+    [[no_unique_address]] Eq eq_{};
+    [[no_unique_address]] Alloc alloc_{};
+    std::int8_t* ctrl_ = nullptr;
+    Slot* slots_ = nullptr;
+    std::size_t capacity_ = 0;
+    std::size_t size_ = 0;
+    std::size_t deleted_ = 0;
+};
+
+}  // namespace detail
+
+/**
+ * Default hash for flat tables: a multiply-xorshift mix for integers,
+ * a word-at-a-time hash for strings, and std::hash plus the mix otherwise.
+ */
+template<typename T>
+struct FlatHash {
+    std::size_t operator()(const T& value) const noexcept {
+        if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+            return detail::flat_mix(static_cast<std::uint64_t>(value));
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            std::string_view s = value;
+            return detail::flat_hash_bytes(s.data(), s.size());
+        } else {
+            return detail::flat_mix(std::hash<T>{}(value));
+        }
+    }
+};
+
+/**
+ * Hash map backing Map<K, V>. Iterates over std::pair<K, V> in no
+ * particular order; keys must not be modified through an iterator.
+ */
+template<typename K, typename V, typename Hash = FlatHash<K>, typename Eq = std::equal_to<K>,
+         typename Alloc = std::allocator<std::pair<K, V>>>
+class FlatMap : public detail::FlatTable<K, std::pair<K, V>, detail::FlatMapKey, Hash, Eq, Alloc> {
+    using Base = detail::FlatTable<K, std::pair<K, V>, detail::FlatMapKey, Hash, Eq, Alloc>;
+
+public:
+    using mapped_type = V;
+    using Base::Base;
+
+    FlatMap(std::initializer_list<std::pair<K, V>> init, const Alloc& alloc = Alloc()) : Base(init, alloc) {}
+
+    /**
+     * Returns the value for key, inserting a default one if absent.
+     */
+    V& operator[](const K& key) {
+        auto probe = this->probe_insert(key);
+
+        if (probe.found) {
+            return this->slot_at(probe.index).second;
+        }
+
+        return this->construct_at(probe, std::piecewise_construct, std::forward_as_tuple(key),
+                                  std::forward_as_tuple()).second;
+    }
+
+    V& operator[](K&& key) {
+        auto probe = this->probe_insert(key);
+
+        if (probe.found) {
+            return this->slot_at(probe.index).second;
+        }
+
+        return this->construct_at(probe, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+                                  std::forward_as_tuple()).second;
+    }
+};
+
+/**
+ * Hash set backing Set<T>. Iterates in no particular order.
+ */
+template<typename T, typename Hash = FlatHash<T>, typename Eq = std::equal_to<T>,
+         typename Alloc = std::allocator<T>>
+class FlatSet : public detail::FlatTable<T, T, detail::FlatSetKey, Hash, Eq, Alloc> {
+    using Base = detail::FlatTable<T, T, detail::FlatSetKey, Hash, Eq, Alloc>;
+
+public:
+    using Base::Base;
+
+    FlatSet(std::initializer_list<T> init, const Alloc& alloc = Alloc()) : Base(init, alloc) {}
+};
+
+}  // namespace bishop
+
+#endif  // BISHOP_COLLECTIONS_FLAT_MAP_HPP
@@ -0,0 +1,194 @@
+/**
+ * @file soa_list.hpp
+ * @brief Struct-of-arrays storage for Bishop's SoaList<T>.
+ *
+ * A List<T> of structs keeps each element's fields together, so a loop
+ * that reads one field still pulls every field through the cache. A
+ * SoaList<T> keeps one contiguous column per field instead. Codegen gives
+ * every @soa struct two members that describe its layout:
+ *
+ *   - soa_fields(): a tuple of member pointers in declaration order
+ *   - soa_ref: an aggregate of references to one element's fields, with a
+ *     conversion back to the struct and assignment from it
+ *
+ * Iterating a SoaList yields soa_ref proxies, so `p.x` in a loop body reads
+ * and writes the x column directly.
+ */
+
+#ifndef BISHOP_COLLECTIONS_SOA_LIST_HPP
+#define BISHOP_COLLECTIONS_SOA_LIST_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace bishop {
+
+namespace detail {
+
+/**
+ * Column storage for a field of type M. std::vector<bool> packs bits and
+ * cannot hand out bool&, so bool columns store one byte-sized cell each.
+ */
+template<typename M>
+struct SoaColumn {
+    using type = std::vector<M>;
+
+    static M& at(type& c, std::size_t i) { return c[i]; }
+    static const M& at(const type& c, std::size_t i) { return c[i]; }
+    static void push(type& c, const M& v) { c.push_back(v); }
+};
+
+struct SoaBool {
+    bool value;
+};
+
+template<>
+struct SoaColumn<bool> {
+    using type = std::vector<SoaBool>;
+
+    static bool& at(type& c, std::size_t i) { return c[i].value; }
+    static const bool& at(const type& c, std::size_t i) { return c[i].value; }
+    static void push(type& c, bool v) { c.push_back({v}); }
+};
+
+template<typename P>
+struct SoaMember;
+
+template<typename C, typename M>
+struct SoaMember<M C::*> {
+    using type = M;
+};
+
+template<typename Fields>
+struct SoaColumns;
+
+template<typename... Ptrs>
+struct SoaColumns<std::tuple<Ptrs...>> {
+    using type = std::tuple<typename SoaColumn<typename SoaMember<Ptrs>::type>::type...>;
+};
+
+}  // namespace detail
+
+/**
+ * List of T stored as one std::vector per field of T.
+ * get() assembles a copy of an element; iteration and operator[] hand out
+ * soa_ref proxies that alias the columns.
+ */
+template<typename T>
+class SoaList {
+    using Fields = decltype(T::soa_fields());
+    using Columns = typename detail::SoaColumns<Fields>::type;
+    using Indexes = std::make_index_sequence<std::tuple_size_v<Fields>>;
+
+public:
+    using Ref = typename T::soa_ref;
+
+    class iterator {
+    public:
+        iterator(SoaList* list, std::size_t i) : list_(list), i_(i) {}
+
+        Ref operator*() const { return (*list_)[i_]; }
+        iterator& operator++() { i_++; return *this; }
+        bool operator!=(const iterator& other) const { return i_ != other.i_; }
+        bool operator==(const iterator& other) const { return i_ == other.i_; }
+
+    private:
+        SoaList* list_;
+        std::size_t i_;
+    };
+
+    std::size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    void push_back(const T& value) {
+        store_new(value, Indexes{});
+        count_++;
+    }
+
+    void pop_back() {
+        pop_columns(Indexes{});
+        count_--;
+    }
+
+    void clear() {
+        clear_columns(Indexes{});
+        count_ = 0;
+    }
+
+    void erase(std::size_t i) {
+        erase_columns(i, Indexes{});
+        count_--;
+    }
+
+    T at(std::size_t i) const {
+        check(i);
+        return load(i, Indexes{});
+    }
+
+    void set(std::size_t i, const T& value) {
+        check(i);
+        (*this)[i] = value;
+    }
+
+    T front() const { return at(0); }
+    T back() const { return at(count_ - 1); }
+
+    Ref operator[](std::size_t i) { return ref(i, Indexes{}); }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, count_); }
+
+private:
+    template<std::size_t I>
+    using Column = detail::SoaColumn<typename detail::SoaMember<std::tuple_element_t<I, Fields>>::type>;
+
+    void check(std::size_t i) const {
+        if (i >= count_) {
+            throw std::out_of_range("SoaList index out of range");
+        }
+    }
+
+    template<std::size_t... I>
+    Ref ref(std::size_t i, std::index_sequence<I...>) {
+        return Ref{Column<I>::at(std::get<I>(columns_), i)...};
+    }
+
+    template<std::size_t... I>
+    T load(std::size_t i, std::index_sequence<I...>) const {
+        constexpr Fields fields = T::soa_fields();
+        T value{};
+        ((value.*std::get<I>(fields) = Column<I>::at(std::get<I>(columns_), i)), ...);
+        return value;
+    }
+
+    template<std::size_t... I>
+    void store_new(const T& value, std::index_sequence<I...>) {
+        constexpr Fields fields = T::soa_fields();
+        (Column<I>::push(std::get<I>(columns_), value.*std::get<I>(fields)), ...);
+    }
+
+    template<std::size_t... I>
+    void pop_columns(std::index_sequence<I...>) {
+        (std::get<I>(columns_).pop_back(), ...);
+    }
+
+    template<std::size_t... I>
+    void clear_columns(std::index_sequence<I...>) {
+        (std::get<I>(columns_).clear(), ...);
+    }
+
+    template<std::size_t... I>
+    void erase_columns(std::size_t i, std::index_sequence<I...>) {
+        (std::get<I>(columns_).erase(std::get<I>(columns_).begin() + i), ...);
+    }
+
+    Columns columns_;
+    std::size_t count_ = 0;
+};
+
+}  // namespace bishop
+
+#endif  // BISHOP_COLLECTIONS_SOA_LIST_HPP
@@ -0,0 +1,100 @@
+/**
+ * @file tuple.hpp
+ * @brief Inline storage for Bishop's Tuple<T> in declared types.
+ *
+ * A Tuple<T>(...) expression knows its arity, so codegen lowers it to a
+ * std::array<T, N>. A declared Tuple<T> (a parameter, return type or typed
+ * variable) does not, so it maps to bishop::Tuple<T>: room for the maximum
+ * five elements in place plus a count. Any std::array<T, N> with N <= 5
+ * converts to it, and neither form touches the heap.
+ */
+
+#ifndef BISHOP_COLLECTIONS_TUPLE_HPP
+#define BISHOP_COLLECTIONS_TUPLE_HPP
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace bishop {
+
+/**
+ * Fixed-capacity homogeneous tuple of up to MaxTupleSize elements.
+ * Supports the std::array surface generated code uses: at(), operator[],
+ * size(), empty() and iteration.
+ */
+template<typename T>
+class Tuple {
+public:
+    static constexpr std::size_t MaxTupleSize = 5;
+
+    Tuple() = default;
+
+    template<std::size_t N>
+    Tuple(const std::array<T, N>& values) : count_(N) {
+        static_assert(N <= MaxTupleSize, "Tuple can have at most 5 elements");
+
+        for (std::size_t i = 0; i < N; i++) {
+            items_[i] = values[i];
+        }
+    }
+
+    template<std::size_t N>
+    Tuple(std::array<T, N>&& values) : count_(N) {
+        static_assert(N <= MaxTupleSize, "Tuple can have at most 5 elements");
+
+        for (std::size_t i = 0; i < N; i++) {
+            items_[i] = std::move(values[i]);
+        }
+    }
+
+    T& at(std::size_t i) {
+        if (i >= count_) {
+            throw std::out_of_range("Tuple index out of range");
+        }
+
+        return items_[i];
+    }
+
+    const T& at(std::size_t i) const {
+        if (i >= count_) {
+            throw std::out_of_range("Tuple index out of range");
+        }
+
+        return items_[i];
+    }
+
+    T& operator[](std::size_t i) { return items_[i]; }
+    const T& operator[](std::size_t i) const { return items_[i]; }
+
+    std::size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    T* begin() { return items_.data(); }
+    T* end() { return items_.data() + count_; }
+    const T* begin() const { return items_.data(); }
+    const T* end() const { return items_.data() + count_; }
+
+    friend bool operator==(const Tuple& a, const Tuple& b) {
+        if (a.count_ != b.count_) {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < a.count_; i++) {
+            if (!(a.items_[i] == b.items_[i])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+private:
+    std::array<T, MaxTupleSize> items_{};
+    std::size_t count_ = 0;
+};
+
+}  // namespace bishop
+
+#endif  // BISHOP_COLLECTIONS_TUPLE_HPP
@@ -35,10 +35,16 @@ inline std::string bytes_to_hex(const unsigned char* data, size_t len) {
 }
 
 /**
- * Generic hash function using EVP interface.
+ * Inputs at least this large are hashed on the runtime's blocking pool.
+ * Smaller ones hash faster than handing them to another thread.
+ */
+inline constexpr size_t BLOCKING_HASH_SIZE = 64 * 1024;
+
+/**
+ * Hashes data on the calling thread using the EVP interface.
  * Returns Result with hex string or error.
  */
-inline bishop::rt::Result<std::string> hash_evp(const std::string& data, const EVP_MD* md) {
+inline bishop::rt::Result<std::string> digest(const std::string& data, const EVP_MD* md) {
     EVP_MD_CTX* ctx = EVP_MD_CTX_new();
 
     if (!ctx) {
@@ -59,6 +65,19 @@ inline bishop::rt::Result<std::string> hash_evp(const std::string& data, const E
     return bytes_to_hex(hash, hash_len);
 }
 
+/**
+ * Generic hash function using EVP interface, moving large inputs off the
+ * scheduler thread.
+ * Returns Result with hex string or error.
+ */
+inline bishop::rt::Result<std::string> hash_evp(const std::string& data, const EVP_MD* md) {
+    if (data.size() >= BLOCKING_HASH_SIZE) {
+        return bishop::rt::run_blocking([&] { return digest(data, md); });
+    }
+
+    return digest(data, md);
+}
+
 /**
  * Computes MD5 hash of a string.
  * Returns Result with lowercase hex string or error.
@@ -92,10 +111,10 @@ inline bishop::rt::Result<std::string> sha512(const std::string& data) {
 }
 
 /**
- * Computes HMAC-SHA256 of data with key.
+ * Computes HMAC-SHA256 of data with key on the calling thread.
  * Returns Result with lowercase hex string or error.
  */
-inline bishop::rt::Result<std::string> hmac_sha256(const std::string& key, const std::string& data) {
+inline bishop::rt::Result<std::string> hmac_sha256_digest(const std::string& key, const std::string& data) {
     unsigned char result[EVP_MAX_MD_SIZE];
     unsigned int result_len = 0;
 
@@ -111,6 +130,19 @@ inline bishop::rt::Result<std::string> hmac_sha256(const std::string& key, const
     return bytes_to_hex(result, result_len);
 }
 
+/**
+ * Computes HMAC-SHA256 of data with key, on the blocking pool for large
+ * inputs.
+ * Returns Result with lowercase hex string or error.
+ */
+inline bishop::rt::Result<std::string> hmac_sha256(const std::string& key, const std::string& data) {
+    if (data.size() >= BLOCKING_HASH_SIZE) {
+        return bishop::rt::run_blocking([&] { return hmac_sha256_digest(key, data); });
+    }
+
+    return hmac_sha256_digest(key, data);
+}
+
 /**
  * Base64 encoding table.
  */
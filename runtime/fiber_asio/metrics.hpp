@@ -0,0 +1,121 @@
+/**
+ * @file metrics.hpp
+ * @brief Counters a fiber scheduler keeps about itself.
+ *
+ * The schedulers take an optional pointer to one of these. With none they
+ * count nothing, so the hooks cost a single untaken branch. Stall
+ * accounting also needs stall_after set, since it reads the clock on
+ * every switch.
+ */
+
+#ifndef NOG_FIBER_ASIO_METRICS_HPP
+#define NOG_FIBER_ASIO_METRICS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace boost {
+namespace fibers {
+namespace asio {
+
+/**
+ * Scheduler counters for one thread. The owning scheduler is the only
+ * writer, except that a work-stealing thief lowers its victim's ready
+ * count; any thread may read them.
+ */
+struct scheduler_metrics {
+    std::atomic<std::uint64_t> ready{0};     ///< Fibers waiting to run
+    std::atomic<std::uint64_t> switches{0};  ///< Fibers resumed by the scheduler
+    std::atomic<std::uint64_t> idle_ns{0};   ///< Time blocked waiting for I/O, timers or wakeups
+    std::atomic<std::int64_t> idle_since{0}; ///< steady_clock ticks when the current block began, or 0
+    std::atomic<std::int64_t> running_since{0};       ///< steady_clock ticks when the running fiber was resumed, or 0
+    std::atomic<std::uint64_t> stalls{0};             ///< Fiber runs of at least stall_after without yielding
+    std::atomic<std::uint64_t> stall_ns{0};           ///< Total time of those runs
+    std::atomic<std::uint64_t> longest_stall_ns{0};   ///< Longest of those runs
+
+    /// Runs this long count as stalls; zero turns stall accounting off.
+    /// Set before the scheduler is installed.
+    std::chrono::steady_clock::duration stall_after{0};
+
+    /**
+     * Adds to a counter only this thread writes, without a locked
+     * read-modify-write.
+     */
+    static void bump(std::atomic<std::uint64_t>& counter, std::uint64_t by = 1) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+    }
+
+    /**
+     * Marks a scheduling decision: the fiber that was running has stopped,
+     * and another starts unless resuming is false (the dispatcher or
+     * nothing runs next). A watchdog reads running_since to catch a fiber
+     * that is still running; the stall counters are added here, once the
+     * run is over and its length is known.
+     */
+    void switched(bool resuming) noexcept {
+        if (stall_after.count() == 0) {
+            return;
+        }
+
+        std::int64_t now = std::chrono::steady_clock::now().time_since_epoch().count();
+        std::int64_t since = running_since.load(std::memory_order_relaxed);
+
+        if (since != 0 && now - since >= stall_after.count()) {
+            auto ran = std::chrono::steady_clock::duration(now - since);
+            auto ns = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(ran).count());
+            bump(stalls);
+            bump(stall_ns, ns);
+
+            if (ns > longest_stall_ns.load(std::memory_order_relaxed)) {
+                longest_stall_ns.store(ns, std::memory_order_relaxed);
+            }
+        }
+
+        running_since.store(resuming ? now : 0, std::memory_order_relaxed);
+    }
+
+    /**
+     * Marks the start of a block, so readers can count a block that is
+     * still going on.
+     */
+    void begin_idle() noexcept {
+        idle_since.store(std::chrono::steady_clock::now().time_since_epoch().count(),
+                         std::memory_order_relaxed);
+    }
+
+    /**
+     * Adds the block begun by begin_idle() to idle_ns.
+     */
+    void end_idle() noexcept {
+        auto start = std::chrono::steady_clock::time_point(
+            std::chrono::steady_clock::duration(idle_since.load(std::memory_order_relaxed)));
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        bump(idle_ns, static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        idle_since.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * Idle time so far, including a block still going on.
+     */
+    std::uint64_t idle_now_ns() const noexcept {
+        std::uint64_t total = idle_ns.load(std::memory_order_relaxed);
+        std::int64_t since = idle_since.load(std::memory_order_relaxed);
+
+        if (since != 0) {
+            auto start = std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(since));
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            total += static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+
+        return total;
+    }
+};
+
+}  // namespace asio
+}  // namespace fibers
+}  // namespace boost
+
+#endif  // NOG_FIBER_ASIO_METRICS_HPP
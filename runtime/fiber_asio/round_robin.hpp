@@ -11,23 +11,20 @@
 #ifndef NOG_FIBER_ASIO_ROUND_ROBIN_HPP
 #define NOG_FIBER_ASIO_ROUND_ROBIN_HPP
 
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <memory>
-#include <mutex>
-#include <queue>
 
 #include <boost/asio.hpp>
 #include <boost/assert.hpp>
-#include <boost/asio/steady_timer.hpp>
 #include <boost/config.hpp>
 
-#include <boost/fiber/condition_variable.hpp>
 #include <boost/fiber/context.hpp>
-#include <boost/fiber/mutex.hpp>
 #include <boost/fiber/operations.hpp>
 #include <boost/fiber/scheduler.hpp>
 
+#include "metrics.hpp"
 #include "yield.hpp"
 
 namespace boost {
@@ -40,93 +37,125 @@ namespace asio {
  * This scheduler allows fibers to yield during async I/O operations.
  * When a fiber calls an async operation with boost::fibers::asio::yield,
  * it suspends and other fibers can run until the I/O completes.
+ *
+ * The scheduler drives its io_context itself: it polls for completions
+ * while fibers are ready and blocks in the io_context when none are, so a
+ * completion, a fiber timer or a wakeup from another thread resumes it.
+ * Completion handlers only ever run on the dispatcher fiber, never on a
+ * fiber that is in the middle of suspending: such a fiber may still hold
+ * the lock its own completion handler takes. The dispatcher is therefore
+ * kept out of the ready queue and handed the thread whenever the queue
+ * runs dry or a poll is due.
+ *
+ * Given a scheduler_metrics block, it also counts fibers resumed, keeps
+ * the ready-queue depth and adds up the time spent blocked in the
+ * io_context.
  */
 class round_robin : public algo::algorithm {
 private:
+    using work_guard_type = boost::asio::executor_work_guard<boost::asio::io_context::executor_type>;
+
+    /// Poll for I/O completions once per this many scheduling decisions
+    static constexpr std::size_t POLL_INTERVAL = 61;
+
     std::shared_ptr<boost::asio::io_context> io_ctx_;
-    boost::asio::steady_timer suspend_timer_;
+    work_guard_type work_;
+    scheduler_metrics* metrics_;
     boost::fibers::scheduler::ready_queue_type rqueue_{};
-    boost::fibers::mutex mtx_{};
-    boost::fibers::condition_variable cnd_{};
     std::size_t counter_{0};
+    std::size_t picks_{0};
+    context* dispatcher_{nullptr};
+    bool poll_due_{false};
+    std::atomic<bool> notified_{false};
+    bool woken_{false};  ///< A notify() wakeup ran outside suspend_until
 
-public:
     /**
-     * Service to keep io_context alive during fiber execution.
+     * Returns the dispatcher if it is ready to run, and marks it taken.
      */
-    struct service : public boost::asio::execution_context::service {
-        static boost::asio::execution_context::id id;
-
-        using work_guard_type = boost::asio::executor_work_guard<
-            boost::asio::io_context::executor_type>;
-        std::unique_ptr<work_guard_type> work_;
+    context* take_dispatcher() noexcept {
+        context* ctx = dispatcher_;
+        dispatcher_ = nullptr;
+        return ctx;
+    }
 
-        service(boost::asio::execution_context& ctx) :
-            boost::asio::execution_context::service(ctx),
-            work_{std::make_unique<work_guard_type>(
-                static_cast<boost::asio::io_context&>(ctx).get_executor())} {
+    /**
+     * Chooses the next fiber to run.
+     */
+    context* next_ready() noexcept {
+        // Completions resume their fibers by making them ready, so poll
+        // before choosing; a busy scheduler must not starve its I/O. Only
+        // the dispatcher polls, so a busy fiber hands over to it instead
+        if (context::active()->is_context(boost::fibers::type::dispatcher_context)) {
+            if (poll_due_) {
+                poll_due_ = false;
+                io_ctx_->poll();
+            }
+        } else if (++picks_ % POLL_INTERVAL == 0 && nullptr != dispatcher_) {
+            poll_due_ = true;
+            return take_dispatcher();
         }
 
-        virtual ~service() {}
+        if (rqueue_.empty()) {
+            return take_dispatcher();
+        }
 
-        service(service const&) = delete;
-        service& operator=(service const&) = delete;
+        context* ctx = &rqueue_.front();
+        rqueue_.pop_front();
+        BOOST_ASSERT(context::active() != ctx);
+        --counter_;
 
-        void shutdown() noexcept override {
-            work_.reset();
+        if (metrics_) {
+            metrics_->ready.store(counter_, std::memory_order_relaxed);
+            scheduler_metrics::bump(metrics_->switches);
         }
-    };
 
+        return ctx;
+    }
+
+public:
     /**
-     * Constructs scheduler with given io_context.
+     * Constructs scheduler with given io_context, counting into metrics
+     * if given.
      */
-    round_robin(std::shared_ptr<boost::asio::io_context> const& io_ctx) :
+    round_robin(std::shared_ptr<boost::asio::io_context> const& io_ctx,
+                scheduler_metrics* metrics = nullptr) :
         io_ctx_(io_ctx),
-        suspend_timer_(*io_ctx_) {
-        boost::asio::make_service<service>(*io_ctx_);
-        boost::asio::post(*io_ctx_, [this]() mutable {
-            while (!io_ctx_->stopped()) {
-                if (has_ready_fibers()) {
-                    while (io_ctx_->poll());
-                    std::unique_lock<boost::fibers::mutex> lk(mtx_);
-                    cnd_.wait(lk);
-                } else {
-                    if (!io_ctx_->run_one()) {
-                        break;
-                    }
-                }
-            }
-        });
+        work_(boost::asio::make_work_guard(*io_ctx)),
+        metrics_(metrics) {
     }
 
+    round_robin(round_robin const&) = delete;
+    round_robin& operator=(round_robin const&) = delete;
+
     /**
      * Called when a fiber becomes ready to run.
      */
-    void awakened(context* ctx) noexcept {
+    void awakened(context* ctx) noexcept override {
         BOOST_ASSERT(nullptr != ctx);
+
+        if (ctx->is_context(boost::fibers::type::dispatcher_context)) {
+            dispatcher_ = ctx;
+            return;
+        }
+
         BOOST_ASSERT(!ctx->ready_is_linked());
         ctx->ready_link(rqueue_);
+        ++counter_;
 
-        if (!ctx->is_context(boost::fibers::type::dispatcher_context)) {
-            ++counter_;
+        if (metrics_) {
+            metrics_->ready.store(counter_, std::memory_order_relaxed);
         }
     }
 
     /**
-     * Returns the next fiber to run.
+     * Returns the next fiber to run, noting the switch for stall
+     * accounting.
      */
-    context* pick_next() noexcept {
-        context* ctx(nullptr);
+    context* pick_next() noexcept override {
+        context* ctx = next_ready();
 
-        if (!rqueue_.empty()) {
-            ctx = &rqueue_.front();
-            rqueue_.pop_front();
-            BOOST_ASSERT(nullptr != ctx);
-            BOOST_ASSERT(context::active() != ctx);
-
-            if (!ctx->is_context(boost::fibers::type::dispatcher_context)) {
-                --counter_;
-            }
+        if (metrics_) {
+            metrics_->switched(nullptr != ctx && !ctx->is_context(boost::fibers::type::dispatcher_context));
         }
 
         return ctx;
@@ -135,37 +164,53 @@ public:
     /**
      * Returns true if any fibers are ready to run.
      */
-    bool has_ready_fibers() const noexcept {
+    bool has_ready_fibers() const noexcept override {
         return 0 < counter_;
     }
 
     /**
-     * Suspends scheduler until given time point.
+     * Blocks in the io_context until an I/O completion, a notify() from
+     * another thread, or the given time point. A poll in pick_next() may
+     * have run the wakeup after the dispatcher last took in remote-ready
+     * fibers; then this returns at once so that it looks again.
      */
-    void suspend_until(std::chrono::steady_clock::time_point const& abs_time) noexcept {
-        if ((std::chrono::steady_clock::time_point::max)() != abs_time) {
-            suspend_timer_.expires_at(abs_time);
-            suspend_timer_.async_wait([](boost::system::error_code const&) {
-                this_fiber::yield();
-            });
+    void suspend_until(std::chrono::steady_clock::time_point const& abs_time) noexcept override {
+        if (woken_) {
+            woken_ = false;
+            return;
+        }
+
+        if (metrics_) {
+            metrics_->begin_idle();
+        }
+
+        if ((std::chrono::steady_clock::time_point::max)() == abs_time) {
+            io_ctx_->run_one();
+        } else {
+            io_ctx_->run_one_until(abs_time);
         }
 
-        cnd_.notify_one();
+        woken_ = false;
+
+        if (metrics_) {
+            metrics_->end_idle();
+        }
     }
 
     /**
-     * Notifies scheduler that a fiber is ready.
+     * Wakes the scheduler when a fiber owned by it is made ready from
+     * another thread. At most one wakeup is queued at a time.
      */
-    void notify() noexcept {
-        suspend_timer_.async_wait([](boost::system::error_code const&) {
-            this_fiber::yield();
-        });
-        suspend_timer_.expires_at(std::chrono::steady_clock::now());
+    void notify() noexcept override {
+        if (!notified_.exchange(true, std::memory_order_acq_rel)) {
+            boost::asio::post(*io_ctx_, [this] {
+                notified_.store(false, std::memory_order_release);
+                woken_ = true;
+            });
+        }
     }
 };
 
-inline boost::asio::execution_context::id round_robin::service::id;
-
 }  // namespace asio
 }  // namespace fibers
 }  // namespace boost
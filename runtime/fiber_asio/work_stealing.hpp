@@ -0,0 +1,363 @@
+/**
+ * @file work_stealing.hpp
+ * @brief Multi-threaded work-stealing fiber scheduler integrated with Boost.Asio.
+ *
+ * Every worker thread installs its own instance with its own io_context.
+ * Spawned fibers wait in a queue that idle workers steal from; once a
+ * fiber has started running it stays on its worker, because Bishop code
+ * keeps thread-local state (arenas, output buffers, task pools) across
+ * suspension points.
+ */
+
+#ifndef NOG_FIBER_ASIO_WORK_STEALING_HPP
+#define NOG_FIBER_ASIO_WORK_STEALING_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <boost/asio.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <boost/fiber/algo/algorithm.hpp>
+#include <boost/fiber/context.hpp>
+#include <boost/fiber/detail/context_spinlock_queue.hpp>
+#include <boost/fiber/properties.hpp>
+#include <boost/fiber/scheduler.hpp>
+
+#include "metrics.hpp"
+#include "yield.hpp"
+
+namespace boost {
+namespace fibers {
+namespace asio {
+
+/**
+ * Scheduling state of one fiber: whether it has run yet.
+ */
+class worker_props : public fiber_properties {
+public:
+    worker_props(context* ctx) : fiber_properties(ctx) {}
+
+    bool started = false;
+};
+
+/**
+ * Work-stealing fiber scheduler, one instance per worker thread.
+ *
+ * Started fibers and the thread's own main fiber live in a private FIFO.
+ * Fibers that have not run yet live in a locked queue that any worker may
+ * take from, so spawned work spreads across threads. An idle worker
+ * blocks in its io_context; spawning wakes one of them. As in
+ * round_robin, the dispatcher is kept apart and alone polls for I/O.
+ *
+ * With a scheduler_metrics block it counts like round_robin. A worker's
+ * ready count covers both its queues, so a thief lowers its victim's.
+ */
+class work_stealing : public algo::algorithm_with_properties<worker_props> {
+private:
+    using work_guard_type = boost::asio::executor_work_guard<boost::asio::io_context::executor_type>;
+
+    /// Poll for I/O completions once per this many scheduling decisions
+    static constexpr std::size_t POLL_INTERVAL = 61;
+
+    /**
+     * State other workers touch. Slots are never freed, so a thief never
+     * races with a worker's scheduler being torn down at exit.
+     */
+    struct slot {
+        boost::fibers::detail::context_spinlock_queue fresh{};
+        std::atomic<boost::asio::io_context*> io_ctx{nullptr};
+        std::atomic<bool> sleeping{false};
+        std::atomic<bool> notified{false};
+        bool woken{false};  ///< A wakeup ran outside suspend_until; owner only
+        scheduler_metrics* metrics{nullptr};
+    };
+
+    static inline slot* slots_ = nullptr;
+    static inline std::uint32_t worker_count_ = 0;
+
+    std::uint32_t id_;
+    slot& self_;
+    std::shared_ptr<boost::asio::io_context> io_ctx_;
+    work_guard_type work_;
+    scheduler_metrics* metrics_;
+    boost::fibers::scheduler::ready_queue_type local_{};
+    std::size_t picks_{0};
+    context* dispatcher_{nullptr};
+    bool poll_due_{false};
+
+    /**
+     * Returns the dispatcher if it is ready to run, and marks it taken.
+     */
+    context* take_dispatcher() noexcept {
+        context* ctx = dispatcher_;
+        dispatcher_ = nullptr;
+        return ctx;
+    }
+
+    /**
+     * Counts a fiber about to be resumed, taken from this worker's own
+     * queues if own is set (a thief has already lowered its victim's count).
+     */
+    void count_switch(bool own) noexcept {
+        if (!metrics_) {
+            return;
+        }
+
+        if (own) {
+            metrics_->ready.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        scheduler_metrics::bump(metrics_->switches);
+    }
+
+    /**
+     * Posts a wakeup to a worker's io_context. At most one wakeup is
+     * queued per worker at a time.
+     */
+    static void wake(slot& s) noexcept {
+        boost::asio::io_context* io_ctx = s.io_ctx.load(std::memory_order_acquire);
+
+        if (io_ctx && !s.notified.exchange(true, std::memory_order_acq_rel)) {
+            boost::asio::post(*io_ctx, [&s] {
+                s.notified.store(false, std::memory_order_release);
+                s.woken = true;
+            });
+        }
+    }
+
+    /**
+     * Takes a not-yet-started fiber from another worker, scanning from the
+     * next worker up so that thieves spread over their victims.
+     */
+    context* steal_from_others() noexcept {
+        for (std::uint32_t i = 1; i < worker_count_; i++) {
+            slot& victim = slots_[(id_ + i) % worker_count_];
+
+            if (context* ctx = victim.fresh.steal()) {
+                if (victim.metrics) {
+                    victim.metrics->ready.fetch_sub(1, std::memory_order_relaxed);
+                }
+
+                return ctx;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * True if some worker has a fiber this one could take.
+     */
+    static bool work_available() noexcept {
+        for (std::uint32_t i = 0; i < worker_count_; i++) {
+            if (!slots_[i].fresh.empty()) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Wakes one sleeping worker so it can steal newly queued work.
+     */
+    void wake_idle_worker() noexcept {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        for (std::uint32_t i = 1; i < worker_count_; i++) {
+            slot& s = slots_[(id_ + i) % worker_count_];
+
+            if (s.sleeping.exchange(false, std::memory_order_acq_rel)) {
+                wake(s);
+                return;
+            }
+        }
+    }
+
+    /**
+     * Chooses the next fiber to run, alternating between started and new
+     * fibers so neither can starve the other, and stealing when both local
+     * queues are empty. The dispatcher runs when nothing else is ready or
+     * a poll for I/O completions is due.
+     */
+    context* next_ready() noexcept {
+        if (context::active()->is_context(boost::fibers::type::dispatcher_context)) {
+            if (poll_due_) {
+                poll_due_ = false;
+                io_ctx_->poll();
+            }
+        } else if (++picks_ % POLL_INTERVAL == 0 && nullptr != dispatcher_) {
+            poll_due_ = true;
+            return take_dispatcher();
+        }
+
+        context* ctx = nullptr;
+
+        if (picks_ & 1) {
+            ctx = self_.fresh.pop();
+        }
+
+        if (!ctx && !local_.empty()) {
+            ctx = &local_.front();
+            local_.pop_front();
+            count_switch(true);
+            return ctx;
+        }
+
+        if (!ctx) {
+            ctx = self_.fresh.pop();
+        }
+
+        bool own = nullptr != ctx;
+
+        if (!ctx) {
+            ctx = steal_from_others();
+        }
+
+        if (!ctx) {
+            return take_dispatcher();
+        }
+
+        count_switch(own);
+        context::active()->attach(ctx);
+        properties(ctx).started = true;
+        return ctx;
+    }
+
+public:
+    /**
+     * Sizes the worker registry. Call once, before any worker installs
+     * its scheduler. The io_contexts handed to the workers must outlive
+     * the process's last fiber.
+     */
+    static void init(std::uint32_t worker_count) {
+        slots_ = new slot[worker_count];
+        worker_count_ = worker_count;
+    }
+
+    /**
+     * Constructs the scheduler for worker id, driving the given io_context
+     * and counting into metrics if given.
+     */
+    work_stealing(std::uint32_t id, std::shared_ptr<boost::asio::io_context> const& io_ctx,
+                  scheduler_metrics* metrics = nullptr) :
+        id_(id),
+        self_(slots_[id]),
+        io_ctx_(io_ctx),
+        work_(boost::asio::make_work_guard(*io_ctx)),
+        metrics_(metrics) {
+        BOOST_ASSERT(id < worker_count_);
+        self_.metrics = metrics;
+        self_.io_ctx.store(io_ctx.get(), std::memory_order_release);
+    }
+
+    work_stealing(work_stealing const&) = delete;
+    work_stealing& operator=(work_stealing const&) = delete;
+
+    /**
+     * Queues a ready fiber: privately if it has run before, otherwise
+     * where idle workers can steal it.
+     */
+    void awakened(context* ctx, worker_props& props) noexcept override {
+        BOOST_ASSERT(nullptr != ctx);
+
+        if (ctx->is_context(boost::fibers::type::dispatcher_context)) {
+            dispatcher_ = ctx;
+            return;
+        }
+
+        if (metrics_) {
+            metrics_->ready.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (props.started || ctx->is_context(boost::fibers::type::pinned_context)) {
+            BOOST_ASSERT(!ctx->ready_is_linked());
+            ctx->ready_link(local_);
+            return;
+        }
+
+        ctx->detach();
+        self_.fresh.push(ctx);
+        wake_idle_worker();
+    }
+
+    /**
+     * Returns the next fiber to run, noting the switch for stall
+     * accounting.
+     */
+    context* pick_next() noexcept override {
+        context* ctx = next_ready();
+
+        if (metrics_) {
+            metrics_->switched(nullptr != ctx && !ctx->is_context(boost::fibers::type::dispatcher_context));
+        }
+
+        return ctx;
+    }
+
+    /**
+     * Returns true if this worker has fibers ready to run.
+     */
+    bool has_ready_fibers() const noexcept override {
+        return !local_.empty() || !self_.fresh.empty();
+    }
+
+    /**
+     * Blocks in the io_context until an I/O completion, a wakeup, or the
+     * given time point. A worker never sleeps while there is work to steal:
+     * it announces itself as sleeping before its last look at the queues,
+     * and spawners look for sleepers after queueing, so one always sees
+     * the other. Nor does it sleep if a poll in pick_next() ran a wakeup
+     * after the dispatcher last took in remote-ready fibers.
+     */
+    void suspend_until(std::chrono::steady_clock::time_point const& abs_time) noexcept override {
+        if (self_.woken) {
+            self_.woken = false;
+            return;
+        }
+
+        self_.sleeping.store(true, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (work_available()) {
+            self_.sleeping.store(false, std::memory_order_relaxed);
+            return;
+        }
+
+        if (metrics_) {
+            metrics_->begin_idle();
+        }
+
+        if ((std::chrono::steady_clock::time_point::max)() == abs_time) {
+            io_ctx_->run_one();
+        } else {
+            io_ctx_->run_one_until(abs_time);
+        }
+
+        self_.woken = false;
+
+        if (metrics_) {
+            metrics_->end_idle();
+        }
+
+        self_.sleeping.store(false, std::memory_order_relaxed);
+    }
+
+    /**
+     * Wakes the worker when a fiber it owns is made ready from another thread.
+     */
+    void notify() noexcept override {
+        wake(self_);
+    }
+};
+
+}  // namespace asio
+}  // namespace fibers
+}  // namespace boost
+
+#endif  // NOG_FIBER_ASIO_WORK_STEALING_HPP
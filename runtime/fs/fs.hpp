@@ -4,12 +4,21 @@
  *
  * Provides filesystem operations for Bishop programs.
  * This header is included when programs import the fs module.
+ *
+ * Calls that touch the disk run on the runtime's blocking pool while the
+ * calling fiber is parked, so a slow disk never stalls the scheduler.
+ * When the runtime runs on io_uring, whole-file reads and writes go
+ * through the core's ring instead. A file handle's line reads and writes
+ * mostly hit its stream buffer and stay on the fiber.
  */
 
 #pragma once
 
 #include <bishop/std.hpp>
 #include <bishop/error.hpp>
+#include <bishop/uring.hpp>
+#include <fcntl.h>
+#include <sys/stat.h>
 #include <fstream>
 #include <sstream>
 #include <filesystem>
@@ -51,6 +60,110 @@ struct DirEntry {
     bool is_symlink = false;
 };
 
+// ============================================================================
+// Whole-file I/O through io_uring
+// ============================================================================
+
+namespace detail {
+
+/**
+ * Outcome of a whole-file read or write through io_uring.
+ */
+enum class UringIo { ok, open_failed, io_failed };
+
+/**
+ * Reads a whole file through the io_uring backend. A regular file is read
+ * in one request when its size is known up front.
+ */
+inline UringIo uring_read_file(const std::string& path, std::string& out) {
+    int fd = bishop::rt::uring::open(path, O_RDONLY);
+
+    if (fd < 0) {
+        return UringIo::open_failed;
+    }
+
+    struct stat st {};
+    bool sized = ::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0;
+    out.resize(sized ? static_cast<size_t>(st.st_size) : 4096);
+    size_t size = 0;
+    UringIo outcome = UringIo::ok;
+
+    while (true) {
+        if (size == out.size()) {
+            if (sized) {
+                break;
+            }
+
+            out.resize(out.size() * 2);
+        }
+
+        long n = bishop::rt::uring::read(fd, out.data() + size, out.size() - size, size);
+
+        if (n < 0) {
+            outcome = UringIo::io_failed;
+            break;
+        }
+
+        if (n == 0) {
+            break;
+        }
+
+        size += static_cast<size_t>(n);
+    }
+
+    out.resize(size);
+    bishop::rt::uring::close(fd);
+    return outcome;
+}
+
+/**
+ * Writes data to a file through the io_uring backend, truncating it or
+ * appending to it.
+ */
+inline UringIo uring_write_file(const std::string& path, const std::string& data, bool append) {
+    int fd = bishop::rt::uring::open(path, O_WRONLY | O_CREAT | (append ? O_APPEND : O_TRUNC));
+
+    if (fd < 0) {
+        return UringIo::open_failed;
+    }
+
+    size_t written = 0;
+    UringIo outcome = UringIo::ok;
+
+    while (written < data.size()) {
+        long n = bishop::rt::uring::write(fd, data.data() + written, data.size() - written, written);
+
+        if (n <= 0) {
+            outcome = UringIo::io_failed;
+            break;
+        }
+
+        written += static_cast<size_t>(n);
+    }
+
+    bishop::rt::uring::close(fd);
+    return outcome;
+}
+
+/**
+ * Maps a failed io_uring write to the same error the stream path reports.
+ */
+inline bishop::rt::Result<bool> uring_write_result(UringIo outcome, const std::string& path, bool append) {
+    if (outcome == UringIo::open_failed) {
+        return bishop::rt::Result<bool>::error(bishop::rt::Error(
+            (append ? "Failed to open file for appending: " : "Failed to open file for writing: ") + path));
+    }
+
+    if (outcome == UringIo::io_failed) {
+        return bishop::rt::Result<bool>::error(bishop::rt::Error(
+            (append ? "Failed to append to file: " : "Failed to write to file: ") + path));
+    }
+
+    return bishop::rt::Result<bool>::ok(true);
+}
+
+}  // namespace detail
+
 // ============================================================================
 // File handle struct for open/close/read/write
 // ============================================================================
@@ -113,47 +226,51 @@ struct File {
      * Reads all lines from the file.
      */
     bishop::rt::Result<std::vector<std::string>> read_lines() {
-        if (!impl || impl->closed) {
-            return bishop::rt::Result<std::vector<std::string>>::error(
-                bishop::rt::Error("File is closed")
-            );
-        }
+        return bishop::rt::run_blocking([&]() -> bishop::rt::Result<std::vector<std::string>> {
+            if (!impl || impl->closed) {
+                return bishop::rt::Result<std::vector<std::string>>::error(
+                    bishop::rt::Error("File is closed")
+                );
+            }
 
-        if (!impl->stream.is_open()) {
-            return bishop::rt::Result<std::vector<std::string>>::error(
-                bishop::rt::Error("Cannot read from file: " + impl->path)
-            );
-        }
+            if (!impl->stream.is_open()) {
+                return bishop::rt::Result<std::vector<std::string>>::error(
+                    bishop::rt::Error("Cannot read from file: " + impl->path)
+                );
+            }
 
-        std::vector<std::string> lines;
-        std::string line;
+            std::vector<std::string> lines;
+            std::string line;
 
-        while (std::getline(impl->stream, line)) {
-            lines.push_back(line);
-        }
+            while (std::getline(impl->stream, line)) {
+                lines.push_back(line);
+            }
 
-        return bishop::rt::Result<std::vector<std::string>>::ok(lines);
+            return bishop::rt::Result<std::vector<std::string>>::ok(lines);
+        });
     }
 
     /**
      * Reads all content from the file.
      */
     bishop::rt::Result<std::string> read_all() {
-        if (!impl || impl->closed) {
-            return bishop::rt::Result<std::string>::error(
-                bishop::rt::Error("File is closed")
-            );
-        }
+        return bishop::rt::run_blocking([&]() -> bishop::rt::Result<std::string> {
+            if (!impl || impl->closed) {
+                return bishop::rt::Result<std::string>::error(
+                    bishop::rt::Error("File is closed")
+                );
+            }
 
-        if (!impl->stream.is_open()) {
-            return bishop::rt::Result<std::string>::error(
-                bishop::rt::Error("Cannot read from file: " + impl->path)
-            );
-        }
+            if (!impl->stream.is_open()) {
+                return bishop::rt::Result<std::string>::error(
+                    bishop::rt::Error("Cannot read from file: " + impl->path)
+                );
+            }
 
-        std::stringstream buffer;
-        buffer << impl->stream.rdbuf();
-        return bishop::rt::Result<std::string>::ok(buffer.str());
+            std::stringstream buffer;
+            buffer << impl->stream.rdbuf();
+            return bishop::rt::Result<std::string>::ok(buffer.str());
+        });
     }
 
     /**
@@ -215,7 +332,7 @@ struct File {
      */
     void close() {
         if (impl && !impl->closed && impl->stream.is_open()) {
-            impl->stream.close();
+            bishop::rt::run_blocking([&] { impl->stream.close(); });
             impl->closed = true;
         }
     }
@@ -230,53 +347,68 @@ struct File {
  * Returns empty string if file cannot be read.
  */
 inline std::string read_file(const std::string& path) {
-    std::ifstream file(path);
-
-    if (!file) {
-        return "";
+    if (bishop::rt::uring::enabled()) {
+        std::string content;
+        return detail::uring_read_file(path, content) == detail::UringIo::ok ? content : "";
     }
 
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    return buffer.str();
+    return bishop::rt::run_blocking([&]() -> std::string {
+        std::ifstream file(path);
+
+        if (!file) {
+            return "";
+        }
+
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return buffer.str();
+    });
 }
 
 /**
  * Checks if a file or directory exists.
  */
 inline bool exists(const std::string& path) {
-    return std::filesystem::exists(path);
+    return bishop::rt::run_blocking([&]() -> bool {
+        return std::filesystem::exists(path);
+    });
 }
 
 /**
  * Checks if a path is a directory.
  */
 inline bool is_dir(const std::string& path) {
-    return std::filesystem::is_directory(path);
+    return bishop::rt::run_blocking([&]() -> bool {
+        return std::filesystem::is_directory(path);
+    });
 }
 
 /**
  * Checks if a path is a regular file.
  */
 inline bool is_file(const std::string& path) {
-    return std::filesystem::is_regular_file(path);
+    return bishop::rt::run_blocking([&]() -> bool {
+        return std::filesystem::is_regular_file(path);
+    });
 }
 
 /**
  * Lists all entries in a directory, separated by newlines.
  */
 inline std::string read_dir(const std::string& path) {
-    std::string result;
+    return bishop::rt::run_blocking([&]() -> std::string {
+        std::string result;
 
-    for (const auto& entry : std::filesystem::directory_iterator(path)) {
-        if (!result.empty()) {
-            result += "\n";
-        }
+        for (const auto& entry : std::filesystem::directory_iterator(path)) {
+            if (!result.empty()) {
+                result += "\n";
+            }
 
-        result += entry.path().filename().string();
-    }
+            result += entry.path().filename().string();
+        }
 
-    return result;
+        return result;
+    });
 }
 
 // ============================================================================
@@ -287,86 +419,125 @@ inline std::string read_dir(const std::string& path) {
  * Writes content to a file, creating it if it doesn't exist.
  */
 inline bishop::rt::Result<bool> write_file(const std::string& path, const std::string& content) {
-    std::ofstream file(path);
-
-    if (!file) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("Failed to open file for writing: " + path)
-        );
+    if (bishop::rt::uring::enabled()) {
+        return detail::uring_write_result(detail::uring_write_file(path, content, false), path, false);
     }
 
-    file << content;
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<bool> {
+        std::ofstream file(path);
 
-    if (!file.good()) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("Failed to write to file: " + path)
-        );
-    }
+        if (!file) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("Failed to open file for writing: " + path)
+            );
+        }
 
-    return bishop::rt::Result<bool>::ok(true);
+        file << content;
+
+        if (!file.good()) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("Failed to write to file: " + path)
+            );
+        }
+
+        return bishop::rt::Result<bool>::ok(true);
+    });
 }
 
 /**
  * Appends content to a file, creating it if it doesn't exist.
  */
 inline bishop::rt::Result<bool> append_file(const std::string& path, const std::string& content) {
-    std::ofstream file(path, std::ios::app);
-
-    if (!file) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("Failed to open file for appending: " + path)
-        );
+    if (bishop::rt::uring::enabled()) {
+        return detail::uring_write_result(detail::uring_write_file(path, content, true), path, true);
     }
 
-    file << content;
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<bool> {
+        std::ofstream file(path, std::ios::app);
 
-    if (!file.good()) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("Failed to append to file: " + path)
-        );
-    }
+        if (!file) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("Failed to open file for appending: " + path)
+            );
+        }
 
-    return bishop::rt::Result<bool>::ok(true);
+        file << content;
+
+        if (!file.good()) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("Failed to append to file: " + path)
+            );
+        }
+
+        return bishop::rt::Result<bool>::ok(true);
+    });
 }
 
 /**
  * Reads binary content from a file.
  */
 inline bishop::rt::Result<std::string> read_bytes(const std::string& path) {
-    std::ifstream file(path, std::ios::binary);
+    if (bishop::rt::uring::enabled()) {
+        std::string content;
+        detail::UringIo outcome = detail::uring_read_file(path, content);
 
-    if (!file) {
-        return bishop::rt::Result<std::string>::error(
-            bishop::rt::Error("Failed to open file for reading: " + path)
-        );
+        if (outcome == detail::UringIo::open_failed) {
+            return bishop::rt::Result<std::string>::error(
+                bishop::rt::Error("Failed to open file for reading: " + path)
+            );
+        }
+
+        if (outcome == detail::UringIo::io_failed) {
+            return bishop::rt::Result<std::string>::error(
+                bishop::rt::Error("Failed to read file: " + path)
+            );
+        }
+
+        return bishop::rt::Result<std::string>::ok(std::move(content));
     }
 
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    return bishop::rt::Result<std::string>::ok(buffer.str());
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<std::string> {
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file) {
+            return bishop::rt::Result<std::string>::error(
+                bishop::rt::Error("Failed to open file for reading: " + path)
+            );
+        }
+
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return bishop::rt::Result<std::string>::ok(buffer.str());
+    });
 }
 
 /**
  * Writes binary content to a file.
  */
 inline bishop::rt::Result<bool> write_bytes(const std::string& path, const std::string& data) {
-    std::ofstream file(path, std::ios::binary);
-
-    if (!file) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("Failed to open file for writing: " + path)
-        );
+    if (bishop::rt::uring::enabled()) {
+        return detail::uring_write_result(detail::uring_write_file(path, data, false), path, false);
     }
 
-    file.write(data.data(), data.size());
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<bool> {
+        std::ofstream file(path, std::ios::binary);
 
-    if (!file.good()) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("Failed to write to file: " + path)
-        );
-    }
+        if (!file) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("Failed to open file for writing: " + path)
+            );
+        }
 
-    return bishop::rt::Result<bool>::ok(true);
+        file.write(data.data(), data.size());
+
+        if (!file.good()) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("Failed to write to file: " + path)
+            );
+        }
+
+        return bishop::rt::Result<bool>::ok(true);
+    });
 }
 
 // ============================================================================
@@ -378,33 +549,35 @@ inline bishop::rt::Result<bool> write_bytes(const std::string& path, const std::
  * Modes: "r" (read), "w" (write), "a" (append), "rw" (read+write)
  */
 inline bishop::rt::Result<File> open(const std::string& path, const std::string& mode) {
-    File file(path, mode);
-
-    std::ios_base::openmode ios_mode = std::ios_base::in;
-
-    if (mode == "r") {
-        ios_mode = std::ios_base::in;
-    } else if (mode == "w") {
-        ios_mode = std::ios_base::out | std::ios_base::trunc;
-    } else if (mode == "a") {
-        ios_mode = std::ios_base::out | std::ios_base::app;
-    } else if (mode == "rw") {
-        ios_mode = std::ios_base::in | std::ios_base::out;
-    } else {
-        return bishop::rt::Result<File>::error(
-            bishop::rt::Error("Invalid file mode: " + mode)
-        );
-    }
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<File> {
+        File file(path, mode);
+
+        std::ios_base::openmode ios_mode = std::ios_base::in;
+
+        if (mode == "r") {
+            ios_mode = std::ios_base::in;
+        } else if (mode == "w") {
+            ios_mode = std::ios_base::out | std::ios_base::trunc;
+        } else if (mode == "a") {
+            ios_mode = std::ios_base::out | std::ios_base::app;
+        } else if (mode == "rw") {
+            ios_mode = std::ios_base::in | std::ios_base::out;
+        } else {
+            return bishop::rt::Result<File>::error(
+                bishop::rt::Error("Invalid file mode: " + mode)
+            );
+        }
 
-    file.impl->stream.open(path, ios_mode);
+        file.impl->stream.open(path, ios_mode);
 
-    if (!file.impl->stream.is_open()) {
-        return bishop::rt::Result<File>::error(
-            bishop::rt::Error("Failed to open file: " + path)
-        );
-    }
+        if (!file.impl->stream.is_open()) {
+            return bishop::rt::Result<File>::error(
+                bishop::rt::Error("Failed to open file: " + path)
+            );
+        }
 
-    return bishop::rt::Result<File>::ok(file);
+        return bishop::rt::Result<File>::ok(file);
+    });
 }
 
 // ============================================================================
@@ -415,139 +588,151 @@ inline bishop::rt::Result<File> open(const std::string& path, const std::string&
  * Lists all entries in a directory as a List<str>.
  */
 inline bishop::rt::Result<std::vector<std::string>> list_dir(const std::string& path) {
-    if (!std::filesystem::exists(path)) {
-        return bishop::rt::Result<std::vector<std::string>>::error(
-            bishop::rt::Error("Directory does not exist: " + path)
-        );
-    }
-
-    if (!std::filesystem::is_directory(path)) {
-        return bishop::rt::Result<std::vector<std::string>>::error(
-            bishop::rt::Error("Path is not a directory: " + path)
-        );
-    }
-
-    std::vector<std::string> entries;
-    std::error_code ec;
-    std::filesystem::directory_iterator it(path, ec);
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<std::vector<std::string>> {
+        if (!std::filesystem::exists(path)) {
+            return bishop::rt::Result<std::vector<std::string>>::error(
+                bishop::rt::Error("Directory does not exist: " + path)
+            );
+        }
 
-    if (ec) {
-        return bishop::rt::Result<std::vector<std::string>>::error(
-            bishop::rt::Error("Failed to list directory: " + path + " - " + ec.message())
-        );
-    }
+        if (!std::filesystem::is_directory(path)) {
+            return bishop::rt::Result<std::vector<std::string>>::error(
+                bishop::rt::Error("Path is not a directory: " + path)
+            );
+        }
 
-    std::filesystem::directory_iterator end;
+        std::vector<std::string> entries;
+        std::error_code ec;
+        std::filesystem::directory_iterator it(path, ec);
 
-    for (; it != end; it.increment(ec)) {
         if (ec) {
             return bishop::rt::Result<std::vector<std::string>>::error(
                 bishop::rt::Error("Failed to list directory: " + path + " - " + ec.message())
             );
         }
 
-        entries.push_back(it->path().filename().string());
-    }
+        std::filesystem::directory_iterator end;
+
+        for (; it != end; it.increment(ec)) {
+            if (ec) {
+                return bishop::rt::Result<std::vector<std::string>>::error(
+                    bishop::rt::Error("Failed to list directory: " + path + " - " + ec.message())
+                );
+            }
 
-    return bishop::rt::Result<std::vector<std::string>>::ok(entries);
+            entries.push_back(it->path().filename().string());
+        }
+
+        return bishop::rt::Result<std::vector<std::string>>::ok(entries);
+    });
 }
 
 /**
  * Creates a single directory.
  */
 inline bishop::rt::Result<bool> mkdir(const std::string& path) {
-    std::error_code ec;
-    bool created = std::filesystem::create_directory(path, ec);
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<bool> {
+        std::error_code ec;
+        bool created = std::filesystem::create_directory(path, ec);
 
-    if (ec) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("Failed to create directory: " + path + " - " + ec.message())
-        );
-    }
+        if (ec) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("Failed to create directory: " + path + " - " + ec.message())
+            );
+        }
 
-    return bishop::rt::Result<bool>::ok(created);
+        return bishop::rt::Result<bool>::ok(created);
+    });
 }
 
 /**
  * Creates a directory and all parent directories.
  */
 inline bishop::rt::Result<bool> mkdir_all(const std::string& path) {
-    std::error_code ec;
-    bool created = std::filesystem::create_directories(path, ec);
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<bool> {
+        std::error_code ec;
+        bool created = std::filesystem::create_directories(path, ec);
 
-    if (ec) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("Failed to create directories: " + path + " - " + ec.message())
-        );
-    }
+        if (ec) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("Failed to create directories: " + path + " - " + ec.message())
+            );
+        }
 
-    return bishop::rt::Result<bool>::ok(created);
+        return bishop::rt::Result<bool>::ok(created);
+    });
 }
 
 /**
  * Removes a single file.
  */
 inline bishop::rt::Result<bool> remove(const std::string& path) {
-    std::error_code ec;
-    bool removed = std::filesystem::remove(path, ec);
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<bool> {
+        std::error_code ec;
+        bool removed = std::filesystem::remove(path, ec);
 
-    if (ec) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("Failed to remove file: " + path + " - " + ec.message())
-        );
-    }
+        if (ec) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("Failed to remove file: " + path + " - " + ec.message())
+            );
+        }
 
-    if (!removed) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("File does not exist: " + path)
-        );
-    }
+        if (!removed) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("File does not exist: " + path)
+            );
+        }
 
-    return bishop::rt::Result<bool>::ok(true);
+        return bishop::rt::Result<bool>::ok(true);
+    });
 }
 
 /**
  * Removes an empty directory.
  */
 inline bishop::rt::Result<bool> remove_dir(const std::string& path) {
-    std::error_code ec;
-    bool removed = std::filesystem::remove(path, ec);
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<bool> {
+        std::error_code ec;
+        bool removed = std::filesystem::remove(path, ec);
 
-    if (ec) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("Failed to remove directory: " + path + " - " + ec.message())
-        );
-    }
+        if (ec) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("Failed to remove directory: " + path + " - " + ec.message())
+            );
+        }
 
-    if (!removed) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("Directory does not exist: " + path)
-        );
-    }
+        if (!removed) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("Directory does not exist: " + path)
+            );
+        }
 
-    return bishop::rt::Result<bool>::ok(true);
+        return bishop::rt::Result<bool>::ok(true);
+    });
 }
 
 /**
  * Removes a file or directory and all its contents.
  */
 inline bishop::rt::Result<bool> remove_all(const std::string& path) {
-    std::error_code ec;
-    std::uintmax_t count = std::filesystem::remove_all(path, ec);
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<bool> {
+        std::error_code ec;
+        std::uintmax_t count = std::filesystem::remove_all(path, ec);
 
-    if (ec) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("Failed to remove: " + path + " - " + ec.message())
-        );
-    }
+        if (ec) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("Failed to remove: " + path + " - " + ec.message())
+            );
+        }
 
-    if (count == 0) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("Path does not exist: " + path)
-        );
-    }
+        if (count == 0) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("Path does not exist: " + path)
+            );
+        }
 
-    return bishop::rt::Result<bool>::ok(true);
+        return bishop::rt::Result<bool>::ok(true);
+    });
 }
 
 // ============================================================================
@@ -558,48 +743,54 @@ inline bishop::rt::Result<bool> remove_all(const std::string& path) {
  * Renames or moves a file or directory.
  */
 inline bishop::rt::Result<bool> rename(const std::string& from, const std::string& to) {
-    std::error_code ec;
-    std::filesystem::rename(from, to, ec);
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<bool> {
+        std::error_code ec;
+        std::filesystem::rename(from, to, ec);
 
-    if (ec) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("Failed to rename: " + from + " to " + to + " - " + ec.message())
-        );
-    }
+        if (ec) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("Failed to rename: " + from + " to " + to + " - " + ec.message())
+            );
+        }
 
-    return bishop::rt::Result<bool>::ok(true);
+        return bishop::rt::Result<bool>::ok(true);
+    });
 }
 
 /**
  * Copies a single file.
  */
 inline bishop::rt::Result<bool> copy(const std::string& from, const std::string& to) {
-    std::error_code ec;
-    std::filesystem::copy_file(from, to, std::filesystem::copy_options::overwrite_existing, ec);
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<bool> {
+        std::error_code ec;
+        std::filesystem::copy_file(from, to, std::filesystem::copy_options::overwrite_existing, ec);
 
-    if (ec) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("Failed to copy: " + from + " to " + to + " - " + ec.message())
-        );
-    }
+        if (ec) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("Failed to copy: " + from + " to " + to + " - " + ec.message())
+            );
+        }
 
-    return bishop::rt::Result<bool>::ok(true);
+        return bishop::rt::Result<bool>::ok(true);
+    });
 }
 
 /**
  * Copies a directory and all its contents.
  */
 inline bishop::rt::Result<bool> copy_dir(const std::string& from, const std::string& to) {
-    std::error_code ec;
-    std::filesystem::copy(from, to, std::filesystem::copy_options::recursive, ec);
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<bool> {
+        std::error_code ec;
+        std::filesystem::copy(from, to, std::filesystem::copy_options::recursive, ec);
 
-    if (ec) {
-        return bishop::rt::Result<bool>::error(
-            bishop::rt::Error("Failed to copy directory: " + from + " to " + to + " - " + ec.message())
-        );
-    }
+        if (ec) {
+            return bishop::rt::Result<bool>::error(
+                bishop::rt::Error("Failed to copy directory: " + from + " to " + to + " - " + ec.message())
+            );
+        }
 
-    return bishop::rt::Result<bool>::ok(true);
+        return bishop::rt::Result<bool>::ok(true);
+    });
 }
 
 // ============================================================================
@@ -660,34 +851,38 @@ inline bool is_absolute(const std::string& path) {
  * Converts a path to an absolute path.
  */
 inline bishop::rt::Result<std::string> absolute(const std::string& path) {
-    try {
-        std::filesystem::path abs = std::filesystem::absolute(path);
-        return bishop::rt::Result<std::string>::ok(abs.string());
-    } catch (const std::filesystem::filesystem_error& e) {
-        return bishop::rt::Result<std::string>::error(
-            bishop::rt::Error("Failed to get absolute path: " + path + " - " + std::string(e.what()))
-        );
-    } catch (const std::exception& e) {
-        return bishop::rt::Result<std::string>::error(
-            bishop::rt::Error("Failed to get absolute path: " + path + " - " + std::string(e.what()))
-        );
-    }
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<std::string> {
+        try {
+            std::filesystem::path abs = std::filesystem::absolute(path);
+            return bishop::rt::Result<std::string>::ok(abs.string());
+        } catch (const std::filesystem::filesystem_error& e) {
+            return bishop::rt::Result<std::string>::error(
+                bishop::rt::Error("Failed to get absolute path: " + path + " - " + std::string(e.what()))
+            );
+        } catch (const std::exception& e) {
+            return bishop::rt::Result<std::string>::error(
+                bishop::rt::Error("Failed to get absolute path: " + path + " - " + std::string(e.what()))
+            );
+        }
+    });
 }
 
 /**
  * Returns the canonical (resolved) absolute path.
  */
 inline bishop::rt::Result<std::string> canonical(const std::string& path) {
-    std::error_code ec;
-    std::filesystem::path canon = std::filesystem::canonical(path, ec);
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<std::string> {
+        std::error_code ec;
+        std::filesystem::path canon = std::filesystem::canonical(path, ec);
 
-    if (ec) {
-        return bishop::rt::Result<std::string>::error(
-            bishop::rt::Error("Failed to get canonical path: " + path + " - " + ec.message())
-        );
-    }
+        if (ec) {
+            return bishop::rt::Result<std::string>::error(
+                bishop::rt::Error("Failed to get canonical path: " + path + " - " + ec.message())
+            );
+        }
 
-    return bishop::rt::Result<std::string>::ok(canon.string());
+        return bishop::rt::Result<std::string>::ok(canon.string());
+    });
 }
 
 // ============================================================================
@@ -698,70 +893,74 @@ inline bishop::rt::Result<std::string> canonical(const std::string& path) {
  * Gets file information (stat).
  */
 inline bishop::rt::Result<FileInfo> stat(const std::string& path) {
-    std::error_code ec;
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<FileInfo> {
+        std::error_code ec;
 
-    if (!std::filesystem::exists(path, ec)) {
-        return bishop::rt::Result<FileInfo>::error(
-            bishop::rt::Error("Path does not exist: " + path)
-        );
-    }
+        if (!std::filesystem::exists(path, ec)) {
+            return bishop::rt::Result<FileInfo>::error(
+                bishop::rt::Error("Path does not exist: " + path)
+            );
+        }
 
-    FileInfo info;
-    info.is_file = std::filesystem::is_regular_file(path, ec);
-    info.is_dir = std::filesystem::is_directory(path, ec);
-    info.is_symlink = std::filesystem::is_symlink(path, ec);
+        FileInfo info;
+        info.is_file = std::filesystem::is_regular_file(path, ec);
+        info.is_dir = std::filesystem::is_directory(path, ec);
+        info.is_symlink = std::filesystem::is_symlink(path, ec);
 
-    if (info.is_file) {
-        auto file_size = std::filesystem::file_size(path, ec);
+        if (info.is_file) {
+            auto file_size = std::filesystem::file_size(path, ec);
 
-        if (!ec) {
-            // Check for overflow before casting to int
-            if (file_size > static_cast<std::uintmax_t>(std::numeric_limits<int>::max())) {
-                return bishop::rt::Result<FileInfo>::error(
-                    bishop::rt::Error("File size exceeds maximum int value (> 2GB): " + path)
-                );
+            if (!ec) {
+                // Check for overflow before casting to int
+                if (file_size > static_cast<std::uintmax_t>(std::numeric_limits<int>::max())) {
+                    return bishop::rt::Result<FileInfo>::error(
+                        bishop::rt::Error("File size exceeds maximum int value (> 2GB): " + path)
+                    );
+                }
+
+                info.size = static_cast<int>(file_size);
             }
-
-            info.size = static_cast<int>(file_size);
         }
-    }
 
-    auto ftime = std::filesystem::last_write_time(path, ec);
+        auto ftime = std::filesystem::last_write_time(path, ec);
 
-    if (!ec) {
-        // Convert file_time_type to system_clock-aligned time point
-        auto sctp = std::chrono::time_point_cast<std::chrono::system_clock::duration>(
-            ftime - decltype(ftime)::clock::now() + std::chrono::system_clock::now());
-        auto secs = std::chrono::time_point_cast<std::chrono::seconds>(sctp)
-                        .time_since_epoch()
-                        .count();
-        info.modified = static_cast<int>(secs);
-    }
+        if (!ec) {
+            // Convert file_time_type to system_clock-aligned time point
+            auto sctp = std::chrono::time_point_cast<std::chrono::system_clock::duration>(
+                ftime - decltype(ftime)::clock::now() + std::chrono::system_clock::now());
+            auto secs = std::chrono::time_point_cast<std::chrono::seconds>(sctp)
+                            .time_since_epoch()
+                            .count();
+            info.modified = static_cast<int>(secs);
+        }
 
-    return bishop::rt::Result<FileInfo>::ok(info);
+        return bishop::rt::Result<FileInfo>::ok(info);
+    });
 }
 
 /**
  * Gets the size of a file in bytes.
  */
 inline bishop::rt::Result<int> file_size(const std::string& path) {
-    std::error_code ec;
-    auto size = std::filesystem::file_size(path, ec);
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<int> {
+        std::error_code ec;
+        auto size = std::filesystem::file_size(path, ec);
 
-    if (ec) {
-        return bishop::rt::Result<int>::error(
-            bishop::rt::Error("Failed to get file size: " + path + " - " + ec.message())
-        );
-    }
+        if (ec) {
+            return bishop::rt::Result<int>::error(
+                bishop::rt::Error("Failed to get file size: " + path + " - " + ec.message())
+            );
+        }
 
-    // Check for overflow before casting to int
-    if (size > static_cast<std::uintmax_t>(std::numeric_limits<int>::max())) {
-        return bishop::rt::Result<int>::error(
-            bishop::rt::Error("File size exceeds maximum int value (> 2GB): " + path)
-        );
-    }
+        // Check for overflow before casting to int
+        if (size > static_cast<std::uintmax_t>(std::numeric_limits<int>::max())) {
+            return bishop::rt::Result<int>::error(
+                bishop::rt::Error("File size exceeds maximum int value (> 2GB): " + path)
+            );
+        }
 
-    return bishop::rt::Result<int>::ok(static_cast<int>(size));
+        return bishop::rt::Result<int>::ok(static_cast<int>(size));
+    });
 }
 
 // ============================================================================
@@ -772,41 +971,43 @@ inline bishop::rt::Result<int> file_size(const std::string& path) {
  * Walks a directory tree recursively.
  */
 inline bishop::rt::Result<std::vector<DirEntry>> walk(const std::string& path) {
-    if (!std::filesystem::exists(path)) {
-        return bishop::rt::Result<std::vector<DirEntry>>::error(
-            bishop::rt::Error("Path does not exist: " + path)
-        );
-    }
-
-    std::vector<DirEntry> entries;
-    std::error_code ec;
-    std::filesystem::recursive_directory_iterator it(path, ec);
-
-    if (ec) {
-        return bishop::rt::Result<std::vector<DirEntry>>::error(
-            bishop::rt::Error("Failed to walk directory: " + path + " - " + ec.message())
-        );
-    }
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<std::vector<DirEntry>> {
+        if (!std::filesystem::exists(path)) {
+            return bishop::rt::Result<std::vector<DirEntry>>::error(
+                bishop::rt::Error("Path does not exist: " + path)
+            );
+        }
 
-    std::filesystem::recursive_directory_iterator end;
+        std::vector<DirEntry> entries;
+        std::error_code ec;
+        std::filesystem::recursive_directory_iterator it(path, ec);
 
-    for (; it != end; it.increment(ec)) {
         if (ec) {
             return bishop::rt::Result<std::vector<DirEntry>>::error(
                 bishop::rt::Error("Failed to walk directory: " + path + " - " + ec.message())
             );
         }
 
-        DirEntry de;
-        de.path = it->path().string();
-        de.name = it->path().filename().string();
-        de.is_dir = it->is_directory();
-        de.is_file = it->is_regular_file();
-        de.is_symlink = it->is_symlink();
-        entries.push_back(de);
-    }
+        std::filesystem::recursive_directory_iterator end;
+
+        for (; it != end; it.increment(ec)) {
+            if (ec) {
+                return bishop::rt::Result<std::vector<DirEntry>>::error(
+                    bishop::rt::Error("Failed to walk directory: " + path + " - " + ec.message())
+                );
+            }
+
+            DirEntry de;
+            de.path = it->path().string();
+            de.name = it->path().filename().string();
+            de.is_dir = it->is_directory();
+            de.is_file = it->is_regular_file();
+            de.is_symlink = it->is_symlink();
+            entries.push_back(de);
+        }
 
-    return bishop::rt::Result<std::vector<DirEntry>>::ok(entries);
+        return bishop::rt::Result<std::vector<DirEntry>>::ok(entries);
+    });
 }
 
 // ============================================================================
@@ -818,76 +1019,80 @@ inline bishop::rt::Result<std::vector<DirEntry>> walk(const std::string& path) {
  * The file is created atomically to prevent TOCTOU race conditions.
  */
 inline bishop::rt::Result<std::string> temp_file() {
-    std::filesystem::path temp_dir_path;
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<std::string> {
+        std::filesystem::path temp_dir_path;
 
-    try {
-        temp_dir_path = std::filesystem::temp_directory_path();
-    } catch (const std::filesystem::filesystem_error& e) {
-        return bishop::rt::Result<std::string>::error(
-            bishop::rt::Error("Failed to get temp directory: " + std::string(e.what()))
-        );
-    }
+        try {
+            temp_dir_path = std::filesystem::temp_directory_path();
+        } catch (const std::filesystem::filesystem_error& e) {
+            return bishop::rt::Result<std::string>::error(
+                bishop::rt::Error("Failed to get temp directory: " + std::string(e.what()))
+            );
+        }
 
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(0, 999999999);
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<> dis(0, 999999999);
 
-    for (int i = 0; i < 100; ++i) {
-        std::string name = "bishop_tmp_" + std::to_string(dis(gen));
-        std::filesystem::path temp_path = temp_dir_path / name;
+        for (int i = 0; i < 100; ++i) {
+            std::string name = "bishop_tmp_" + std::to_string(dis(gen));
+            std::filesystem::path temp_path = temp_dir_path / name;
 
-        // Create the file atomically to prevent TOCTOU race conditions
-        std::ofstream temp_file_stream(
-            temp_path,
-            std::ios::binary | std::ios::trunc | std::ios::out
-        );
+            // Create the file atomically to prevent TOCTOU race conditions
+            std::ofstream temp_file_stream(
+                temp_path,
+                std::ios::binary | std::ios::trunc | std::ios::out
+            );
 
-        if (temp_file_stream) {
-            temp_file_stream.close();
-            return bishop::rt::Result<std::string>::ok(temp_path.string());
+            if (temp_file_stream) {
+                temp_file_stream.close();
+                return bishop::rt::Result<std::string>::ok(temp_path.string());
+            }
         }
-    }
 
-    return bishop::rt::Result<std::string>::error(
-        bishop::rt::Error("Failed to generate unique temp file name")
-    );
+        return bishop::rt::Result<std::string>::error(
+            bishop::rt::Error("Failed to generate unique temp file name")
+        );
+    });
 }
 
 /**
  * Creates a unique temporary directory.
  */
 inline bishop::rt::Result<std::string> temp_dir() {
-    std::filesystem::path temp_base;
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<std::string> {
+        std::filesystem::path temp_base;
 
-    try {
-        temp_base = std::filesystem::temp_directory_path();
-    } catch (const std::filesystem::filesystem_error& e) {
-        return bishop::rt::Result<std::string>::error(
-            bishop::rt::Error("Failed to get temp directory: " + std::string(e.what()))
-        );
-    }
+        try {
+            temp_base = std::filesystem::temp_directory_path();
+        } catch (const std::filesystem::filesystem_error& e) {
+            return bishop::rt::Result<std::string>::error(
+                bishop::rt::Error("Failed to get temp directory: " + std::string(e.what()))
+            );
+        }
 
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(0, 999999999);
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<> dis(0, 999999999);
 
-    for (int i = 0; i < 100; ++i) {
-        std::string name = "bishop_tmpdir_" + std::to_string(dis(gen));
-        std::filesystem::path temp_path = temp_base / name;
+        for (int i = 0; i < 100; ++i) {
+            std::string name = "bishop_tmpdir_" + std::to_string(dis(gen));
+            std::filesystem::path temp_path = temp_base / name;
 
-        if (!std::filesystem::exists(temp_path)) {
-            std::error_code ec;
-            std::filesystem::create_directory(temp_path, ec);
+            if (!std::filesystem::exists(temp_path)) {
+                std::error_code ec;
+                std::filesystem::create_directory(temp_path, ec);
 
-            if (!ec) {
-                return bishop::rt::Result<std::string>::ok(temp_path.string());
+                if (!ec) {
+                    return bishop::rt::Result<std::string>::ok(temp_path.string());
+                }
             }
         }
-    }
 
-    return bishop::rt::Result<std::string>::error(
-        bishop::rt::Error("Failed to create temp directory")
-    );
+        return bishop::rt::Result<std::string>::error(
+            bishop::rt::Error("Failed to create temp directory")
+        );
+    });
 }
 
 }  // namespace fs
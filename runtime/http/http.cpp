@@ -7,11 +7,32 @@
  */
 
 #include <bishop/http.hpp>
+#include <bishop/uring.hpp>
 
 namespace http {
 
 namespace detail {
 
+/**
+ * Reads what has arrived on the socket, through the core's io_uring when
+ * the runtime uses it.
+ */
+static size_t read_some(boost::asio::ip::tcp::socket& socket, char* buffer, size_t len, boost::system::error_code& ec) {
+    if (!bishop::rt::uring::enabled()) {
+        return socket.async_read_some(boost::asio::buffer(buffer, len), boost::fibers::asio::yield[ec]);
+    }
+
+    long n = bishop::rt::uring::recv(socket.native_handle(), buffer, len);
+
+    if (n == 0) {
+        ec = boost::asio::error::eof;
+    } else if (n < 0) {
+        ec = boost::system::error_code(static_cast<int>(-n), boost::system::system_category());
+    }
+
+    return n > 0 ? static_cast<size_t>(n) : 0;
+}
+
 int on_method(llhttp_t* parser, const char* at, size_t len) {
     auto* ctx = static_cast<HttpParserContext*>(parser->data);
     ctx->method.assign(at, len);
@@ -51,7 +72,7 @@ Response not_found() {
 }
 
 std::string format_response(const Response& resp) {
-    std::string status_text;
+    std::string_view status_text;
 
     switch (resp.status) {
         case 200: status_text = "OK"; break;
@@ -60,13 +81,12 @@ std::string format_response(const Response& resp) {
         default: status_text = "Unknown"; break;
     }
 
-    std::string response = "HTTP/1.1 " + std::to_string(resp.status) + " " + status_text + "\r\n";
-    response += "Content-Type: " + resp.content_type + "\r\n";
-    response += "Content-Length: " + std::to_string(resp.body.size()) + "\r\n";
-    response += "Connection: close\r\n";
-    response += "\r\n";
-    response += resp.body;
-    return response;
+    return bishop::rt::interpolate("HTTP/1.1 ", resp.status, " ", status_text, "\r\n",
+                                   "Content-Type: ", resp.content_type, "\r\n",
+                                   "Content-Length: ", resp.body.size(), "\r\n",
+                                   "Connection: close\r\n",
+                                   "\r\n",
+                                   resp.body);
 }
 
 Request read_request(boost::asio::ip::tcp::socket& socket) {
@@ -86,9 +106,7 @@ Request read_request(boost::asio::ip::tcp::socket& socket) {
     boost::system::error_code ec;
 
     // First read - yields fiber until data available
-    size_t n = socket.async_read_some(
-        boost::asio::buffer(buffer),
-        boost::fibers::asio::yield[ec]);
+    size_t n = detail::read_some(socket, buffer, sizeof(buffer), ec);
 
     if (ec) {
         return Request{"GET", "/", ""};
@@ -102,9 +120,7 @@ Request read_request(boost::asio::ip::tcp::socket& socket) {
 
     // Continue reading only if message incomplete (large POST, slow client)
     while (!ctx.message_complete) {
-        n = socket.async_read_some(
-            boost::asio::buffer(buffer),
-            boost::fibers::asio::yield[ec]);
+        n = detail::read_some(socket, buffer, sizeof(buffer), ec);
 
         if (ec) {
             return Request{"GET", "/", ""};
@@ -120,6 +136,37 @@ Request read_request(boost::asio::ip::tcp::socket& socket) {
     return Request{ctx.method, ctx.url, ctx.body};
 }
 
+void write_response(boost::asio::ip::tcp::socket& socket, const Response& resp) {
+    std::string response_str = format_response(resp);
+
+    if (bishop::rt::uring::enabled()) {
+        bishop::rt::uring::send_all(socket.native_handle(), response_str.data(), response_str.size());
+        return;
+    }
+
+    boost::system::error_code ec;
+    boost::asio::write(socket, boost::asio::buffer(response_str), ec);
+}
+
+boost::system::error_code accept_connection(boost::asio::ip::tcp::acceptor& acceptor,
+                                            boost::asio::ip::tcp::socket& socket) {
+    boost::system::error_code ec;
+
+    if (!bishop::rt::uring::enabled()) {
+        acceptor.async_accept(socket, boost::fibers::asio::yield[ec]);
+        return ec;
+    }
+
+    int fd = bishop::rt::uring::accept(acceptor.native_handle());
+
+    if (fd < 0) {
+        return boost::system::error_code(-fd, boost::system::system_category());
+    }
+
+    socket.assign(acceptor.local_endpoint().protocol(), fd, ec);
+    return ec;
+}
+
 void App::get(const std::string& path, std::function<Response(Request)> handler) {
     routes.push_back({"GET", path, handler});
 }
@@ -138,39 +185,32 @@ Response App::route(const Request& req) {
     return not_found();
 }
 
-void App::listen(int port) {
-    boost::asio::ip::tcp::acceptor acceptor(bishop::rt::io_context());
-
+bool open_acceptor(boost::asio::ip::tcp::acceptor& acceptor, int port) {
     try {
         acceptor.open(boost::asio::ip::tcp::v4());
         acceptor.set_option(boost::asio::socket_base::reuse_address(true));
+
+        if (bishop::rt::sharded()) {
+            using reuse_port = boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+            acceptor.set_option(reuse_port(true));
+        }
+
         acceptor.bind({boost::asio::ip::tcp::v4(), static_cast<unsigned short>(port)});
         acceptor.listen();
     } catch (const boost::system::system_error& e) {
         std::cerr << "Error: Failed to bind to port " << port << ": " << e.what() << std::endl;
-        return;
+        return false;
     }
 
-    std::cout << "HTTP server listening on port " << port << std::endl;
-
-    while (true) {
-        boost::system::error_code ec;
-        boost::asio::ip::tcp::socket socket(bishop::rt::io_context());
-
-        // Yield fiber during accept
-        acceptor.async_accept(socket, boost::fibers::asio::yield[ec]);
+    return true;
+}
 
-        if (!ec) {
-            auto self = this;
+void App::listen(int port) {
+    auto self = this;
 
-            // Spawn handler as go routine (fiber)
-            boost::fibers::fiber([self, socket = std::move(socket)]() mutable {
-                handle_connection(std::move(socket), [self](const Request& req) {
-                    return self->route(req);
-                });
-            }).detach();
-        }
-    }
+    serve(port, [self](const Request& req) {
+        return self->route(req);
+    });
 }
 
 }  // namespace http
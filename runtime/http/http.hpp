@@ -116,59 +116,105 @@ std::string format_response(const Response& resp);
  */
 Request read_request(boost::asio::ip::tcp::socket& socket);
 
+/**
+ * Sends a response on a socket (blocking in goroutine context).
+ */
+void write_response(boost::asio::ip::tcp::socket& socket, const Response& resp);
+
+/**
+ * Accepts one connection into socket (blocking in goroutine context).
+ */
+boost::system::error_code accept_connection(boost::asio::ip::tcp::acceptor& acceptor,
+                                            boost::asio::ip::tcp::socket& socket);
+
 /**
  * Handle a single connection with a handler.
  * Template must stay in header.
  */
 template<typename Handler>
 void handle_connection(boost::asio::ip::tcp::socket socket, Handler handler) {
+    // Counted once the fiber runs, since it never changes core after that
+    auto& stats = bishop::rt::core_stats(bishop::rt::core_id());
+    stats.active_connections.fetch_add(1, std::memory_order_relaxed);
+
     try {
         Request req = read_request(socket);
-        Response resp = handler(req);
-
-        std::string response_str = format_response(resp);
-        boost::system::error_code ec;
-        boost::asio::write(socket, boost::asio::buffer(response_str), ec);
+        write_response(socket, handler(req));
     } catch (const std::exception& e) {
         // Connection closed or error
     }
+
+    stats.active_connections.fetch_sub(1, std::memory_order_relaxed);
+}
+
+/**
+ * Opens a listening acceptor for port on the calling core. With the
+ * sharded runtime the port is opened with SO_REUSEPORT so every core can
+ * bind it. Reports the error and returns false if binding fails.
+ */
+bool open_acceptor(boost::asio::ip::tcp::acceptor& acceptor, int port);
+
+/**
+ * Accepts connections forever, serving each in its own fiber on the
+ * calling core.
+ * Template must stay in header.
+ */
+template<typename Handler>
+void accept_loop(boost::asio::ip::tcp::acceptor& acceptor, Handler handler) {
+    auto& stats = bishop::rt::core_stats(bishop::rt::core_id());
+
+    while (true) {
+        boost::asio::ip::tcp::socket socket(bishop::rt::io_context());
+
+        // Yields the fiber until a client connects
+        boost::system::error_code ec = accept_connection(acceptor, socket);
+
+        if (!ec) {
+            stats.accepted.fetch_add(1, std::memory_order_relaxed);
+
+            // Spawn handler as go routine (fiber) on a pooled stack
+            bishop::rt::spawn([socket = std::move(socket), handler]() mutable {
+                handle_connection(std::move(socket), handler);
+            });
+        }
+    }
 }
 
 /**
  * Main serve function - simple single-handler version.
  * Template must stay in header.
- * Runs accept loop in current fiber, spawns handler fibers.
+ * Runs accept loop in current fiber, spawns handler fibers. With the
+ * sharded runtime every other core gets its own listener and accept loop
+ * on the same port, so connections are served by the core that accepted
+ * them; the handler must not share unsynchronized state.
  */
 template<typename Handler>
 void serve(int port, Handler handler) {
     boost::asio::ip::tcp::acceptor acceptor(bishop::rt::io_context());
 
-    try {
-        acceptor.open(boost::asio::ip::tcp::v4());
-        acceptor.set_option(boost::asio::socket_base::reuse_address(true));
-        acceptor.bind({boost::asio::ip::tcp::v4(), static_cast<unsigned short>(port)});
-        acceptor.listen();
-    } catch (const boost::system::system_error& e) {
-        std::cerr << "Error: Failed to bind to port " << port << ": " << e.what() << std::endl;
+    if (!open_acceptor(acceptor, port)) {
         return;
     }
 
     std::cout << "HTTP server listening on port " << port << std::endl;
 
-    while (true) {
-        boost::system::error_code ec;
-        boost::asio::ip::tcp::socket socket(bishop::rt::io_context());
+    if (bishop::rt::sharded()) {
+        for (int core = 0; core < bishop::rt::core_count(); core++) {
+            if (core == bishop::rt::core_id()) {
+                continue;
+            }
 
-        // Yield fiber during accept
-        acceptor.async_accept(socket, boost::fibers::asio::yield[ec]);
+            bishop::rt::spawn_on(core, [port, handler]() {
+                boost::asio::ip::tcp::acceptor core_acceptor(bishop::rt::io_context());
 
-        if (!ec) {
-            // Spawn handler as go routine (fiber)
-            boost::fibers::fiber([socket = std::move(socket), handler]() mutable {
-                handle_connection(std::move(socket), handler);
-            }).detach();
+                if (open_acceptor(core_acceptor, port)) {
+                    accept_loop(core_acceptor, handler);
+                }
+            });
         }
     }
+
+    accept_loop(acceptor, handler);
 }
 
 /**
@@ -193,7 +239,7 @@ struct App {
     Response route(const Request& req);
 
     /**
-     * Start listening on the given port.
+     * Start listening on the given port. Shards across cores like serve().
      */
     void listen(int port);
 };
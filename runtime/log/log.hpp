@@ -169,8 +169,12 @@ inline void log_impl(int level, const std::string& message) {
     // Check if message should be logged to console
     if (level >= state.current_level) {
         std::string formatted = format_message(level, message, state.format_string);
-        std::ostream& out = (level >= WARN) ? std::cerr : std::cout;
-        out << formatted << std::endl;
+
+        if (level >= WARN) {
+            bishop::rt::eprint(formatted);
+        } else {
+            bishop::rt::print(formatted);
+        }
     }
 
     // Write to file outputs
@@ -3,7 +3,10 @@
  * @brief Bishop networking runtime library.
  *
  * Provides TCP, UDP, and DNS functionality for Bishop programs.
- * Uses boost::fibers with Asio integration for async I/O.
+ * Uses boost::fibers with Asio integration for async I/O. When the runtime
+ * runs on io_uring, accept, read and write on TCP go through the core's
+ * ring instead, except on streams with a timeout: their deadlines are
+ * timers on the core's wheel that cancel the pending asio operation.
  *
  * This header is included when programs import the net module.
  */
@@ -11,6 +14,8 @@
 #pragma once
 
 #include <bishop/std.hpp>
+#include <bishop/timer.hpp>
+#include <bishop/uring.hpp>
 #include <boost/fiber/all.hpp>
 #include <boost/asio.hpp>
 #include <bishop/fiber_asio/yield.hpp>
@@ -62,14 +67,33 @@ struct TcpStream {
             );
         }
 
+        if (bishop::rt::uring::enabled() && timeout_ms <= 0) {
+            std::string buffer(n, '\0');
+            long bytes_read = bishop::rt::uring::recv(socket->native_handle(), buffer.data(), buffer.size());
+
+            if (bytes_read < 0) {
+                return bishop::rt::Result<std::string>::error(
+                    bishop::rt::Error("Read failed: " + std::system_category().message(static_cast<int>(-bytes_read)))
+                );
+            }
+
+            buffer.resize(static_cast<size_t>(bytes_read));
+            return bishop::rt::Result<std::string>::ok(std::move(buffer));
+        }
+
         try {
             std::vector<char> buffer(n);
             boost::system::error_code ec;
+            bishop::rt::timer::Deadline deadline(timeout_ms, &TcpStream::cancel_pending, socket.get());
             size_t bytes_read = socket->async_read_some(
                 boost::asio::buffer(buffer),
                 boost::fibers::asio::yield[ec]
             );
 
+            if (timed_out(ec, deadline)) {
+                return bishop::rt::Result<std::string>::error(bishop::rt::Error("Read timed out"));
+            }
+
             if (ec == boost::asio::error::eof) {
                 return bishop::rt::Result<std::string>::ok(std::string());
             }
@@ -101,12 +125,17 @@ struct TcpStream {
         try {
             std::vector<char> buffer(n);
             boost::system::error_code ec;
+            bishop::rt::timer::Deadline deadline(timeout_ms, &TcpStream::cancel_pending, socket.get());
             boost::asio::async_read(
                 *socket,
                 boost::asio::buffer(buffer),
                 boost::fibers::asio::yield[ec]
             );
 
+            if (timed_out(ec, deadline)) {
+                return bishop::rt::Result<std::string>::error(bishop::rt::Error("Read timed out"));
+            }
+
             if (ec) {
                 return bishop::rt::Result<std::string>::error(
                     bishop::rt::Error("Read failed: " + ec.message())
@@ -134,6 +163,7 @@ struct TcpStream {
         try {
             boost::asio::streambuf buffer;
             boost::system::error_code ec;
+            bishop::rt::timer::Deadline deadline(timeout_ms, &TcpStream::cancel_pending, socket.get());
             boost::asio::async_read_until(
                 *socket,
                 buffer,
@@ -141,6 +171,10 @@ struct TcpStream {
                 boost::fibers::asio::yield[ec]
             );
 
+            if (timed_out(ec, deadline)) {
+                return bishop::rt::Result<std::string>::error(bishop::rt::Error("Read timed out"));
+            }
+
             if (ec && ec != boost::asio::error::eof) {
                 return bishop::rt::Result<std::string>::error(
                     bishop::rt::Error("Read failed: " + ec.message())
@@ -174,14 +208,31 @@ struct TcpStream {
             );
         }
 
+        if (bishop::rt::uring::enabled() && timeout_ms <= 0) {
+            long bytes_written = bishop::rt::uring::send_all(socket->native_handle(), data.data(), data.size());
+
+            if (bytes_written < 0) {
+                return bishop::rt::Result<int>::error(
+                    bishop::rt::Error("Write failed: " + std::system_category().message(static_cast<int>(-bytes_written)))
+                );
+            }
+
+            return bishop::rt::Result<int>::ok(static_cast<int>(bytes_written));
+        }
+
         try {
             boost::system::error_code ec;
+            bishop::rt::timer::Deadline deadline(timeout_ms, &TcpStream::cancel_pending, socket.get());
             size_t bytes_written = boost::asio::async_write(
                 *socket,
                 boost::asio::buffer(data),
                 boost::fibers::asio::yield[ec]
             );
 
+            if (timed_out(ec, deadline)) {
+                return bishop::rt::Result<int>::error(bishop::rt::Error("Write timed out"));
+            }
+
             if (ec) {
                 return bishop::rt::Result<int>::error(
                     bishop::rt::Error("Write failed: " + ec.message())
@@ -224,13 +275,27 @@ struct TcpStream {
     }
 
     /**
-     * Sets read/write timeout in milliseconds.
+     * Sets the read/write timeout in milliseconds; zero or less means none.
+     * Each read or write that takes longer fails with a timeout error.
      */
     void set_timeout(int ms) {
         timeout_ms = ms;
-        // Note: Boost.Asio doesn't have built-in socket timeouts.
-        // For full timeout support, we would need to use async_wait with a timer.
-        // This stores the value for potential future use.
+    }
+
+private:
+    /**
+     * Deadline callback: aborts the socket's pending operations.
+     */
+    static void cancel_pending(void* sock) {
+        boost::system::error_code ec;
+        static_cast<boost::asio::ip::tcp::socket*>(sock)->cancel(ec);
+    }
+
+    /**
+     * True if an operation failed because its deadline cancelled it.
+     */
+    static bool timed_out(const boost::system::error_code& ec, const bishop::rt::timer::Deadline& deadline) {
+        return ec == boost::asio::error::operation_aborted && deadline.expired();
     }
 };
 
@@ -257,7 +322,18 @@ struct TcpListener {
         try {
             auto socket = std::make_shared<boost::asio::ip::tcp::socket>(bishop::rt::io_context());
             boost::system::error_code ec;
-            acceptor->async_accept(*socket, boost::fibers::asio::yield[ec]);
+
+            if (bishop::rt::uring::enabled()) {
+                int fd = bishop::rt::uring::accept(acceptor->native_handle());
+
+                if (fd < 0) {
+                    ec = boost::system::error_code(-fd, boost::system::system_category());
+                } else {
+                    socket->assign(acceptor->local_endpoint().protocol(), fd, ec);
+                }
+            } else {
+                acceptor->async_accept(*socket, boost::fibers::asio::yield[ec]);
+            }
 
             if (ec) {
                 return bishop::rt::Result<TcpStream>::error(
@@ -265,6 +341,7 @@ struct TcpListener {
                 );
             }
 
+            bishop::rt::core_stats(bishop::rt::core_id()).accepted.fetch_add(1, std::memory_order_relaxed);
             return bishop::rt::Result<TcpStream>::ok(TcpStream(socket));
         } catch (const boost::system::system_error& e) {
             return bishop::rt::Result<TcpStream>::error(
@@ -468,6 +545,8 @@ struct UdpSocket {
 
 /**
  * Creates a TCP listener bound to the specified host and port.
+ * With the sharded runtime the port is opened with SO_REUSEPORT, so each
+ * core can listen on it and the kernel spreads connections across them.
  */
 inline bishop::rt::Result<TcpListener> listen(const std::string& host, int port) {
     try {
@@ -479,6 +558,12 @@ inline bishop::rt::Result<TcpListener> listen(const std::string& host, int port)
 
         acceptor->open(endpoint.protocol());
         acceptor->set_option(boost::asio::socket_base::reuse_address(true));
+
+        if (bishop::rt::sharded()) {
+            using reuse_port = boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+            acceptor->set_option(reuse_port(true));
+        }
+
         acceptor->bind(endpoint);
         acceptor->listen();
 
@@ -52,273 +52,280 @@ struct ProcessOptions {
 /**
  * Executes a command with arguments.
  * Returns a ProcessResult with stdout, stderr, exit_code, and success.
+ * Runs on the blocking pool, so other fibers keep running until the
+ * command exits.
  */
 inline bishop::rt::Result<ProcessResult> run(
     const std::string& cmd,
     const std::vector<std::string>& args
 ) {
-    int stdout_pipe[2];
-    int stderr_pipe[2];
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<ProcessResult> {
+        int stdout_pipe[2];
+        int stderr_pipe[2];
 
-    if (pipe(stdout_pipe) == -1 || pipe(stderr_pipe) == -1) {
-        return std::make_shared<bishop::rt::Error>("Failed to create pipes");
-    }
+        if (pipe(stdout_pipe) == -1 || pipe(stderr_pipe) == -1) {
+            return std::make_shared<bishop::rt::Error>("Failed to create pipes");
+        }
 
-    pid_t pid = fork();
+        pid_t pid = fork();
 
-    if (pid == -1) {
-        close(stdout_pipe[0]);
-        close(stdout_pipe[1]);
-        close(stderr_pipe[0]);
-        close(stderr_pipe[1]);
-        return std::make_shared<bishop::rt::Error>("Failed to fork process");
-    }
+        if (pid == -1) {
+            close(stdout_pipe[0]);
+            close(stdout_pipe[1]);
+            close(stderr_pipe[0]);
+            close(stderr_pipe[1]);
+            return std::make_shared<bishop::rt::Error>("Failed to fork process");
+        }
 
-    if (pid == 0) {
-        // Child process
-        close(stdout_pipe[0]);
-        close(stderr_pipe[0]);
+        if (pid == 0) {
+            // Child process
+            close(stdout_pipe[0]);
+            close(stderr_pipe[0]);
 
-        dup2(stdout_pipe[1], STDOUT_FILENO);
-        dup2(stderr_pipe[1], STDERR_FILENO);
+            dup2(stdout_pipe[1], STDOUT_FILENO);
+            dup2(stderr_pipe[1], STDERR_FILENO);
 
-        close(stdout_pipe[1]);
-        close(stderr_pipe[1]);
+            close(stdout_pipe[1]);
+            close(stderr_pipe[1]);
 
-        // Build argv array
-        std::vector<char*> argv;
-        argv.push_back(const_cast<char*>(cmd.c_str()));
+            // Build argv array
+            std::vector<char*> argv;
+            argv.push_back(const_cast<char*>(cmd.c_str()));
 
-        for (const auto& arg : args) {
-            argv.push_back(const_cast<char*>(arg.c_str()));
-        }
+            for (const auto& arg : args) {
+                argv.push_back(const_cast<char*>(arg.c_str()));
+            }
 
-        argv.push_back(nullptr);
+            argv.push_back(nullptr);
 
-        execvp(cmd.c_str(), argv.data());
-        _exit(127);
-    }
+            execvp(cmd.c_str(), argv.data());
+            _exit(127);
+        }
 
-    // Parent process
-    close(stdout_pipe[1]);
-    close(stderr_pipe[1]);
+        // Parent process
+        close(stdout_pipe[1]);
+        close(stderr_pipe[1]);
 
-    // Read stdout
-    std::string stdout_output;
-    char buffer[4096];
-    ssize_t bytes_read;
+        // Read stdout
+        std::string stdout_output;
+        char buffer[4096];
+        ssize_t bytes_read;
 
-    while ((bytes_read = read(stdout_pipe[0], buffer, sizeof(buffer))) > 0) {
-        stdout_output.append(buffer, bytes_read);
-    }
+        while ((bytes_read = read(stdout_pipe[0], buffer, sizeof(buffer))) > 0) {
+            stdout_output.append(buffer, bytes_read);
+        }
 
-    close(stdout_pipe[0]);
+        close(stdout_pipe[0]);
 
-    // Read stderr
-    std::string stderr_output;
+        // Read stderr
+        std::string stderr_output;
 
-    while ((bytes_read = read(stderr_pipe[0], buffer, sizeof(buffer))) > 0) {
-        stderr_output.append(buffer, bytes_read);
-    }
+        while ((bytes_read = read(stderr_pipe[0], buffer, sizeof(buffer))) > 0) {
+            stderr_output.append(buffer, bytes_read);
+        }
 
-    close(stderr_pipe[0]);
+        close(stderr_pipe[0]);
 
-    // Wait for child
-    int status;
-    waitpid(pid, &status, 0);
+        // Wait for child
+        int status;
+        waitpid(pid, &status, 0);
 
-    ProcessResult result;
-    result.output = stdout_output;
-    result.error = stderr_output;
+        ProcessResult result;
+        result.output = stdout_output;
+        result.error = stderr_output;
 
-    if (WIFEXITED(status)) {
-        result.exit_code = WEXITSTATUS(status);
-    } else {
-        result.exit_code = -1;
-    }
+        if (WIFEXITED(status)) {
+            result.exit_code = WEXITSTATUS(status);
+        } else {
+            result.exit_code = -1;
+        }
 
-    result.success = (result.exit_code == 0);
+        result.success = (result.exit_code == 0);
 
-    return result;
+        return result;
+    });
 }
 
 /**
  * Executes a command with arguments and options.
  * Returns a ProcessResult with stdout, stderr, exit_code, and success.
+ * Runs on the blocking pool, like run().
  */
 inline bishop::rt::Result<ProcessResult> run_with_options(
     const std::string& cmd,
     const std::vector<std::string>& args,
     const ProcessOptions& options
 ) {
-    int stdout_pipe[2];
-    int stderr_pipe[2];
-    int stdin_pipe[2];
+    return bishop::rt::run_blocking([&]() -> bishop::rt::Result<ProcessResult> {
+        int stdout_pipe[2];
+        int stderr_pipe[2];
+        int stdin_pipe[2];
 
-    if (pipe(stdout_pipe) == -1 || pipe(stderr_pipe) == -1) {
-        return std::make_shared<bishop::rt::Error>("Failed to create pipes");
-    }
+        if (pipe(stdout_pipe) == -1 || pipe(stderr_pipe) == -1) {
+            return std::make_shared<bishop::rt::Error>("Failed to create pipes");
+        }
 
-    bool has_stdin = !options.stdin_str.empty();
+        bool has_stdin = !options.stdin_str.empty();
 
-    if (has_stdin && pipe(stdin_pipe) == -1) {
-        close(stdout_pipe[0]);
-        close(stdout_pipe[1]);
-        close(stderr_pipe[0]);
-        close(stderr_pipe[1]);
-        return std::make_shared<bishop::rt::Error>("Failed to create stdin pipe");
-    }
+        if (has_stdin && pipe(stdin_pipe) == -1) {
+            close(stdout_pipe[0]);
+            close(stdout_pipe[1]);
+            close(stderr_pipe[0]);
+            close(stderr_pipe[1]);
+            return std::make_shared<bishop::rt::Error>("Failed to create stdin pipe");
+        }
 
-    pid_t pid = fork();
+        pid_t pid = fork();
 
-    if (pid == -1) {
-        close(stdout_pipe[0]);
-        close(stdout_pipe[1]);
-        close(stderr_pipe[0]);
-        close(stderr_pipe[1]);
+        if (pid == -1) {
+            close(stdout_pipe[0]);
+            close(stdout_pipe[1]);
+            close(stderr_pipe[0]);
+            close(stderr_pipe[1]);
 
-        if (has_stdin) {
-            close(stdin_pipe[0]);
-            close(stdin_pipe[1]);
+            if (has_stdin) {
+                close(stdin_pipe[0]);
+                close(stdin_pipe[1]);
+            }
+
+            return std::make_shared<bishop::rt::Error>("Failed to fork process");
         }
 
-        return std::make_shared<bishop::rt::Error>("Failed to fork process");
-    }
+        if (pid == 0) {
+            // Child process
+            close(stdout_pipe[0]);
+            close(stderr_pipe[0]);
 
-    if (pid == 0) {
-        // Child process
-        close(stdout_pipe[0]);
-        close(stderr_pipe[0]);
+            if (has_stdin) {
+                close(stdin_pipe[1]);
+                dup2(stdin_pipe[0], STDIN_FILENO);
+                close(stdin_pipe[0]);
+            }
 
-        if (has_stdin) {
-            close(stdin_pipe[1]);
-            dup2(stdin_pipe[0], STDIN_FILENO);
-            close(stdin_pipe[0]);
-        }
+            dup2(stdout_pipe[1], STDOUT_FILENO);
+            dup2(stderr_pipe[1], STDERR_FILENO);
 
-        dup2(stdout_pipe[1], STDOUT_FILENO);
-        dup2(stderr_pipe[1], STDERR_FILENO);
+            close(stdout_pipe[1]);
+            close(stderr_pipe[1]);
 
-        close(stdout_pipe[1]);
-        close(stderr_pipe[1]);
+            // Change working directory if specified
+            if (!options.cwd.empty()) {
+                if (chdir(options.cwd.c_str()) == -1) {
+                    _exit(127);
+                }
+            }
 
-        // Change working directory if specified
-        if (!options.cwd.empty()) {
-            if (chdir(options.cwd.c_str()) == -1) {
-                _exit(127);
+            // Set environment variables
+            for (const auto& [key, value] : options.env_vars) {
+                setenv(key.c_str(), value.c_str(), 1);
             }
-        }
 
-        // Set environment variables
-        for (const auto& [key, value] : options.env_vars) {
-            setenv(key.c_str(), value.c_str(), 1);
-        }
+            // Build argv array
+            std::vector<char*> argv;
+            argv.push_back(const_cast<char*>(cmd.c_str()));
 
-        // Build argv array
-        std::vector<char*> argv;
-        argv.push_back(const_cast<char*>(cmd.c_str()));
+            for (const auto& arg : args) {
+                argv.push_back(const_cast<char*>(arg.c_str()));
+            }
 
-        for (const auto& arg : args) {
-            argv.push_back(const_cast<char*>(arg.c_str()));
-        }
+            argv.push_back(nullptr);
 
-        argv.push_back(nullptr);
+            execvp(cmd.c_str(), argv.data());
+            _exit(127);
+        }
 
-        execvp(cmd.c_str(), argv.data());
-        _exit(127);
-    }
+        // Parent process
+        close(stdout_pipe[1]);
+        close(stderr_pipe[1]);
 
-    // Parent process
-    close(stdout_pipe[1]);
-    close(stderr_pipe[1]);
+        if (has_stdin) {
+            close(stdin_pipe[0]);
+            write(stdin_pipe[1], options.stdin_str.c_str(), options.stdin_str.size());
+            close(stdin_pipe[1]);
+        }
 
-    if (has_stdin) {
-        close(stdin_pipe[0]);
-        write(stdin_pipe[1], options.stdin_str.c_str(), options.stdin_str.size());
-        close(stdin_pipe[1]);
-    }
+        // Set up timeout if specified
+        bool timed_out = false;
 
-    // Set up timeout if specified
-    bool timed_out = false;
+        if (options.timeout > 0) {
+            // Set non-blocking mode on pipes
+            fcntl(stdout_pipe[0], F_SETFL, O_NONBLOCK);
+            fcntl(stderr_pipe[0], F_SETFL, O_NONBLOCK);
 
-    if (options.timeout > 0) {
-        // Set non-blocking mode on pipes
-        fcntl(stdout_pipe[0], F_SETFL, O_NONBLOCK);
-        fcntl(stderr_pipe[0], F_SETFL, O_NONBLOCK);
+            auto start_time = std::chrono::steady_clock::now();
+            auto timeout_ms = std::chrono::milliseconds(options.timeout);
 
-        auto start_time = std::chrono::steady_clock::now();
-        auto timeout_ms = std::chrono::milliseconds(options.timeout);
+            // Poll for completion with timeout
+            while (true) {
+                int status;
+                pid_t result = waitpid(pid, &status, WNOHANG);
 
-        // Poll for completion with timeout
-        while (true) {
-            int status;
-            pid_t result = waitpid(pid, &status, WNOHANG);
+                if (result == pid) {
+                    break;
+                }
 
-            if (result == pid) {
-                break;
-            }
+                auto elapsed = std::chrono::steady_clock::now() - start_time;
 
-            auto elapsed = std::chrono::steady_clock::now() - start_time;
+                if (elapsed >= timeout_ms) {
+                    kill(pid, SIGKILL);
+                    waitpid(pid, &status, 0);
+                    timed_out = true;
+                    break;
+                }
 
-            if (elapsed >= timeout_ms) {
-                kill(pid, SIGKILL);
-                waitpid(pid, &status, 0);
-                timed_out = true;
-                break;
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
             }
-
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
         }
-    }
 
-    // Read stdout
-    std::string stdout_output;
-    char buffer[4096];
-    ssize_t bytes_read;
+        // Read stdout
+        std::string stdout_output;
+        char buffer[4096];
+        ssize_t bytes_read;
 
-    // Reset to blocking mode for final read
-    fcntl(stdout_pipe[0], F_SETFL, 0);
+        // Reset to blocking mode for final read
+        fcntl(stdout_pipe[0], F_SETFL, 0);
 
-    while ((bytes_read = read(stdout_pipe[0], buffer, sizeof(buffer))) > 0) {
-        stdout_output.append(buffer, bytes_read);
-    }
+        while ((bytes_read = read(stdout_pipe[0], buffer, sizeof(buffer))) > 0) {
+            stdout_output.append(buffer, bytes_read);
+        }
 
-    close(stdout_pipe[0]);
+        close(stdout_pipe[0]);
 
-    // Read stderr
-    std::string stderr_output;
-    fcntl(stderr_pipe[0], F_SETFL, 0);
+        // Read stderr
+        std::string stderr_output;
+        fcntl(stderr_pipe[0], F_SETFL, 0);
 
-    while ((bytes_read = read(stderr_pipe[0], buffer, sizeof(buffer))) > 0) {
-        stderr_output.append(buffer, bytes_read);
-    }
+        while ((bytes_read = read(stderr_pipe[0], buffer, sizeof(buffer))) > 0) {
+            stderr_output.append(buffer, bytes_read);
+        }
 
-    close(stderr_pipe[0]);
+        close(stderr_pipe[0]);
 
-    // Wait for child if we haven't already
-    int status;
+        // Wait for child if we haven't already
+        int status;
 
-    if (options.timeout <= 0) {
-        waitpid(pid, &status, 0);
-    }
+        if (options.timeout <= 0) {
+            waitpid(pid, &status, 0);
+        }
 
-    if (timed_out) {
-        return std::make_shared<bishop::rt::Error>("Process timed out");
-    }
+        if (timed_out) {
+            return std::make_shared<bishop::rt::Error>("Process timed out");
+        }
 
-    ProcessResult proc_result;
-    proc_result.output = stdout_output;
-    proc_result.error = stderr_output;
+        ProcessResult proc_result;
+        proc_result.output = stdout_output;
+        proc_result.error = stderr_output;
 
-    if (WIFEXITED(status)) {
-        proc_result.exit_code = WEXITSTATUS(status);
-    } else {
-        proc_result.exit_code = -1;
-    }
+        if (WIFEXITED(status)) {
+            proc_result.exit_code = WEXITSTATUS(status);
+        } else {
+            proc_result.exit_code = -1;
+        }
 
-    proc_result.success = (proc_result.exit_code == 0);
+        proc_result.success = (proc_result.exit_code == 0);
 
-    return proc_result;
+        return proc_result;
+    });
 }
 
 /**
@@ -543,7 +550,7 @@ struct Process {
         // Wait for child process if not already done
         if (!state_->waited.exchange(true)) {
             int status;
-            waitpid(state_->pid, &status, 0);
+            bishop::rt::run_blocking([&] { waitpid(state_->pid, &status, 0); });
 
             if (WIFEXITED(status)) {
                 state_->exit_status = WEXITSTATUS(status);
@@ -0,0 +1,111 @@
+/**
+ * @file runtime.hpp
+ * @brief Bishop runtime introspection library.
+ *
+ * Exposes the fiber runtime's counters to Bishop programs, and lets them
+ * move CPU-heavy work off the scheduler threads.
+ * This header is included when programs import the runtime module.
+ */
+
+#pragma once
+
+#include <bishop/std.hpp>
+
+namespace runtime {
+
+/**
+ * Counters of the fiber runtime, for one core or the whole process.
+ * Times are in milliseconds.
+ */
+struct Stats {
+    int64_t live;
+    int64_t spawned;
+    int64_t finished;
+    int64_t ready;
+    int64_t switches;
+    int64_t switches_per_sec;
+    int64_t busy_ms;
+    int64_t idle_ms;
+    int64_t timers;
+    int64_t channel_blocks;
+    int64_t stalls;
+    int64_t stall_ms;
+    int64_t longest_stall_ms;
+    int64_t uptime_ms;
+};
+
+/**
+ * Converts a runtime snapshot to a Stats value.
+ */
+inline Stats to_stats(const bishop::rt::RuntimeStats& s) {
+    constexpr uint64_t NS_PER_MS = 1000000;
+
+    return Stats{
+        static_cast<int64_t>(s.live),
+        static_cast<int64_t>(s.spawned),
+        static_cast<int64_t>(s.finished),
+        static_cast<int64_t>(s.ready),
+        static_cast<int64_t>(s.switches),
+        static_cast<int64_t>(s.switches_per_sec),
+        static_cast<int64_t>(s.busy_ns / NS_PER_MS),
+        static_cast<int64_t>(s.idle_ns / NS_PER_MS),
+        static_cast<int64_t>(s.timers),
+        static_cast<int64_t>(s.channel_blocks),
+        static_cast<int64_t>(s.stalls),
+        static_cast<int64_t>(s.stall_ns / NS_PER_MS),
+        static_cast<int64_t>(s.longest_stall_ns / NS_PER_MS),
+        static_cast<int64_t>(s.uptime_ns / NS_PER_MS),
+    };
+}
+
+/**
+ * Returns the counters summed over every core.
+ */
+inline Stats stats() {
+    return to_stats(bishop::rt::runtime_stats());
+}
+
+/**
+ * Returns the counters of one core.
+ */
+inline Stats core_stats(int core) {
+    return to_stats(bishop::rt::runtime_stats(core));
+}
+
+/**
+ * Returns the number of scheduler threads.
+ */
+inline int core_count() {
+    return bishop::rt::core_count();
+}
+
+/**
+ * Returns the index of the core the caller runs on.
+ */
+inline int core_id() {
+    return bishop::rt::core_id();
+}
+
+/**
+ * Returns true if scheduler metrics are being collected.
+ */
+inline bool metrics_enabled() {
+    return bishop::rt::collect_metrics.load(std::memory_order_relaxed);
+}
+
+/**
+ * Returns every counter as text, as written on SIGUSR1.
+ */
+inline std::string dump() {
+    return bishop::rt::format_runtime_stats();
+}
+
+/**
+ * Runs f on the blocking pool. The caller waits for it to return while
+ * other goroutines keep running.
+ */
+inline void spawn_blocking(const std::function<void()>& f) {
+    bishop::rt::run_blocking(f);
+}
+
+}  // namespace runtime
@@ -4,76 +4,745 @@
  *
  * This header includes boost fiber headers. Only included when
  * the program uses Channel types.
+ *
+ * A channel is a bounded ring buffer guarded by a short lock, plus queues
+ * of fibers parked waiting to send or receive. A blocked fiber registers a
+ * ParkedOp naming its ChannelWaiter and, for a sender, the value it
+ * offers or, for a receiver, where the value should go. The other side
+ * completes a parked operation itself: it claims the waiter, moves the
+ * value straight from sender to receiver (or between the sender and the
+ * buffer), marks the operation done and wakes the fiber, which returns
+ * without looking at the channel again. A channel of capacity 0 has no
+ * buffer, so every value passes this way and a send finishes only once a
+ * receiver has taken it.
+ *
+ * select() registers one waiter on every channel it names, so a fiber
+ * blocked in select costs nothing until one of them is ready. A waiter
+ * can be claimed once, so at most one of its operations completes.
  */
 
 #pragma once
 
+#include <bishop/std.hpp>
+#include <bishop/timer.hpp>
 #include <boost/fiber/all.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <utility>
+#include <vector>
 
 namespace bishop::rt {
 
+namespace detail {
+
+/**
+ * A parked fiber. It is claimed at most once: by the first channel to
+ * complete one of its operations or wake it, or by its own timeout.
+ * Anyone else skips it, so a wakeup is never spent on a fiber that has
+ * already been woken.
+ */
+class ChannelWaiter {
+public:
+    using time_point = std::chrono::steady_clock::time_point;
+
+    /**
+     * Claims the waiter. Returns false if it was already claimed. The
+     * claimer must notify() it, except the fiber claiming its own waiter.
+     */
+    bool claim() {
+        return !fired_.exchange(true, std::memory_order_acq_rel);
+    }
+
+    /**
+     * Wakes the fiber of a claimed waiter.
+     */
+    void notify() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            woken_ = true;
+        }
+
+        cv_.notify_one();
+    }
+
+    /**
+     * Claims the waiter and wakes its fiber. Returns false if it was
+     * already claimed.
+     */
+    bool wake() {
+        if (!claim()) {
+            return false;
+        }
+
+        notify();
+        return true;
+    }
+
+    /**
+     * Parks the calling fiber until woken or until deadline. Returns false
+     * only if the deadline passed and no channel claimed the waiter, in
+     * which case it can no longer be claimed. On a scheduler thread the
+     * deadline is a timer on the thread's wheel.
+     */
+    bool wait_until(time_point deadline) {
+        if (collect_metrics.load(std::memory_order_relaxed)) {
+            count_wait(deadline != time_point::max());
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        if (deadline == time_point::max()) {
+            cv_.wait(lock, [this] { return woken_; });
+            return true;
+        }
+
+        if (timer::enabled()) {
+            auto left = std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+            timer::Timer timeout(&ChannelWaiter::expire, this);
+            timer::arm(timeout, left);
+            cv_.wait(lock, [this] { return woken_ || expired_; });
+            return woken_;
+        }
+
+        if (cv_.wait_until(lock, deadline, [this] { return woken_; })) {
+            return true;
+        }
+
+        return fired_.exchange(true, std::memory_order_acq_rel);
+    }
+
+private:
+    /**
+     * Wheel callback for a timed wait: claims the waiter for its timeout
+     * unless a channel got there first.
+     */
+    static void expire(void* self) {
+        auto* waiter = static_cast<ChannelWaiter*>(self);
+
+        if (!waiter->claim()) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(waiter->mutex_);
+            waiter->expired_ = true;
+        }
+
+        waiter->cv_.notify_one();
+    }
+
+    /**
+     * Counts a parked channel operation, and its timer if it has a deadline.
+     */
+    static void count_wait(bool timed) {
+        CoreStats& stats = core_stats(core_id());
+        stats.channel_blocks.fetch_add(1, std::memory_order_relaxed);
+
+        if (timed) {
+            stats.timers.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<bool> fired_{false};
+    bool woken_ = false;
+    bool expired_ = false;
+    std::mutex mutex_;
+    boost::fibers::condition_variable_any cv_;
+};
+
+/**
+ * A send or receive parked on a channel. Lives with the fiber that waits
+ * for it; the channel only touches it under the channel's lock.
+ */
+template<typename T>
+struct ParkedOp {
+    ChannelWaiter* waiter = nullptr;
+    T* offer = nullptr;                ///< Sender: the value to move out
+    std::optional<T>* slot = nullptr;  ///< Receiver: where to put the value
+    bool done = false;                 ///< Completed by the other side
+};
+
+/**
+ * FIFO of operations parked on one side of a channel.
+ */
+template<typename T>
+class WaitQueue {
+public:
+    void push(ParkedOp<T>* op) { ops_.push_back(op); }
+
+    void remove(ParkedOp<T>* op) {
+        auto it = std::find(ops_.begin(), ops_.end(), op);
+
+        if (it != ops_.end()) {
+            ops_.erase(it);
+        }
+    }
+
+    /**
+     * Takes the first operation whose waiter can still be claimed, and
+     * claims it. Operations of the waiter self (a select that is parking
+     * on both sides of one channel) are left alone.
+     */
+    ParkedOp<T>* claim(const ChannelWaiter* self) {
+        for (auto it = ops_.begin(); it != ops_.end();) {
+            ParkedOp<T>* op = *it;
+
+            if (op->waiter == self) {
+                ++it;
+                continue;
+            }
+
+            it = ops_.erase(it);
+
+            if (op->waiter->claim()) {
+                return op;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void wake_all() {
+        while (!ops_.empty()) {
+            ops_.front()->waiter->wake();
+            ops_.pop_front();
+        }
+    }
+
+private:
+    std::deque<ParkedOp<T>*> ops_;
+};
+
 /**
- * Round up to next power of 2 (min 2 for boost::fibers requirement).
+ * One case of a select: completes the operation if the channel is ready,
+ * otherwise registers the waiter (when given) under the same lock, so no
+ * wakeup can slip in between the check and the registration. cancel()
+ * unregisters it and reports whether the channel completed it meanwhile.
  */
-inline size_t next_power_of_2(size_t n) {
-    if (n < 2) return 2;
-    n--;
-    n |= n >> 1;
-    n |= n >> 2;
-    n |= n >> 4;
-    n |= n >> 8;
-    n |= n >> 16;
-    n |= n >> 32;
-    return n + 1;
+class SelectOp {
+public:
+    virtual ~SelectOp() = default;
+    virtual bool poll(ChannelWaiter* w) = 0;
+    virtual bool cancel(ChannelWaiter* w) = 0;
+};
+
+/**
+ * A producer a channel owns, such as the timer behind time.ticker. The
+ * channel destroys it before anything else, which must stop it.
+ */
+class ChannelFeed {
+public:
+    virtual ~ChannelFeed() = default;
+};
+
+/**
+ * Index of the first case to poll. Rotating it keeps one always-ready
+ * channel from starving the others.
+ */
+inline std::size_t select_start(std::size_t n) {
+    thread_local std::size_t counter = 0;
+    return counter++ % n;
 }
 
+}  // namespace detail
+
 /**
- * Typed channel for communication between fibers.
- * Wraps boost::fibers::buffered_channel with send/recv API.
+ * Typed, bounded channel for communication between fibers. A capacity of
+ * 0 makes an unbuffered channel, where every send waits for a receiver.
+ * Receiving from a closed, drained channel yields T{} (or ends a for
+ * loop over the channel); sending to a closed channel drops the value.
  */
 template<typename T>
 class Channel {
 public:
-    Channel(size_t capacity = 2) : ch_(next_power_of_2(capacity)) {}
+    explicit Channel(std::size_t capacity = 1) : buf_(capacity) {}
 
     /**
-     * Send a value through the channel. Blocks until space available.
+     * Creates a channel with a feed: start is called with the channel once
+     * it is in place, and returns the feed that sends into it.
+     */
+    template<typename Start>
+    Channel(std::size_t capacity, Start&& start) : Channel(capacity) {
+        feed_ = std::forward<Start>(start)(*this);
+    }
+
+    Channel(const Channel&) = delete;
+    Channel& operator=(const Channel&) = delete;
+
+    /**
+     * Send a value through the channel, moving it to the receiver or the
+     * buffer. Blocks until there is room, or a receiver if unbuffered.
+     */
+    void send(T&& value) {
+        detail::ChannelWaiter::time_point forever = detail::ChannelWaiter::time_point::max();
+
+        while (true) {
+            detail::ChannelWaiter waiter;
+            detail::ParkedOp<T> op{&waiter, &value, nullptr};
+
+            if (poll_send(value, &op)) {
+                return;
+            }
+
+            waiter.wait_until(forever);
+
+            if (cancel_send(&op)) {
+                return;
+            }
+        }
+    }
+
+    /**
+     * Send a copy of value.
      */
     void send(const T& value) {
-        ch_.push(value);
+        send(T(value));
+    }
+
+    /**
+     * Send every item in order. Items that fit go to waiting receivers and
+     * the buffer under one lock; the rest are sent one at a time as room
+     * appears. Stops early if the channel is closed.
+     */
+    void send_many(std::vector<T> items) {
+        std::size_t i = 0;
+
+        while (i < items.size()) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                if (closed_) {
+                    return;
+                }
+
+                while (i < items.size() && place_locked(items[i], nullptr)) {
+                    i++;
+                }
+            }
+
+            if (i < items.size()) {
+                send(std::move(items[i]));
+                i++;
+            }
+        }
     }
 
     /**
      * Receive a value from the channel. Blocks until available.
      */
     T recv() {
-        T value;
-        ch_.pop(value);
-        return value;
+        std::optional<T> value = recv_or_closed();
+        return value ? std::move(*value) : T{};
+    }
+
+    /**
+     * Receive a value, or nothing once the channel is closed and drained.
+     */
+    std::optional<T> recv_or_closed() {
+        detail::ChannelWaiter::time_point forever = detail::ChannelWaiter::time_point::max();
+        std::optional<T> value;
+
+        while (true) {
+            detail::ChannelWaiter waiter;
+            detail::ParkedOp<T> op{&waiter, nullptr, &value};
+
+            if (poll_recv(value, &op)) {
+                return value;
+            }
+
+            waiter.wait_until(forever);
+
+            if (cancel_recv(&op)) {
+                return value;
+            }
+        }
+    }
+
+    /**
+     * Receive at least one and at most max values: blocks for the first,
+     * then takes whatever else is ready under the same lock. Returns an
+     * empty list once the channel is closed and drained, or if max < 1.
+     */
+    std::vector<T> recv_many(int max) {
+        std::vector<T> out;
+
+        if (max < 1) {
+            return out;
+        }
+
+        std::optional<T> first = recv_or_closed();
+
+        if (!first) {
+            return out;
+        }
+
+        out.push_back(std::move(*first));
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::optional<T> next;
+
+        while (out.size() < static_cast<std::size_t>(max) && take_locked(next, nullptr)) {
+            out.push_back(std::move(*next));
+            next.reset();
+        }
+
+        return out;
     }
 
     /**
      * Try to receive a value without blocking. Returns pair<bool, T>.
      */
     std::pair<bool, T> try_recv() {
-        T value;
-        auto status = ch_.try_pop(value);
-        if (status == boost::fibers::channel_op_status::success) {
-            return {true, value};
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::optional<T> value;
+
+        if (!take_locked(value, nullptr)) {
+            return {false, T{}};
         }
-        return {false, T{}};
+
+        return {true, std::move(*value)};
     }
 
     /**
-     * Close the channel.
+     * Try to send a value without blocking. Returns false if the channel
+     * is full, or if unbuffered and no receiver is waiting.
+     */
+    bool try_send(T value) {
+        return poll_send(value, nullptr);
+    }
+
+    /**
+     * Close the channel, waking every parked sender and receiver.
      */
     void close() {
-        ch_.close();
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        recv_waiters_.wake_all();
+        send_waiters_.wake_all();
+    }
+
+    /**
+     * Completes a receive if a value is ready or the channel is closed
+     * (leaving out empty); otherwise parks op, if given. A select's
+     * receive completes only if its waiter is still unclaimed.
+     */
+    bool poll_recv(std::optional<T>& out, detail::ParkedOp<T>* op) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        detail::ChannelWaiter* self = op ? op->waiter : nullptr;
+
+        if (take_locked(out, self)) {
+            return true;
+        }
+
+        if (closed_) {
+            return !self || self->claim();
+        }
+
+        if (op) {
+            recv_waiters_.push(op);
+        }
+
+        return false;
     }
 
+    /**
+     * Completes a send if a receiver is waiting or there is room (or drops
+     * the value if the channel is closed); otherwise parks op, if given.
+     */
+    bool poll_send(T& value, detail::ParkedOp<T>* op) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        detail::ChannelWaiter* self = op ? op->waiter : nullptr;
+
+        if (closed_) {
+            return !self || self->claim();
+        }
+
+        if (place_locked(value, self)) {
+            return true;
+        }
+
+        if (op) {
+            send_waiters_.push(op);
+        }
+
+        return false;
+    }
+
+    /**
+     * Unparks op. Returns true if a sender completed it meanwhile.
+     */
+    bool cancel_recv(detail::ParkedOp<T>* op) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        recv_waiters_.remove(op);
+        return op->done;
+    }
+
+    /**
+     * Unparks op. Returns true if a receiver completed it meanwhile.
+     */
+    bool cancel_send(detail::ParkedOp<T>* op) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        send_waiters_.remove(op);
+        return op->done;
+    }
+
+    /**
+     * Input iterator that receives until the channel is closed and
+     * drained, for `for x in ch` loops.
+     */
+    class iterator {
+    public:
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+
+        explicit iterator(Channel* ch) : ch_(ch) { ++*this; }
+
+        T& operator*() { return *value_; }
+
+        iterator& operator++() {
+            value_ = ch_->recv_or_closed();
+
+            if (!value_) {
+                ch_ = nullptr;
+            }
+
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        friend bool operator==(const iterator& it, std::default_sentinel_t) { return it.ch_ == nullptr; }
+
+    private:
+        Channel* ch_;
+        std::optional<T> value_;
+    };
+
+    iterator begin() { return iterator(this); }
+    std::default_sentinel_t end() { return {}; }
+
 private:
-    boost::fibers::buffered_channel<T> ch_;
+    /**
+     * Takes a value under the lock: from the buffer, refilling it from a
+     * parked sender, or straight from a parked sender if there is no
+     * buffer. self, if given, must still be claimable for this to happen.
+     */
+    bool take_locked(std::optional<T>& out, detail::ChannelWaiter* self) {
+        if (count_ > 0) {
+            if (self && !self->claim()) {
+                return false;
+            }
+
+            out.emplace(std::move(buf_[head_]));
+            head_ = (head_ + 1) % buf_.size();
+            count_--;
+
+            if (detail::ParkedOp<T>* sender = send_waiters_.claim(nullptr)) {
+                buf_[(head_ + count_) % buf_.size()] = std::move(*sender->offer);
+                count_++;
+                complete(sender);
+            }
+
+            return true;
+        }
+
+        detail::ParkedOp<T>* sender = send_waiters_.claim(self);
+
+        if (!sender) {
+            return false;
+        }
+
+        if (self && !self->claim()) {
+            sender->waiter->notify();
+            return false;
+        }
+
+        out.emplace(std::move(*sender->offer));
+        complete(sender);
+        return true;
+    }
+
+    /**
+     * Places value under the lock: straight into a parked receiver, or
+     * into the buffer if it has room. self, if given, must still be
+     * claimable for this to happen.
+     */
+    bool place_locked(T& value, detail::ChannelWaiter* self) {
+        if (detail::ParkedOp<T>* receiver = recv_waiters_.claim(self)) {
+            if (self && !self->claim()) {
+                receiver->waiter->notify();
+                return false;
+            }
+
+            receiver->slot->emplace(std::move(value));
+            complete(receiver);
+            return true;
+        }
+
+        if (count_ < buf_.size()) {
+            if (self && !self->claim()) {
+                return false;
+            }
+
+            buf_[(head_ + count_) % buf_.size()] = std::move(value);
+            count_++;
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * Marks a claimed parked operation done and wakes its fiber.
+     */
+    static void complete(detail::ParkedOp<T>* op) {
+        op->done = true;
+        op->waiter->notify();
+    }
+
+    std::mutex mutex_;
+    std::vector<T> buf_;
+    std::size_t head_ = 0;
+    std::size_t count_ = 0;
+    bool closed_ = false;
+    detail::WaitQueue<T> recv_waiters_;
+    detail::WaitQueue<T> send_waiters_;
+    std::unique_ptr<detail::ChannelFeed> feed_;  // Last, so destroyed first
+};
+
+/**
+ * Select case that receives from a channel. take() returns the value once
+ * select() has picked this case, or T{} if the channel was closed.
+ */
+template<typename T>
+class RecvOp : public detail::SelectOp {
+public:
+    explicit RecvOp(Channel<T>& ch) : ch_(ch) { op_.slot = &value_; }
+
+    bool poll(detail::ChannelWaiter* w) override {
+        op_.waiter = w;
+        return ch_.poll_recv(value_, w ? &op_ : nullptr);
+    }
+
+    bool cancel(detail::ChannelWaiter*) override { return ch_.cancel_recv(&op_); }
+
+    T take() { return value_ ? std::move(*value_) : T{}; }
+
+private:
+    Channel<T>& ch_;
+    std::optional<T> value_;
+    detail::ParkedOp<T> op_;
 };
 
+/**
+ * Select case that sends a value, evaluated once when the select starts.
+ */
+template<typename T>
+class SendOp : public detail::SelectOp {
+public:
+    SendOp(Channel<T>& ch, T value) : ch_(ch), value_(std::move(value)) { op_.offer = &value_; }
+
+    bool poll(detail::ChannelWaiter* w) override {
+        op_.waiter = w;
+        return ch_.poll_send(value_, w ? &op_ : nullptr);
+    }
+
+    bool cancel(detail::ChannelWaiter*) override { return ch_.cancel_send(&op_); }
+
+private:
+    Channel<T>& ch_;
+    T value_;
+    detail::ParkedOp<T> op_;
+};
+
+template<typename T>
+RecvOp<T> recv_op(Channel<T>& ch) {
+    return RecvOp<T>(ch);
+}
+
+template<typename T, typename V>
+SendOp<T> send_op(Channel<T>& ch, V&& value) {
+    return SendOp<T>(ch, T(std::forward<V>(value)));
+}
+
+namespace detail {
+
+/**
+ * Shared select loop. Polls every case from a rotating start and, if none
+ * is ready, parks on all of them at once. Returns the index of the case
+ * that completed, or -1 when block is false and nothing was ready, or when
+ * the deadline passed.
+ */
+inline int select_until(std::initializer_list<SelectOp*> ops, bool block, ChannelWaiter::time_point deadline) {
+    const std::size_t n = ops.size();
+    SelectOp* const* op = ops.begin();
+
+    while (true) {
+        ChannelWaiter waiter;
+        ChannelWaiter* w = block ? &waiter : nullptr;
+        std::size_t start = n ? select_start(n) : 0;
+
+        for (std::size_t k = 0; k < n; k++) {
+            std::size_t i = (start + k) % n;
+
+            if (op[i]->poll(w)) {
+                for (std::size_t j = 0; w && j < k; j++) {
+                    op[(start + j) % n]->cancel(w);
+                }
+
+                return static_cast<int>(i);
+            }
+        }
+
+        if (!block) {
+            return -1;
+        }
+
+        bool woken = waiter.wait_until(deadline);
+        int completed = -1;
+
+        // The case another channel completed reports itself as it is unparked
+        for (std::size_t i = 0; i < n; i++) {
+            if (op[i]->cancel(&waiter)) {
+                completed = static_cast<int>(i);
+            }
+        }
+
+        if (completed >= 0 || !woken) {
+            return completed;
+        }
+    }
+}
+
+}  // namespace detail
+
+/**
+ * Blocks until one case completes and returns its index.
+ */
+inline int select(std::initializer_list<detail::SelectOp*> ops) {
+    return detail::select_until(ops, true, detail::ChannelWaiter::time_point::max());
+}
+
+/**
+ * Completes a case that is ready now, or returns -1 (select with default).
+ */
+inline int select_ready(std::initializer_list<detail::SelectOp*> ops) {
+    return detail::select_until(ops, false, detail::ChannelWaiter::time_point::max());
+}
+
+/**
+ * Blocks for at most ms milliseconds; returns -1 on timeout.
+ */
+inline int select_for(std::initializer_list<detail::SelectOp*> ops, long long ms) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(ms);
+    return detail::select_until(ops, true, deadline);
+}
+
 }  // namespace bishop::rt
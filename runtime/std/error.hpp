@@ -4,6 +4,8 @@
  *
  * Provides the base Error type and Result<T> wrapper for fallible functions.
  * All error types inherit from Error and can be checked with dynamic_cast.
+ * Errors with a fixed message are built once per fail site and shared;
+ * only errors with a computed message or a cause are heap-allocated.
  */
 
 #pragma once
@@ -12,6 +14,7 @@
 #include <memory>
 #include <variant>
 #include <optional>
+#include <utility>
 
 namespace bishop::rt {
 
@@ -49,6 +52,37 @@ struct Error {
     virtual ~Error() = default;
 };
 
+/**
+ * Wraps an error with static storage duration in a non-owning shared_ptr.
+ * The pointer has no control block, so copying it through Result values
+ * never allocates or touches an atomic refcount.
+ */
+inline std::shared_ptr<Error> borrow_error(Error& err) {
+    return std::shared_ptr<Error>(std::shared_ptr<Error>(), &err);
+}
+
+/**
+ * Returns the error for a fail site whose message is known at compile time.
+ * Msg is a captureless lambda returning the message. Each call site passes
+ * its own lambda type, so each site builds one error on first use and every
+ * later failure returns it without allocating.
+ */
+template<typename E = Error, typename Msg>
+[[gnu::cold, gnu::noinline]] std::shared_ptr<Error> static_error(Msg msg) {
+    static E err(msg());
+    return borrow_error(err);
+}
+
+/**
+ * Allocates an error whose fields are computed at the fail site. It only
+ * runs when something has failed, so it is kept out of line and in the
+ * cold section, away from the caller's hot path.
+ */
+template<typename E, typename... Args>
+[[gnu::cold, gnu::noinline]] std::shared_ptr<Error> new_error(Args&&... args) {
+    return std::make_shared<E>(std::forward<Args>(args)...);
+}
+
 /**
  * Result type for fallible functions.
  * Holds either a value of type T or an error.
@@ -190,10 +224,10 @@ public:
 };
 
 /**
- * Helper to create error result.
+ * Helper to create error result. Cold for the same reason as new_error().
  */
 template<typename T>
-Result<T> make_error(const std::string& msg) {
+[[gnu::cold, gnu::noinline]] Result<T> make_error(const std::string& msg) {
     return Result<T>(std::make_shared<Error>(msg));
 }
 
@@ -0,0 +1,207 @@
+/**
+ * @file output.hpp
+ * @brief Buffered stdout/stderr output used by print().
+ *
+ * Each thread owns a large output buffer per stream, so print() costs a
+ * memcpy instead of a write(2) per call. Buffers are written out when full,
+ * on flush(), at thread exit, and after every line when the stream is a
+ * terminal. Setting BISHOP_UNBUFFERED=1 writes every line immediately,
+ * which is useful for interactive debugging. With more than one scheduler
+ * worker every line is written immediately too, since worker threads run
+ * until the process exits and would otherwise never flush.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unistd.h>
+
+namespace bishop::rt {
+
+/**
+ * Set by the runtime when fibers run on several threads; forces every
+ * buffer to flush per line.
+ */
+inline std::atomic<bool> flush_every_line{false};
+
+/**
+ * Append-only byte buffer bound to a file descriptor.
+ */
+class OutputBuffer {
+public:
+    static constexpr size_t CAPACITY = 64 * 1024;
+
+    /**
+     * Line-buffered streams flush after every line; others flush when full.
+     */
+    OutputBuffer(int fd, bool line_buffered) : fd_(fd), line_buffered_(line_buffered) {
+        const char* env = std::getenv("BISHOP_UNBUFFERED");
+
+        if (env && env[0] != '\0' && env[0] != '0') {
+            line_buffered_ = true;
+        }
+
+        buf_.reserve(CAPACITY);
+    }
+
+    ~OutputBuffer() { flush(); }
+
+    OutputBuffer(const OutputBuffer&) = delete;
+    OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+    /**
+     * Append bytes, spilling to the descriptor when the buffer is full.
+     * Writes larger than the buffer bypass it entirely.
+     */
+    void write(std::string_view s) {
+        if (buf_.size() + s.size() > CAPACITY) {
+            flush();
+
+            if (s.size() > CAPACITY) {
+                write_all(s.data(), s.size());
+                return;
+            }
+        }
+
+        buf_.append(s);
+    }
+
+    void put(char c) {
+        if (buf_.size() == CAPACITY) {
+            flush();
+        }
+
+        buf_.push_back(c);
+    }
+
+    /**
+     * Terminate the current line and apply the flush policy.
+     */
+    void end_line() {
+        put('\n');
+
+        if (line_buffered_ || flush_every_line.load(std::memory_order_relaxed)) {
+            flush();
+        }
+    }
+
+    /**
+     * Write all buffered bytes to the descriptor.
+     */
+    void flush() {
+        if (buf_.empty()) {
+            return;
+        }
+
+        write_all(buf_.data(), buf_.size());
+        buf_.clear();
+    }
+
+private:
+    void write_all(const char* data, size_t n) {
+        while (n > 0) {
+            ssize_t written = ::write(fd_, data, n);
+
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                return;
+            }
+
+            data += written;
+            n -= static_cast<size_t>(written);
+        }
+    }
+
+    int fd_;
+    bool line_buffered_;
+    std::string buf_;
+};
+
+/**
+ * Per-thread stdout buffer. Line-buffered only when stdout is a terminal.
+ */
+inline OutputBuffer& stdout_buffer() {
+    thread_local OutputBuffer buf(STDOUT_FILENO, isatty(STDOUT_FILENO) != 0);
+    return buf;
+}
+
+/**
+ * Per-thread stderr buffer. Always line-buffered so diagnostics are never lost.
+ */
+inline OutputBuffer& stderr_buffer() {
+    thread_local OutputBuffer buf(STDERR_FILENO, true);
+    return buf;
+}
+
+/**
+ * Format a single value into an output buffer without going through iostreams.
+ * Integers and floats use std::to_chars; floats keep the iostream default of
+ * six significant digits and bools print as 1/0 so output is unchanged.
+ * Anything else falls back to operator<<.
+ */
+template<typename T>
+inline void write_value(OutputBuffer& out, const T& value) {
+    using U = std::decay_t<T>;
+
+    if constexpr (std::is_same_v<U, bool>) {
+        out.put(value ? '1' : '0');
+    } else if constexpr (std::is_same_v<U, char>) {
+        out.put(value);
+    } else if constexpr (std::is_integral_v<U>) {
+        char tmp[24];
+        auto res = std::to_chars(tmp, tmp + sizeof(tmp), value);
+        out.write(std::string_view(tmp, res.ptr - tmp));
+    } else if constexpr (std::is_floating_point_v<U>) {
+        char tmp[48];
+        auto res = std::to_chars(tmp, tmp + sizeof(tmp), value, std::chars_format::general, 6);
+        out.write(std::string_view(tmp, res.ptr - tmp));
+    } else if constexpr (std::is_convertible_v<const U&, std::string_view>) {
+        out.write(std::string_view(value));
+    } else {
+        std::ostringstream ss;
+        ss << value;
+        out.write(ss.str());
+    }
+}
+
+/**
+ * Print values to stdout followed by a newline.
+ */
+template<typename... Args>
+inline void print(const Args&... args) {
+    OutputBuffer& out = stdout_buffer();
+    (write_value(out, args), ...);
+    out.end_line();
+}
+
+/**
+ * Print values to stderr followed by a newline.
+ * Pending stdout is flushed first so interleaved output keeps its order.
+ */
+template<typename... Args>
+inline void eprint(const Args&... args) {
+    stdout_buffer().flush();
+    OutputBuffer& out = stderr_buffer();
+    (write_value(out, args), ...);
+    out.end_line();
+}
+
+/**
+ * Flush this thread's stdout and stderr buffers.
+ */
+inline void flush() {
+    stdout_buffer().flush();
+    stderr_buffer().flush();
+}
+
+}  // namespace bishop::rt
@@ -14,48 +14,928 @@
 #include <boost/asio/spawn.hpp>
 
 #include <bishop/fiber_asio/round_robin.hpp>
+#include <bishop/fiber_asio/work_stealing.hpp>
+#include <bishop/std.hpp>
+#include <bishop/timer.hpp>
+#include <bishop/uring.hpp>
 
+#include <cerrno>
+#include <charconv>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
 #include <functional>
+#include <string_view>
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <chrono>
+#include <thread>
+#include <vector>
+
+#include <execinfo.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 namespace bishop::rt {
 
-// Global io_context - initialized by run()
-static std::shared_ptr<boost::asio::io_context> g_io_ctx;
+/**
+ * One scheduler thread: the io_context other threads post to, and its
+ * counters. Cores are never freed, because other threads may still post
+ * to them while the process exits.
+ */
+struct Core {
+    std::shared_ptr<boost::asio::io_context> io_ctx = std::make_shared<boost::asio::io_context>();
+    CoreStats stats;
+    boost::fibers::asio::scheduler_metrics scheduler;
+    pthread_t thread{};                              ///< Set before the scheduler starts
+    std::atomic<std::int64_t> stall_reported{0};     ///< running_since of the last run reported as stalled
+};
+
+// Scheduler threads, fixed by init_runtime()
+static Core* g_cores = nullptr;
+static int g_workers = 1;
+static bool g_sharded = false;
+static bool g_io_uring = false;
+static std::chrono::steady_clock::time_point g_started;
+static int g_blocking_threads = 4;
+static std::chrono::milliseconds g_stall_after{0};
+
+// Where each spawned fiber was spawned, set only while the stall detector
+// runs. The site strings are static, so there is nothing to clean up. Never
+// freed: destroying it at exit would touch the exiting fiber
+static auto* g_spawn_site = new boost::fibers::fiber_specific_ptr<char>([](char*) {});
+
+// Index of the calling thread's core
+static thread_local int t_core = 0;
+
+// Set on blocking pool threads, which run nested blocking calls inline
+static thread_local bool t_blocking = false;
+
+/**
+ * Resolve the worker count: BISHOP_WORKERS overrides the configured value,
+ * and zero or less means one worker per hardware thread.
+ */
+static int resolve_workers(int configured) {
+    const char* env = std::getenv("BISHOP_WORKERS");
+
+    if (env && env[0] != '\0') {
+        configured = std::atoi(env);
+    }
+
+    if (configured <= 0) {
+        configured = static_cast<int>(std::thread::hardware_concurrency());
+    }
+
+    return configured > 0 ? configured : 1;
+}
+
+/**
+ * Resolve the scheduling mode: BISHOP_SCHEDULER=sharded or work_stealing
+ * overrides the configured value.
+ */
+static bool resolve_sharded(bool configured) {
+    const char* env = std::getenv("BISHOP_SCHEDULER");
+
+    if (!env) {
+        return configured;
+    }
+
+    std::string_view mode(env);
+
+    if (mode == "sharded") {
+        return true;
+    }
+
+    if (mode == "work_stealing") {
+        return false;
+    }
+
+    return configured;
+}
+
+/**
+ * Resolve the I/O backend: BISHOP_IO=uring or epoll overrides the
+ * configured value.
+ */
+static bool resolve_io_uring(bool configured) {
+    const char* env = std::getenv("BISHOP_IO");
+
+    if (!env) {
+        return configured;
+    }
+
+    std::string_view backend(env);
+
+    if (backend == "uring") {
+        return true;
+    }
+
+    if (backend == "epoll") {
+        return false;
+    }
+
+    return configured;
+}
+
+/**
+ * Resolve the blocking pool size: BISHOP_BLOCKING_THREADS overrides the
+ * configured value, and zero or less means one thread per hardware thread,
+ * but never fewer than four so a few slow disks cannot hold up the rest.
+ */
+static int resolve_blocking_threads(int configured) {
+    const char* env = std::getenv("BISHOP_BLOCKING_THREADS");
+
+    if (env && env[0] != '\0') {
+        configured = std::atoi(env);
+    }
+
+    if (configured <= 0) {
+        configured = std::max(4, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    return configured;
+}
+
+/**
+ * Resolve metrics: BISHOP_METRICS=0 turns them off, any other value
+ * turns them on.
+ */
+static bool resolve_metrics(bool configured) {
+    const char* env = std::getenv("BISHOP_METRICS");
+
+    if (!env || env[0] == '\0') {
+        return configured;
+    }
+
+    return std::string_view(env) != "0";
+}
+
+/**
+ * Resolve the stall threshold: BISHOP_STALL_MS overrides the configured
+ * value, and zero or less turns the detector off.
+ */
+static std::chrono::milliseconds resolve_stall_after(int configured) {
+    const char* env = std::getenv("BISHOP_STALL_MS");
+
+    if (env && env[0] != '\0') {
+        configured = std::atoi(env);
+    }
+
+    return std::chrono::milliseconds(std::max(configured, 0));
+}
+
+/**
+ * Parse a stack size such as "65536", "64K" or "1M". Returns 0 if the
+ * text is not a size.
+ */
+static std::size_t parse_size(std::string_view text) {
+    std::size_t value = 0;
+    auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+
+    if (ec != std::errc()) {
+        return 0;
+    }
+
+    std::string_view suffix(end, text.data() + text.size() - end);
+
+    if (suffix.empty()) {
+        return value;
+    }
+
+    if (suffix == "K" || suffix == "k") {
+        return value * 1024;
+    }
+
+    if (suffix == "M" || suffix == "m") {
+        return value * 1024 * 1024;
+    }
+
+    return 0;
+}
+
+/**
+ * Resolve a stack size: a valid size in the environment variable
+ * overrides the configured value.
+ */
+static std::size_t resolve_stack_size(const char* var, std::size_t configured) {
+    const char* env = std::getenv(var);
+    std::size_t size = env ? parse_size(env) : 0;
+    return size ? size : configured;
+}
+
+/**
+ * Resolve guard pages: BISHOP_STACK_GUARD=0 turns them off, any other
+ * value turns them on.
+ */
+static bool resolve_stack_guard(bool configured) {
+    const char* env = std::getenv("BISHOP_STACK_GUARD");
+
+    if (!env || env[0] == '\0') {
+        return configured;
+    }
+
+    return std::string_view(env) != "0";
+}
+
+/**
+ * Pin the calling thread to one CPU. Best effort: failure leaves the
+ * thread unpinned.
+ */
+static void pin_to_cpu(int core) {
+#ifdef __linux__
+    unsigned cpus = std::thread::hardware_concurrency();
+
+    if (cpus == 0) {
+        return;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(static_cast<unsigned>(core) % cpus, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)core;
+#endif
+}
+
+/**
+ * Fiber stacks are mmap'd regions, so pages are only committed once a
+ * fiber touches them. With guard pages on, the lowest page of each region
+ * is PROT_NONE and an overflow faults instead of corrupting a neighbour.
+ *
+ * Stacks of the default size are recycled through a per-thread cache: a
+ * finished fiber's stack goes to the cache of whichever thread frees it,
+ * and since all cached stacks are interchangeable no locking is needed
+ * even when work stealing moves fibers between threads. Stacks of other
+ * sizes (deep stacks, per-spawn overrides) are unmapped when freed.
+ */
+class StackPool {
+public:
+    /// Cached stacks kept per thread; extras are returned to the OS
+    static constexpr std::size_t MAX_CACHED = 1024;
+
+    /// Smallest stack handed out, whatever the configuration asks for
+    static constexpr std::size_t MIN_SIZE = 16 * 1024;
+
+    static void configure(std::size_t default_size, std::size_t deep_size, bool guard) {
+        default_size_ = round_size(default_size);
+        deep_size_ = round_size(deep_size);
+        guard_ = guard;
+    }
+
+    static std::size_t default_size() { return default_size_; }
+    static std::size_t deep_size() { return deep_size_; }
+
+    /**
+     * Stack allocator handed to boost::fibers::fiber. Zero means the
+     * runtime default size.
+     */
+    class Allocator {
+    public:
+        explicit Allocator(std::size_t size = 0) : size_(size == 0 ? default_size_ : round_size(size)) {}
+
+        boost::context::stack_context allocate() {
+            void* base = nullptr;
+
+            if (size_ == default_size_) {
+                auto& cached = cache();
+
+                if (!cached.empty()) {
+                    base = cached.back();
+                    cached.pop_back();
+                }
+            }
+
+            if (!base) {
+                base = map(size_);
+            }
+
+            boost::context::stack_context sctx;
+            sctx.size = size_;
+            sctx.sp = static_cast<char*>(base) + guard_size() + size_;
+            return sctx;
+        }
+
+        void deallocate(boost::context::stack_context& sctx) noexcept {
+            void* base = static_cast<char*>(sctx.sp) - sctx.size - guard_size();
+
+            if (sctx.size == default_size_) {
+                auto& cached = cache();
+
+                if (cached.size() < MAX_CACHED) {
+                    cached.push_back(base);
+                    return;
+                }
+            }
+
+            ::munmap(base, sctx.size + guard_size());
+        }
+
+    private:
+        std::size_t size_;
+    };
+
+private:
+    static inline std::size_t default_size_ = 128 * 1024;
+    static inline std::size_t deep_size_ = 1024 * 1024;
+    static inline bool guard_ = true;
+
+    static std::size_t page_size() {
+        static const std::size_t size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        return size;
+    }
+
+    static std::size_t guard_size() {
+        return guard_ ? page_size() : 0;
+    }
+
+    static std::size_t round_size(std::size_t size) {
+        size = std::max(size, MIN_SIZE);
+        return (size + page_size() - 1) / page_size() * page_size();
+    }
+
+    static void* map(std::size_t size) {
+        std::size_t total = size + guard_size();
+        void* base = ::mmap(nullptr, total, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+        if (base == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+
+        if (guard_) {
+            ::mprotect(base, page_size(), PROT_NONE);
+        }
+
+        return base;
+    }
+
+    // Leaked: fibers may still free stacks after the thread's other
+    // thread_locals are gone, during scheduler teardown at exit
+    static std::vector<void*>& cache() {
+        thread_local std::vector<void*>* cached = new std::vector<void*>();
+        return *cached;
+    }
+};
+
+/**
+ * Install core id's scheduler on the calling thread: a private
+ * round_robin when sharded or single-threaded, work stealing otherwise.
+ * The thread gets its timer wheel, and with io_uring configured its ring;
+ * a thread whose ring cannot be set up stays on epoll.
+ */
+static void install_scheduler(int id) {
+    t_core = id;
+    g_cores[id].thread = pthread_self();
+    timer::init_thread();
+
+    if (g_io_uring) {
+        uring::init_thread();
+    }
+
+    boost::fibers::asio::scheduler_metrics* metrics = nullptr;
+
+    // The stall detector reads the scheduler's switch times, so it needs
+    // the counters even with metrics off
+    if (collect_metrics.load(std::memory_order_relaxed) || g_stall_after.count() > 0) {
+        metrics = &g_cores[id].scheduler;
+        metrics->stall_after = g_stall_after;
+    }
+
+    if (g_sharded || g_workers == 1) {
+        boost::fibers::use_scheduling_algorithm<
+            boost::fibers::asio::round_robin>(g_cores[id].io_ctx, metrics);
+    } else {
+        boost::fibers::use_scheduling_algorithm<
+            boost::fibers::asio::work_stealing>(static_cast<std::uint32_t>(id), g_cores[id].io_ctx, metrics);
+    }
+}
+
+/**
+ * Body of the thread that answers SIGUSR1 by writing the counters to
+ * stderr. Every other thread has the signal blocked, so it is taken here
+ * with sigwait() instead of in a handler, where formatting is unsafe.
+ */
+static void stats_dump_main() {
+    sigset_t set;
+    sigemptyset(&set);
+    sigaddset(&set, SIGUSR1);
+
+    while (true) {
+        int sig = 0;
+
+        if (sigwait(&set, &sig) != 0) {
+            return;
+        }
+
+        std::string text = format_runtime_stats();
+        [[maybe_unused]] auto written = ::write(STDERR_FILENO, text.data(), text.size());
+    }
+}
+
+/**
+ * Route SIGUSR1 to a dump thread. Called before any scheduler thread
+ * starts, so they all inherit the blocked signal.
+ */
+static void start_stats_dump() {
+    sigset_t set;
+    sigemptyset(&set);
+    sigaddset(&set, SIGUSR1);
+    pthread_sigmask(SIG_BLOCK, &set, nullptr);
+    std::thread(stats_dump_main).detach();
+}
+
+/**
+ * Signal the stall watchdog sends to a stalled scheduler thread. It is
+ * ignored by default, so one arriving late or unasked does no harm.
+ */
+constexpr int STALL_SIGNAL = SIGURG;
+
+/**
+ * Writes text to stderr; usable from a signal handler.
+ */
+static void write_stderr(const char* text, std::size_t len) {
+    [[maybe_unused]] auto written = ::write(STDERR_FILENO, text, len);
+}
+
+/**
+ * Runs on a scheduler thread the watchdog found stalled, on the stalled
+ * fiber's own stack: writes where the fiber was spawned and its stack
+ * trace. Nothing is written if the fiber yielded before the signal came.
+ * Only async-signal-safe calls here, and backtrace() once it has been
+ * loaded by start_stall_watchdog().
+ */
+static void report_stall(int) {
+    int saved_errno = errno;
+    Core& core = g_cores[t_core];
+    std::int64_t since = core.scheduler.running_since.load(std::memory_order_relaxed);
+
+    if (since != 0 && since == core.stall_reported.load(std::memory_order_acquire)) {
+        const char* site = g_spawn_site->get();
+
+        if (!site) {
+            site = "the main fiber or the runtime";
+        }
+
+        write_stderr("  spawned at ", 13);
+        write_stderr(site, std::strlen(site));
+        write_stderr("\n", 1);
+
+        void* frames[64];
+        int count = backtrace(frames, 64);
+        backtrace_symbols_fd(frames, count, STDERR_FILENO);
+    }
+
+    errno = saved_errno;
+}
+
+/**
+ * Body of the stall watchdog. It looks at every core a few times per
+ * threshold, and reports each run that goes past it once: it writes
+ * which core and for how long, then signals the core's thread to add the
+ * spawn site and stack. The stall counters are kept by the schedulers.
+ */
+static void stall_watchdog_main() {
+    auto period = std::max<std::chrono::steady_clock::duration>(g_stall_after / 4, std::chrono::milliseconds(1));
+
+    while (true) {
+        std::this_thread::sleep_for(period);
+        std::int64_t now = std::chrono::steady_clock::now().time_since_epoch().count();
+
+        for (int id = 0; id < g_workers; id++) {
+            Core& core = g_cores[id];
+            std::int64_t since = core.scheduler.running_since.load(std::memory_order_relaxed);
+
+            if (since == 0 || since == core.stall_reported.load(std::memory_order_relaxed) ||
+                now - since < core.scheduler.stall_after.count()) {
+                continue;
+            }
+
+            auto ran = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::duration(now - since));
+            char line[128];
+            int len = std::snprintf(line, sizeof(line),
+                                    "bishop: fiber on core %d has run for %lld ms without yielding\n",
+                                    id, static_cast<long long>(ran.count()));
+            write_stderr(line, static_cast<std::size_t>(len));
+
+            core.stall_reported.store(since, std::memory_order_release);
+            pthread_kill(core.thread, STALL_SIGNAL);
+        }
+    }
+}
+
+/**
+ * Install the stall handler and start the watchdog. A core records its
+ * thread before its scheduler stamps the first switch, so the watchdog
+ * never signals a core that has not started.
+ */
+static void start_stall_watchdog() {
+    // The first backtrace() loads the unwinder, which allocates; do it
+    // here rather than in the handler
+    void* frame = nullptr;
+    backtrace(&frame, 1);
+
+    struct sigaction action {};
+    action.sa_handler = report_stall;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(STALL_SIGNAL, &action, nullptr);
+
+    std::thread(stall_watchdog_main).detach();
+}
+
+/**
+ * Body of scheduler threads 1..N-1. The thread's main fiber parks forever
+ * so the scheduler keeps running fibers until the process exits.
+ */
+static void worker_main(int id) {
+    if (g_sharded) {
+        pin_to_cpu(id);
+    }
+
+    install_scheduler(id);
+
+    boost::fibers::mutex mtx;
+    boost::fibers::condition_variable_any parked;
+    std::unique_lock<boost::fibers::mutex> lock(mtx);
+    parked.wait(lock, [] { return false; });
+}
+
+void init_runtime(RuntimeConfig config) {
+    g_workers = resolve_workers(config.workers);
+    g_sharded = resolve_sharded(config.sharded);
+    g_io_uring = resolve_io_uring(config.io_uring);
+    g_cores = new Core[g_workers];
+    g_started = std::chrono::steady_clock::now();
+    g_blocking_threads = resolve_blocking_threads(config.blocking_threads);
+    StackPool::configure(resolve_stack_size("BISHOP_STACK_SIZE", config.stack_size),
+                         resolve_stack_size("BISHOP_DEEP_STACK_SIZE", config.deep_stack_size),
+                         resolve_stack_guard(config.stack_guard));
+
+    if (resolve_metrics(config.metrics)) {
+        collect_metrics.store(true, std::memory_order_relaxed);
+        start_stats_dump();
+    }
+
+    g_stall_after = resolve_stall_after(config.stall_ms);
+
+    if (g_stall_after.count() > 0) {
+        start_stall_watchdog();
+    }
+
+    if (g_workers == 1) {
+        install_scheduler(0);
+        return;
+    }
+
+    // Worker threads never exit, so their output buffers are never
+    // flushed by thread teardown
+    flush_every_line.store(true, std::memory_order_relaxed);
+
+    if (!g_sharded) {
+        boost::fibers::asio::work_stealing::init(static_cast<std::uint32_t>(g_workers));
+    }
+
+    for (int id = 1; id < g_workers; id++) {
+        std::thread(worker_main, id).detach();
+    }
+
+    if (g_sharded) {
+        pin_to_cpu(0);
+    }
 
-void init_runtime() {
-    g_io_ctx = std::make_shared<boost::asio::io_context>();
-    boost::fibers::use_scheduling_algorithm<
-        boost::fibers::asio::round_robin>(g_io_ctx);
+    install_scheduler(0);
 }
 
-void run(std::function<void()> main_fn) {
-    init_runtime();
-    boost::fibers::fiber(main_fn).join();
+void run(std::function<void()> main_fn, RuntimeConfig config) {
+    init_runtime(config);
+    run_in_fiber(std::move(main_fn));
 }
 
 void run_in_fiber(std::function<void()> fn) {
-    boost::fibers::fiber(fn).join();
+    boost::fibers::fiber(std::allocator_arg, StackPool::Allocator(), std::move(fn)).join();
+}
+
+/**
+ * Start a detached fiber on the calling thread with a pooled stack. It is
+ * counted as finished on this core even if work stealing runs it elsewhere.
+ * With the stall detector on, the fiber records site as its spawn site.
+ */
+template<typename Fn>
+static void launch(std::size_t stack_size, const char* site, Fn&& fn) {
+    // Counted first, so a fiber stolen and finished at once is never
+    // finished before it is spawned
+    CoreStats& stats = core_stats(t_core);
+    stats.spawned.fetch_add(1, std::memory_order_relaxed);
+
+    boost::fibers::fiber(std::allocator_arg, StackPool::Allocator(stack_size),
+        [&stats, site, fn = std::forward<Fn>(fn)]() mutable {
+            if (site && g_stall_after.count() > 0) {
+                g_spawn_site->reset(const_cast<char*>(site));
+            }
+
+            struct Finish {
+                CoreStats& stats;
+
+                ~Finish() {
+                    stats.finished.fetch_add(1, std::memory_order_release);
+                }
+            } finish{stats};
+
+            fn();
+        }).detach();
+}
+
+void spawn_raw(void (*entry)(void*), void* arg, std::size_t stack_size, const char* site) {
+    launch(stack_size, site, [entry, arg] { entry(arg); });
+}
+
+std::size_t deep_stack_size() {
+    return StackPool::deep_size();
+}
+
+int core_count() {
+    return g_workers;
+}
+
+int core_id() {
+    return t_core;
+}
+
+bool sharded() {
+    return g_sharded;
+}
+
+CoreStats& core_stats(int core) {
+    static CoreStats detached;
+
+    if (!g_cores || core < 0 || core >= g_workers) {
+        return detached;
+    }
+
+    return g_cores[core].stats;
+}
+
+/**
+ * Snapshot of one core's counters.
+ */
+static RuntimeStats snapshot(const Core& core, std::uint64_t uptime_ns) {
+    RuntimeStats s;
+    s.finished = core.stats.finished.load(std::memory_order_acquire);
+    s.spawned = core.stats.spawned.load(std::memory_order_relaxed);
+    s.live = s.spawned > s.finished ? s.spawned - s.finished : 0;
+    s.timers = core.stats.timers.load(std::memory_order_relaxed);
+    s.channel_blocks = core.stats.channel_blocks.load(std::memory_order_relaxed);
+    s.stalls = core.scheduler.stalls.load(std::memory_order_relaxed);
+    s.stall_ns = core.scheduler.stall_ns.load(std::memory_order_relaxed);
+    s.longest_stall_ns = core.scheduler.longest_stall_ns.load(std::memory_order_relaxed);
+    s.uptime_ns = uptime_ns;
+
+    // The stall detector runs the scheduler counters too, but they are
+    // only reported with metrics on; without them the busy/idle split is unknown
+    if (collect_metrics.load(std::memory_order_relaxed)) {
+        s.ready = core.scheduler.ready.load(std::memory_order_relaxed);
+        s.switches = core.scheduler.switches.load(std::memory_order_relaxed);
+        s.idle_ns = std::min(core.scheduler.idle_now_ns(), uptime_ns);
+        s.busy_ns = uptime_ns - s.idle_ns;
+    }
+
+    if (uptime_ns > 0) {
+        s.switches_per_sec = static_cast<double>(s.switches) * 1e9 / static_cast<double>(uptime_ns);
+    }
+
+    return s;
+}
+
+static std::uint64_t uptime_ns() {
+    if (!g_cores) {
+        return 0;
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - g_started;
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+RuntimeStats runtime_stats(int core) {
+    if (!g_cores || core < 0 || core >= g_workers) {
+        return RuntimeStats{};
+    }
+
+    return snapshot(g_cores[core], uptime_ns());
+}
+
+RuntimeStats runtime_stats() {
+    RuntimeStats total;
+    std::uint64_t uptime = uptime_ns();
+    total.uptime_ns = uptime;
+
+    for (int id = 0; g_cores && id < g_workers; id++) {
+        RuntimeStats s = snapshot(g_cores[id], uptime);
+        total.spawned += s.spawned;
+        total.finished += s.finished;
+        total.ready += s.ready;
+        total.switches += s.switches;
+        total.switches_per_sec += s.switches_per_sec;
+        total.busy_ns += s.busy_ns;
+        total.idle_ns += s.idle_ns;
+        total.timers += s.timers;
+        total.channel_blocks += s.channel_blocks;
+        total.stalls += s.stalls;
+        total.stall_ns += s.stall_ns;
+        total.longest_stall_ns = std::max(total.longest_stall_ns, s.longest_stall_ns);
+    }
+
+    total.live = total.spawned > total.finished ? total.spawned - total.finished : 0;
+    return total;
 }
 
-void spawn(std::function<void()> fn) {
-    boost::fibers::fiber(fn).detach();
+/**
+ * One line of format_runtime_stats().
+ */
+static std::string format_stats_line(const char* label, const RuntimeStats& s) {
+    char line[400];
+    std::snprintf(line, sizeof(line),
+        "%-8s live %llu  spawned %llu  finished %llu  ready %llu  switches %llu (%.0f/s)"
+        "  busy %.3fs  idle %.3fs  timers %llu  channel blocks %llu"
+        "  stalls %llu (%.3fs, longest %.3fs)\n",
+        label,
+        static_cast<unsigned long long>(s.live),
+        static_cast<unsigned long long>(s.spawned),
+        static_cast<unsigned long long>(s.finished),
+        static_cast<unsigned long long>(s.ready),
+        static_cast<unsigned long long>(s.switches),
+        s.switches_per_sec,
+        static_cast<double>(s.busy_ns) / 1e9,
+        static_cast<double>(s.idle_ns) / 1e9,
+        static_cast<unsigned long long>(s.timers),
+        static_cast<unsigned long long>(s.channel_blocks),
+        static_cast<unsigned long long>(s.stalls),
+        static_cast<double>(s.stall_ns) / 1e9,
+        static_cast<double>(s.longest_stall_ns) / 1e9);
+    return line;
+}
+
+std::string format_runtime_stats() {
+    RuntimeStats total = runtime_stats();
+    char header[128];
+    std::snprintf(header, sizeof(header), "bishop runtime: %d core%s, up %.3fs\n",
+                  g_workers, g_workers == 1 ? "" : "s", static_cast<double>(total.uptime_ns) / 1e9);
+
+    std::string out = header;
+    out += format_stats_line("total", total);
+
+    for (int id = 0; g_cores && id < g_workers; id++) {
+        std::string label = "core " + std::to_string(id);
+        out += format_stats_line(label.c_str(), runtime_stats(id));
+    }
+
+    return out;
+}
+
+void spawn_on(int core, std::function<void()> fn) {
+    if (!g_cores || core == t_core) {
+        launch(0, nullptr, std::move(fn));
+        return;
+    }
+
+    Core& target = g_cores[core % g_workers];
+    target.stats.messages.fetch_add(1, std::memory_order_relaxed);
+
+    boost::asio::post(*target.io_ctx, [fn = std::move(fn)]() mutable {
+        launch(0, nullptr, std::move(fn));
+    });
 }
 
 void sleep_ms(int ms) {
-    boost::this_fiber::sleep_for(std::chrono::milliseconds(ms));
+    if (collect_metrics.load(std::memory_order_relaxed)) {
+        core_stats(t_core).timers.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    timer::sleep(std::chrono::milliseconds(ms));
 }
 
 void yield() {
     boost::this_fiber::yield();
 }
 
+/**
+ * A call waiting for or running on the blocking pool. It lives on the
+ * parked fiber's stack, so the pool thread signals completion while still
+ * holding the lock: the fiber cannot return and free it before then.
+ */
+struct BlockingJob {
+    void (*fn)(void*) = nullptr;
+    void* arg = nullptr;
+    std::exception_ptr error;
+    boost::fibers::mutex mtx;
+    boost::fibers::condition_variable finished;
+    bool done = false;
+};
+
+/**
+ * Queue of the blocking pool. Never freed: pool threads wait on it until
+ * the process exits, and a condition variable must not be destroyed
+ * under its waiters.
+ */
+struct BlockingQueue {
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<BlockingJob*> jobs;
+};
+
+// Blocking pool, started on first use by run_blocking_raw()
+static std::once_flag g_blocking_started;
+static BlockingQueue* g_blocking = nullptr;
+
+/**
+ * Body of a blocking pool thread: run queued calls one at a time. Pool
+ * threads never exit, so output a call buffered is flushed after it.
+ */
+static void blocking_main() {
+    t_blocking = true;
+
+    while (true) {
+        BlockingJob* job = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock(g_blocking->mtx);
+            g_blocking->cv.wait(lock, [] { return !g_blocking->jobs.empty(); });
+            job = g_blocking->jobs.front();
+            g_blocking->jobs.pop_front();
+        }
+
+        try {
+            job->fn(job->arg);
+        } catch (...) {
+            job->error = std::current_exception();
+        }
+
+        stdout_buffer().flush();
+        stderr_buffer().flush();
+
+        std::lock_guard<boost::fibers::mutex> lock(job->mtx);
+        job->done = true;
+        job->finished.notify_one();
+    }
+}
+
+/**
+ * Start the blocking pool. Called from a scheduler thread, so the pool
+ * threads inherit its blocked SIGUSR1.
+ */
+static void start_blocking_pool() {
+    g_blocking = new BlockingQueue();
+
+    for (int i = 0; i < g_blocking_threads; i++) {
+        std::thread(blocking_main).detach();
+    }
+}
+
+void run_blocking_raw(void (*fn)(void*), void* arg) {
+    if (!g_cores || t_blocking) {
+        fn(arg);
+        return;
+    }
+
+    std::call_once(g_blocking_started, start_blocking_pool);
+
+    BlockingJob job;
+    job.fn = fn;
+    job.arg = arg;
+
+    {
+        std::lock_guard<std::mutex> lock(g_blocking->mtx);
+        g_blocking->jobs.push_back(&job);
+    }
+
+    g_blocking->cv.notify_one();
+
+    {
+        std::unique_lock<boost::fibers::mutex> lock(job.mtx);
+        job.finished.wait(lock, [&job] { return job.done; });
+    }
+
+    if (job.error) {
+        std::rethrow_exception(job.error);
+    }
+}
+
 boost::asio::io_context& io_context() {
-    if (!g_io_ctx) {
+    if (!g_cores) {
         throw std::runtime_error("Runtime not initialized");
     }
-    return *g_io_ctx;
+    return *g_cores[t_core].io_ctx;
 }
 
 }  // namespace bishop::rt
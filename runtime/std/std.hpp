@@ -11,8 +11,11 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <iostream>
 #include <string>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <functional>
@@ -20,6 +23,7 @@
 #include <vector>
 #include <algorithm>
 #include <map>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <thread>
@@ -33,8 +37,18 @@
 // Error handling primitives
 #include <bishop/error.hpp>
 
+// Buffered print()/flush()
+#include <bishop/output.hpp>
+
+// Single-allocation string concatenation and f-strings
+#include <bishop/strings.hpp>
+
 // Collections
 #include <bishop/priority_queue.hpp>
+#include <bishop/const_map.hpp>
+#include <bishop/flat_map.hpp>
+#include <bishop/tuple.hpp>
+#include <bishop/soa_list.hpp>
 
 namespace bishop::rt {
 
@@ -42,17 +56,101 @@ namespace bishop::rt {
 // Runtime Functions (implemented in runtime.cpp)
 // ============================================================================
 
+/**
+ * Counters for one scheduler thread ("core"). Each core updates only its
+ * own counters; any thread may read them.
+ */
+struct CoreStats {
+    std::atomic<uint64_t> spawned{0};             ///< Fibers started on this core
+    std::atomic<uint64_t> finished{0};            ///< Fibers started on this core that have returned
+    std::atomic<uint64_t> accepted{0};            ///< Connections accepted on this core
+    std::atomic<uint64_t> active_connections{0};  ///< Connections currently being served
+    std::atomic<uint64_t> messages{0};            ///< spawn_on() calls delivered from other cores
+    std::atomic<uint64_t> timers{0};              ///< Sleeps and timed waits started (metrics only)
+    std::atomic<uint64_t> channel_blocks{0};      ///< Channel operations that parked their fiber (metrics only)
+};
+
+/**
+ * Set at startup when metrics are on. Counters marked "metrics only" and
+ * the schedulers' own counters are left alone while it is off, so the
+ * hooks cost one untaken branch.
+ */
+inline std::atomic<bool> collect_metrics{false};
+
+/**
+ * Point-in-time copy of the runtime counters, for one core or summed over
+ * all of them. Scheduler counters stay zero unless metrics are on.
+ */
+struct RuntimeStats {
+    uint64_t live = 0;            ///< Spawned fibers that have not returned yet
+    uint64_t spawned = 0;         ///< Fibers spawned
+    uint64_t finished = 0;        ///< Spawned fibers that have returned
+    uint64_t ready = 0;           ///< Fibers waiting in a ready queue
+    uint64_t switches = 0;        ///< Fibers resumed by the scheduler
+    double switches_per_sec = 0;  ///< Switches averaged over the uptime
+    uint64_t busy_ns = 0;         ///< Time spent running fibers
+    uint64_t idle_ns = 0;         ///< Time spent blocked in the io_context
+    uint64_t timers = 0;          ///< Sleeps and timed waits started
+    uint64_t channel_blocks = 0;  ///< Channel operations that parked their fiber
+    uint64_t stalls = 0;          ///< Fiber runs longer than the stall threshold
+    uint64_t stall_ns = 0;        ///< Total time of those runs
+    uint64_t longest_stall_ns = 0;  ///< Longest of those runs
+    uint64_t uptime_ns = 0;       ///< Time since the runtime started
+};
+
+/**
+ * Runtime settings, from the [runtime] section of bishop.toml. Each has
+ * an environment variable that overrides it at startup.
+ */
+struct RuntimeConfig {
+    /// Scheduler threads; 0 means one per hardware thread (BISHOP_WORKERS).
+    /// With one, fibers run on the calling thread in order; with more,
+    /// spawned fibers are spread across threads by work stealing.
+    int workers = 1;
+
+    /// Pin every thread to a CPU with its own scheduler; fibers never leave
+    /// the thread they were spawned on (BISHOP_SCHEDULER=sharded|work_stealing)
+    bool sharded = false;
+
+    /// Fiber stack size in bytes (BISHOP_STACK_SIZE, e.g. 64K)
+    std::size_t stack_size = 128 * 1024;
+
+    /// Put a fault-on-access guard page below every fiber stack (BISHOP_STACK_GUARD)
+    bool stack_guard = true;
+
+    /// Stack size for deep-recursion spawns (BISHOP_DEEP_STACK_SIZE)
+    std::size_t deep_stack_size = 1024 * 1024;
+
+    /// Submit socket and file I/O and timers through a per-thread io_uring,
+    /// falling back to epoll if the kernel lacks it (BISHOP_IO=uring|epoll)
+    bool io_uring = false;
+
+    /// Count scheduler switches, idle time, channel waits and timers, and
+    /// dump every counter to stderr on SIGUSR1 (BISHOP_METRICS=1|0)
+    bool metrics = false;
+
+    /// Threads that run blocking calls (file system, processes, hashing)
+    /// off the schedulers; 0 means one per hardware thread, at least four
+    /// (BISHOP_BLOCKING_THREADS)
+    int blocking_threads = 0;
+
+    /// Report a fiber that runs this many milliseconds without yielding,
+    /// with its spawn site and stack, and count such runs; 0 turns the
+    /// stall detector off (BISHOP_STALL_MS)
+    int stall_ms = 0;
+};
+
 /**
  * Initialize the fiber-asio scheduler.
  * Called automatically by run(), but can be called manually for tests.
  */
-void init_runtime();
+void init_runtime(RuntimeConfig config = {});
 
 /**
  * Initialize and run the main function in a fiber context.
  * Sets up the fiber-asio scheduler.
  */
-void run(std::function<void()> main_fn);
+void run(std::function<void()> main_fn, RuntimeConfig config = {});
 
 /**
  * Run a function in a fiber and wait for completion.
@@ -61,12 +159,66 @@ void run(std::function<void()> main_fn);
 void run_in_fiber(std::function<void()> fn);
 
 /**
- * Spawn a new fiber (goroutine).
+ * Spawn a fiber that runs entry(arg). Stacks of the default size are
+ * recycled from finished fibers and the fiber's control block lives on its
+ * stack, so this does not touch the heap once the pool is warm. A nonzero
+ * stack_size overrides the default for this fiber. site, a static string
+ * such as "main.b:12", is what the stall detector reports the fiber as.
+ * Use spawn() from generated code.
+ */
+void spawn_raw(void (*entry)(void*), void* arg, std::size_t stack_size = 0, const char* site = nullptr);
+
+/**
+ * Stack size for spawns that need deep recursion (@deep_stack functions).
  */
-void spawn(std::function<void()> fn);
+std::size_t deep_stack_size();
 
 /**
- * Sleep for the specified milliseconds, yielding to other fibers.
+ * Number of scheduler threads.
+ */
+int core_count();
+
+/**
+ * Index of the scheduler thread the caller runs on, from 0.
+ */
+int core_id();
+
+/**
+ * True when the runtime runs one independent scheduler per core.
+ */
+bool sharded();
+
+/**
+ * Counters of the given core.
+ */
+CoreStats& core_stats(int core);
+
+/**
+ * Snapshot of the counters summed over every core.
+ */
+RuntimeStats runtime_stats();
+
+/**
+ * Snapshot of the given core's counters. Fibers are counted as live on
+ * the core that spawned them, wherever they run.
+ */
+RuntimeStats runtime_stats(int core);
+
+/**
+ * The totals and each core's counters as text, one line each; this is
+ * what SIGUSR1 writes to stderr.
+ */
+std::string format_runtime_stats();
+
+/**
+ * Run fn in a new fiber on the given core. This is how sharded cores talk
+ * to each other; Channel<T> is also safe to share between cores.
+ */
+void spawn_on(int core, std::function<void()> fn);
+
+/**
+ * Sleep for the specified milliseconds, yielding to other fibers. On a
+ * scheduler thread the fiber parks on the thread's timer wheel.
  */
 void sleep_ms(int ms);
 
@@ -75,6 +227,218 @@ void sleep_ms(int ms);
  */
 void yield();
 
+/**
+ * Run fn(arg) on the blocking pool, parking the calling fiber until it
+ * returns so the scheduler keeps running other fibers. An exception thrown
+ * by fn is rethrown here. Before the runtime starts, and on a pool thread,
+ * fn runs inline. Use run_blocking() from runtime headers.
+ */
+void run_blocking_raw(void (*fn)(void*), void* arg);
+
+/**
+ * Run fn on the blocking pool and return its result. Use this around
+ * calls that block the thread: file system access, waiting for child
+ * processes, hashing large inputs. fn may capture by reference, since
+ * the caller is parked until it returns.
+ */
+template<typename F>
+std::invoke_result_t<F&> run_blocking(F&& fn) {
+    using R = std::invoke_result_t<F&>;
+
+    if constexpr (std::is_void_v<R>) {
+        auto call = [&fn] { fn(); };
+        run_blocking_raw([](void* p) { (*static_cast<decltype(call)*>(p))(); }, &call);
+    } else {
+        std::optional<R> result;
+        auto call = [&fn, &result] { result.emplace(fn()); };
+        run_blocking_raw([](void* p) { (*static_cast<decltype(call)*>(p))(); }, &call);
+        return std::move(*result);
+    }
+}
+
+// ============================================================================
+// Function References (header-only, no boost dependency)
+// ============================================================================
+
+template<typename Sig>
+class FunctionRef;
+
+/**
+ * Non-owning reference to a callable, used for function parameters that
+ * never outlive the call. Unlike std::function it never allocates and is
+ * two pointers wide, so passing a lambda costs nothing and the call can be
+ * inlined once the caller is. The referenced callable must outlive the ref.
+ */
+template<typename R, typename... Args>
+class FunctionRef<R(Args...)> {
+public:
+    template<typename F>
+        requires (!std::is_same_v<std::remove_cvref_t<F>, FunctionRef>
+                  && std::is_invocable_r_v<R, F&, Args...>)
+    FunctionRef(F&& f) noexcept {
+        using Target = std::remove_reference_t<F>;
+
+        if constexpr (std::is_function_v<Target>) {
+            target_.fn = reinterpret_cast<void (*)()>(&f);
+            call_ = [](Storage s, Args... args) -> R {
+                return std::invoke(reinterpret_cast<Target*>(s.fn), std::forward<Args>(args)...);
+            };
+        } else {
+            target_.obj = const_cast<void*>(static_cast<const void*>(std::addressof(f)));
+            call_ = [](Storage s, Args... args) -> R {
+                return std::invoke(*static_cast<Target*>(s.obj), std::forward<Args>(args)...);
+            };
+        }
+    }
+
+    R operator()(Args... args) const {
+        return call_(target_, std::forward<Args>(args)...);
+    }
+
+private:
+    union Storage {
+        void* obj;
+        void (*fn)();
+    };
+
+    Storage target_;
+    R (*call_)(Storage, Args...);
+};
+
+// ============================================================================
+// Goroutine Spawning (header-only, no boost dependency)
+// ============================================================================
+
+namespace detail {
+
+/**
+ * Per-thread free lists for goroutine task closures, in 64/128/256 byte
+ * size classes. Blocks freed on one thread are simply reused by that
+ * thread, so no locking is needed. Larger closures use operator new.
+ */
+class TaskPool {
+public:
+    static constexpr size_t NUM_CLASSES = 3;
+    static constexpr size_t MAX_FREE = 1024;
+
+    ~TaskPool() {
+        for (auto& list : free_) {
+            for (void* block : list) {
+                ::operator delete(block);
+            }
+        }
+    }
+
+    void* alloc(size_t size) {
+        size_t cls = size_class(size);
+
+        if (cls == NUM_CLASSES) {
+            return ::operator new(size);
+        }
+
+        auto& list = free_[cls];
+
+        if (list.empty()) {
+            return ::operator new(class_size(cls));
+        }
+
+        void* block = list.back();
+        list.pop_back();
+        return block;
+    }
+
+    void free(void* block, size_t size) {
+        size_t cls = size_class(size);
+
+        if (cls == NUM_CLASSES || free_[cls].size() >= MAX_FREE) {
+            ::operator delete(block);
+            return;
+        }
+
+        free_[cls].push_back(block);
+    }
+
+private:
+    static constexpr size_t class_size(size_t cls) { return size_t(64) << cls; }
+
+    static size_t size_class(size_t size) {
+        for (size_t cls = 0; cls < NUM_CLASSES; cls++) {
+            if (size <= class_size(cls)) {
+                return cls;
+            }
+        }
+
+        return NUM_CLASSES;
+    }
+
+    std::vector<void*> free_[NUM_CLASSES];
+};
+
+inline TaskPool& task_pool() {
+    thread_local TaskPool pool;
+    return pool;
+}
+
+/**
+ * Fiber entry point: runs the stored closure, then destroys it and hands
+ * its block back to the pool even if the closure throws.
+ */
+template<typename Fn>
+void run_task(void* p) {
+    Fn* fn = static_cast<Fn*>(p);
+
+    struct Release {
+        Fn* fn;
+
+        ~Release() {
+            fn->~Fn();
+            task_pool().free(fn, sizeof(Fn));
+        }
+    } release{fn};
+
+    (*fn)();
+}
+
+}  // namespace detail
+
+/**
+ * Captures a `go` call argument for the spawned task. Copyable values are
+ * copied so the task never reads a variable that has since changed;
+ * non-copyable lvalues such as channels are captured by reference.
+ */
+template<typename T>
+auto go_capture(T&& value) {
+    using U = std::remove_cvref_t<T>;
+
+    if constexpr (std::is_lvalue_reference_v<T> && !std::is_copy_constructible_v<U>) {
+        return std::ref(value);
+    } else {
+        return U(std::forward<T>(value));
+    }
+}
+
+/**
+ * Spawn a new fiber (goroutine) running fn, on a stack of stack_size bytes
+ * or the runtime default, spawned at site for the stall detector.
+ * The closure is moved into a pooled block instead of a std::function.
+ */
+template<typename F>
+void spawn(F&& fn, std::size_t stack_size = 0, const char* site = nullptr) {
+    using Fn = std::decay_t<F>;
+    static_assert(alignof(Fn) <= alignof(std::max_align_t), "over-aligned goroutine closure");
+
+    void* mem = detail::task_pool().alloc(sizeof(Fn));
+    Fn* task = new (mem) Fn(std::forward<F>(fn));
+
+    try {
+        spawn_raw(&detail::run_task<Fn>, task, stack_size, site);
+    } catch (...) {
+        task->~Fn();
+        detail::task_pool().free(task, sizeof(Fn));
+        throw;
+    }
+}
+
 // ============================================================================
 // Arena Allocator (header-only, no boost dependency)
 // ============================================================================
@@ -152,10 +516,73 @@ T* arena_new(Args&&... args) {
     if (!arena) {
         return new T(std::forward<Args>(args)...);
     }
+
     void* mem = arena->alloc(sizeof(T), alignof(T));
     return new(mem) T(std::forward<Args>(args)...);
 }
 
+/**
+ * Allocator that carves memory out of an Arena and never frees it
+ * individually; everything goes away when the arena does. Codegen binds
+ * each allocator to an explicit arena rather than arena_stack, because a
+ * fiber can yield while another fiber's function is on the same stack.
+ * Without an arena it falls back to the heap.
+ */
+template<typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    ArenaAllocator() noexcept = default;
+    ArenaAllocator(Arena& arena) noexcept : arena_(&arena) {}
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_(other.arena()) {}
+
+    T* allocate(size_t n) {
+        if (!arena_) {
+            return std::allocator<T>().allocate(n);
+        }
+
+        return static_cast<T*>(arena_->alloc(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        if (!arena_) {
+            std::allocator<T>().deallocate(p, n);
+        }
+    }
+
+    Arena* arena() const noexcept { return arena_; }
+
+    template<typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept { return arena_ == other.arena(); }
+
+private:
+    Arena* arena_ = nullptr;
+};
+
+/** List<T> whose storage lives in a function arena. */
+template<typename T>
+using ArenaList = std::vector<T, ArenaAllocator<T>>;
+
+/** Map<K, V> whose slot array lives in a function arena. */
+template<typename K, typename V>
+using ArenaMap = FlatMap<K, V, FlatHash<K>, std::equal_to<K>, ArenaAllocator<std::pair<K, V>>>;
+
+/**
+ * Index a list at a position the compiler proved in bounds.
+ * Builds with --checked (BISHOP_CHECKED) keep the .at() check.
+ */
+template<typename V>
+inline decltype(auto) index_in_bounds(V& v, std::size_t i) {
+#ifdef BISHOP_CHECKED
+    return v.at(i);
+#else
+    return v[i];
+#endif
+}
+
 }  // namespace bishop::rt
 
 // Legacy compatibility - inline wrapper for sleep
@@ -292,7 +719,7 @@ inline auto or_error(const T& value) {
     } else {
         // Falsy types don't have errors, return a synthetic one
         // This should never be called if typechecker is working correctly
-        return std::make_shared<rt::Error>("falsy value");
+        return rt::static_error([] { return "falsy value"; });
     }
 }
 
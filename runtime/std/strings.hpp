@@ -0,0 +1,228 @@
+/**
+ * @file strings.hpp
+ * @brief String building for concatenation chains and f-strings.
+ *
+ * `a + b + c` on std::string allocates a temporary per `+`. Codegen
+ * flattens such chains into one concat() call, which sizes every part,
+ * reserves once and appends. An f-string lowers to interpolate(), which
+ * does the same with values formatted in place. Both reuse the buffer of
+ * a leading temporary string, so `make() + "!"` does not copy.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace bishop::rt {
+
+/**
+ * Parsed form of an f-string format spec: [[fill]align][width][.precision][type].
+ * The type checker validates specs, so the fields are trusted here.
+ */
+struct FormatSpec {
+    char fill = ' ';
+    char align = '\0';  ///< '<', '>' or '^'; '\0' picks right for numbers, left otherwise
+    int width = 0;
+    int precision = -1;
+    char type = '\0';   ///< d x X o b for integers, f e g for floats
+};
+
+/**
+ * A value paired with the format spec it was written with.
+ */
+template<typename T>
+struct Formatted {
+    const T& value;
+    FormatSpec spec;
+};
+
+template<typename T>
+Formatted<T> with_spec(const T& value, FormatSpec spec) {
+    return {value, spec};
+}
+
+namespace detail {
+
+template<typename T>
+struct is_formatted : std::false_type {};
+
+template<typename T>
+struct is_formatted<Formatted<T>> : std::true_type {};
+
+template<typename T>
+inline constexpr bool is_text_v = std::is_convertible_v<const T&, std::string_view> &&
+                                  !std::is_same_v<std::decay_t<T>, char>;
+
+/**
+ * Upper bound on the characters a part adds, used to reserve the result.
+ * Text is exact; numbers assume the common case and may grow the buffer.
+ */
+template<typename T>
+std::size_t size_hint(const T& part) {
+    if constexpr (is_formatted<T>::value) {
+        return std::max<std::size_t>(size_hint(part.value), static_cast<std::size_t>(part.spec.width));
+    } else if constexpr (is_text_v<T>) {
+        return std::string_view(part).size();
+    } else if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, char>) {
+        return 1;
+    } else {
+        return 24;
+    }
+}
+
+/**
+ * Formats a number into buf and returns the written text. Without a spec
+ * this matches print(): integers in decimal, floats with six significant
+ * digits. buf holds any f64 in fixed notation at the checked precision.
+ */
+template<typename T>
+std::string_view format_number(char (&buf)[512], T value, const FormatSpec& spec) {
+    std::to_chars_result res;
+
+    if constexpr (std::is_floating_point_v<T>) {
+        int precision = spec.precision < 0 ? 6 : spec.precision;
+
+        switch (spec.type) {
+            case 'f': res = std::to_chars(buf, buf + sizeof(buf), value, std::chars_format::fixed, precision); break;
+            case 'e': res = std::to_chars(buf, buf + sizeof(buf), value, std::chars_format::scientific, precision); break;
+            default: res = std::to_chars(buf, buf + sizeof(buf), value, std::chars_format::general, precision); break;
+        }
+    } else {
+        int base = 10;
+
+        switch (spec.type) {
+            case 'x': case 'X': base = 16; break;
+            case 'o': base = 8; break;
+            case 'b': base = 2; break;
+            default: break;
+        }
+
+        res = std::to_chars(buf, buf + sizeof(buf), value, base);
+
+        if (spec.type == 'X') {
+            for (char* p = buf; p != res.ptr; p++) {
+                if (*p >= 'a' && *p <= 'f') {
+                    *p = static_cast<char>(*p - 'a' + 'A');
+                }
+            }
+        }
+    }
+
+    return std::string_view(buf, res.ptr - buf);
+}
+
+/**
+ * Appends text padded to spec.width with spec.fill.
+ */
+inline void append_padded(std::string& out, std::string_view text, const FormatSpec& spec, char default_align) {
+    std::size_t width = static_cast<std::size_t>(spec.width);
+
+    if (text.size() >= width) {
+        out.append(text);
+        return;
+    }
+
+    std::size_t pad = width - text.size();
+    char align = spec.align ? spec.align : default_align;
+    std::size_t before = align == '>' ? pad : align == '^' ? pad / 2 : 0;
+
+    out.append(before, spec.fill);
+    out.append(text);
+    out.append(pad - before, spec.fill);
+}
+
+/**
+ * Appends one f-string value. Bools print as 1/0 like print() does.
+ */
+template<typename T>
+void append_value(std::string& out, const T& value, const FormatSpec& spec) {
+    if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, char>) {
+        char c = std::is_same_v<T, bool> ? (value ? '1' : '0') : value;
+        append_padded(out, std::string_view(&c, 1), spec, std::is_same_v<T, bool> ? '>' : '<');
+    } else if constexpr (std::is_arithmetic_v<T>) {
+        char buf[512];
+        append_padded(out, format_number(buf, value, spec), spec, '>');
+    } else if constexpr (is_text_v<T>) {
+        append_padded(out, std::string_view(value), spec, '<');
+    } else {
+        std::ostringstream ss;
+        ss << value;
+        append_padded(out, ss.str(), spec, '<');
+    }
+}
+
+template<typename T>
+void append_part(std::string& out, const T& part) {
+    if constexpr (is_formatted<T>::value) {
+        append_value(out, part.value, part.spec);
+    } else if constexpr (is_text_v<T>) {
+        out.append(std::string_view(part));
+    } else {
+        append_value(out, part, FormatSpec{});
+    }
+}
+
+/**
+ * Starts the result from the first part, taking over its buffer when it is
+ * a temporary std::string.
+ */
+template<typename First>
+std::string start(First&& first) {
+    if constexpr (std::is_same_v<First, std::string>) {
+        return std::move(first);
+    } else {
+        return std::string();
+    }
+}
+
+}  // namespace detail
+
+/**
+ * Concatenates string parts with a single allocation. Lowered from a chain
+ * of `+` on str values.
+ */
+template<typename First, typename... Rest>
+std::string concat(First&& first, const Rest&... rest) {
+    constexpr bool reuse = std::is_same_v<First, std::string>;
+    std::size_t first_size = reuse ? 0 : std::string_view(first).size();
+
+    std::string out = detail::start(std::forward<First>(first));
+    out.reserve(out.size() + first_size + (std::string_view(rest).size() + ... + 0));
+
+    if constexpr (!reuse) {
+        out.append(std::string_view(first));
+    }
+
+    (out.append(std::string_view(rest)), ...);
+    return out;
+}
+
+/**
+ * Builds an f-string from literal text, values and Formatted values,
+ * reserving the estimated length up front. Lowered from f"...".
+ */
+template<typename First, typename... Rest>
+std::string interpolate(First&& first, const Rest&... rest) {
+    using F = std::remove_cvref_t<First>;
+    constexpr bool reuse = std::is_same_v<First, std::string>;
+    std::size_t first_size = reuse ? 0 : detail::size_hint<F>(first);
+
+    std::string out = detail::start(std::forward<First>(first));
+    out.reserve(out.size() + first_size + (detail::size_hint<Rest>(rest) + ... + 0));
+
+    if constexpr (!reuse) {
+        detail::append_part<F>(out, first);
+    }
+
+    (detail::append_part<Rest>(out, rest), ...);
+    return out;
+}
+
+}  // namespace bishop::rt
@@ -0,0 +1,294 @@
+/**
+ * @file timer.cpp
+ * @brief Hierarchical timer wheel for the fiber runtime.
+ *
+ * Four levels of 64 slots each cover 2^24 ticks (about four and a half
+ * hours) at one millisecond per tick. A timer goes into the level of the
+ * highest bit in which its expiry differs from the wheel's current tick,
+ * so level 0 holds the next 64 ticks and each level above holds 64 times
+ * as much at 1/64th the resolution. When the current tick reaches a slot
+ * on a higher level, its timers are cascaded: re-inserted against the new
+ * current tick, which puts them on a lower level. Timers further out than
+ * the wheel reaches are parked in its last slot and cascade until due.
+ *
+ * Each level keeps a bitmap of its occupied slots, so finding the next
+ * due slot is a few bit scans rather than a walk over empty slots.
+ */
+
+#ifndef BOOST_ASIO_SEPARATE_COMPILATION
+#define BOOST_ASIO_SEPARATE_COMPILATION
+#endif
+#include <boost/fiber/all.hpp>
+#include <boost/asio.hpp>
+
+#include <bishop/timer.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+
+namespace bishop::rt {
+
+boost::asio::io_context& io_context();
+
+namespace timer {
+
+namespace {
+
+constexpr unsigned LEVEL_BITS = 6;
+constexpr unsigned SLOTS = 1u << LEVEL_BITS;
+constexpr unsigned LEVELS = 4;
+constexpr std::uint64_t SLOT_MASK = SLOTS - 1;
+constexpr std::uint64_t WHEEL_SPAN = std::uint64_t{1} << (LEVEL_BITS * LEVELS);
+
+/// Delays of at least this many ticks are coarse: rounded up to a
+/// multiple of COARSE_GRANULE, so at most about 6% late
+constexpr std::uint64_t COARSE_TICKS = 1024;
+constexpr std::uint64_t COARSE_GRANULE = 64;
+
+void unlink(Link& node) {
+    node.prev->next = node.next;
+    node.next->prev = node.prev;
+    node.prev = nullptr;
+    node.next = nullptr;
+}
+
+/**
+ * One thread's wheel, and the asio timer that wakes the thread when its
+ * next slot is due.
+ */
+class Wheel {
+public:
+    explicit Wheel(boost::asio::io_context& io_ctx) :
+        origin_(std::chrono::steady_clock::now()),
+        waker_(io_ctx) {
+        for (auto& level : slots_) {
+            for (Link& slot : level) {
+                slot.prev = &slot;
+                slot.next = &slot;
+            }
+        }
+    }
+
+    void arm(Timer& timer, std::chrono::milliseconds delay) {
+        if (timer.armed()) {
+            remove(timer);
+        }
+
+        // Round up, so a timer never fires before its full delay
+        auto due = std::chrono::steady_clock::now() - origin_ + std::max(delay, std::chrono::milliseconds(0));
+        auto tick = std::chrono::ceil<std::chrono::milliseconds>(due).count();
+        std::uint64_t expiry = static_cast<std::uint64_t>(tick);
+
+        if (expiry - current_ >= COARSE_TICKS) {
+            expiry = (expiry + COARSE_GRANULE - 1) & ~(COARSE_GRANULE - 1);
+        }
+
+        timer.expiry = expiry;
+        insert(timer);
+        wake_by(expiry);
+    }
+
+    /**
+     * Unlink timer, clearing its slot's bit if that empties the slot. The
+     * waker is left alone; going off with nothing due costs one wakeup.
+     */
+    void remove(Timer& timer) {
+        Link* before = timer.prev;
+        unlink(timer);
+
+        Link* first = &slots_[0][0];
+        bool is_slot = !std::less<>{}(before, first) && std::less<>{}(before, first + LEVELS * SLOTS);
+
+        if (is_slot && before->next == before) {
+            auto index = static_cast<unsigned>(before - first);
+            occupied_[index / SLOTS] &= ~(std::uint64_t{1} << (index % SLOTS));
+        }
+    }
+
+private:
+    std::chrono::steady_clock::time_point origin_;
+    boost::asio::steady_timer waker_;
+    Link slots_[LEVELS][SLOTS];
+    std::uint64_t occupied_[LEVELS] = {};
+    std::uint64_t current_ = 0;   ///< Every timer due before this tick has fired
+    std::uint64_t wake_at_ = 0;   ///< Tick the waker is set for, if waiting_
+    bool waiting_ = false;
+
+    std::uint64_t now_tick() const {
+        auto elapsed = std::chrono::steady_clock::now() - origin_;
+        return static_cast<std::uint64_t>(std::chrono::floor<std::chrono::milliseconds>(elapsed).count());
+    }
+
+    /**
+     * Link timer into the slot for its expiry. Expiries already past go to
+     * the current slot; ones beyond the wheel's reach go to its last slot.
+     */
+    void insert(Timer& timer) {
+        std::uint64_t limit = current_ | (WHEEL_SPAN - 1);
+        std::uint64_t at = std::clamp(timer.expiry, current_, limit);
+        unsigned level = static_cast<unsigned>(std::bit_width((at ^ current_) | SLOT_MASK) - 1) / LEVEL_BITS;
+        unsigned slot = static_cast<unsigned>((at >> (level * LEVEL_BITS)) & SLOT_MASK);
+
+        Link& head = slots_[level][slot];
+        timer.prev = head.prev;
+        timer.next = &head;
+        head.prev->next = &timer;
+        head.prev = &timer;
+        occupied_[level] |= std::uint64_t{1} << slot;
+    }
+
+    /**
+     * Finds the next slot to visit and the tick it is due at. A slot on a
+     * lower level is always due before any slot above it.
+     */
+    bool next_slot(unsigned& level, unsigned& slot, std::uint64_t& tick) const {
+        for (level = 0; level < LEVELS; level++) {
+            unsigned shift = level * LEVEL_BITS;
+            unsigned here = static_cast<unsigned>((current_ >> shift) & SLOT_MASK);
+            std::uint64_t ahead = occupied_[level] & (~std::uint64_t{0} << here);
+
+            if (ahead == 0) {
+                continue;
+            }
+
+            slot = static_cast<unsigned>(std::countr_zero(ahead));
+            std::uint64_t window = current_ & ~((std::uint64_t{1} << (shift + LEVEL_BITS)) - 1);
+            tick = window + (std::uint64_t{slot} << shift);
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * Fire every timer due by now, cascading higher slots as their ticks
+     * come round, and leave the wheel at now.
+     */
+    void advance(std::uint64_t now) {
+        unsigned level = 0;
+        unsigned slot = 0;
+        std::uint64_t tick = 0;
+
+        while (next_slot(level, slot, tick) && tick <= now) {
+            current_ = std::max(current_, tick);
+            occupied_[level] &= ~(std::uint64_t{1} << slot);
+
+            // Detach the slot first: callbacks may arm timers into it
+            Link& head = slots_[level][slot];
+            Link batch;
+
+            if (head.next == &head) {
+                continue;
+            }
+
+            batch.next = head.next;
+            batch.prev = head.prev;
+            batch.next->prev = &batch;
+            batch.prev->next = &batch;
+            head.prev = &head;
+            head.next = &head;
+
+            while (batch.next != &batch) {
+                auto* timer = static_cast<Timer*>(batch.next);
+                unlink(*timer);
+
+                if (timer->expiry <= current_) {
+                    timer->callback(timer->arg);
+                } else {
+                    insert(*timer);
+                }
+            }
+        }
+
+        current_ = std::max(current_, now);
+    }
+
+    /**
+     * Make sure the waker goes off by tick.
+     */
+    void wake_by(std::uint64_t tick) {
+        if (waiting_ && wake_at_ <= tick) {
+            return;
+        }
+
+        waiting_ = true;
+        wake_at_ = tick;
+        waker_.expires_at(origin_ + std::chrono::milliseconds(tick));
+        waker_.async_wait([this](const boost::system::error_code& ec) {
+            if (ec) {
+                return;
+            }
+
+            waiting_ = false;
+            advance(now_tick());
+
+            unsigned level = 0;
+            unsigned slot = 0;
+            std::uint64_t next = 0;
+
+            if (next_slot(level, slot, next)) {
+                wake_by(next);
+            }
+        });
+    }
+};
+
+// Wheels are never freed: a scheduler thread lives until the process exits
+thread_local Wheel* t_wheel = nullptr;
+
+/**
+ * A fiber parked in sleep().
+ */
+struct Sleeper {
+    boost::fibers::context* waiter = boost::fibers::context::active();
+    bool done = false;
+
+    static void wake(void* arg) {
+        auto* sleeper = static_cast<Sleeper*>(arg);
+        sleeper->done = true;
+        boost::fibers::context::active()->schedule(sleeper->waiter);
+    }
+};
+
+}  // namespace
+
+bool enabled() {
+    return t_wheel != nullptr;
+}
+
+void init_thread() {
+    if (!t_wheel) {
+        t_wheel = new Wheel(io_context());
+    }
+}
+
+void arm(Timer& timer, std::chrono::milliseconds delay) {
+    t_wheel->arm(timer, delay);
+}
+
+void cancel(Timer& timer) {
+    if (timer.armed()) {
+        t_wheel->remove(timer);
+    }
+}
+
+void sleep(std::chrono::milliseconds duration) {
+    if (!t_wheel) {
+        boost::this_fiber::sleep_for(duration);
+        return;
+    }
+
+    Sleeper sleeper;
+    Timer timer(&Sleeper::wake, &sleeper);
+    t_wheel->arm(timer, duration);
+
+    while (!sleeper.done) {
+        sleeper.waiter->suspend();
+    }
+}
+
+}  // namespace timer
+
+}  // namespace bishop::rt
@@ -0,0 +1,125 @@
+/**
+ * @file timer.hpp
+ * @brief Per-core timer wheel for the fiber runtime.
+ *
+ * Every scheduler thread owns a hierarchical timer wheel with millisecond
+ * ticks. Arming and cancelling a timer is O(1): a timer is an intrusive
+ * list node that is linked into a wheel slot, with no allocation and no
+ * ordered queue. The wheel keeps one asio timer armed for its next due
+ * slot, so all the timers a core has due in one tick cost one wakeup, and
+ * timers a second or more away are rounded up to a coarse boundary so
+ * that they land in the same ticks.
+ *
+ * Timers fire on the dispatcher of the thread that armed them, and must be
+ * armed and cancelled on that thread. Fibers never change threads once
+ * started, so a fiber may arm a timer, park, and cancel it after waking.
+ * Callbacks run in the scheduler loop: they may wake fibers, post to the
+ * io_context or re-arm timers, but must not block.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace bishop::rt::timer {
+
+/**
+ * Node of a wheel slot list. Slots keep a sentinel, so a timer unlinks
+ * itself without knowing which list it is on.
+ */
+struct Link {
+    Link* prev = nullptr;
+    Link* next = nullptr;
+};
+
+/**
+ * A pending callback. Lives wherever its owner does, typically on the
+ * stack of the fiber waiting for it; it must stay in place while armed.
+ */
+struct Timer : Link {
+    void (*callback)(void*) = nullptr;
+    void* arg = nullptr;
+    std::uint64_t expiry = 0;  ///< Absolute wheel tick it is due at
+
+    Timer() = default;
+    Timer(void (*cb)(void*), void* a) : callback(cb), arg(a) {}
+
+    Timer(const Timer&) = delete;
+    Timer& operator=(const Timer&) = delete;
+
+    ~Timer();
+
+    bool armed() const { return next != nullptr; }
+};
+
+/**
+ * True if the calling thread has a timer wheel.
+ */
+bool enabled();
+
+/**
+ * Set up the calling scheduler thread's wheel. Called by the runtime
+ * once the thread's io_context is known.
+ */
+void init_thread();
+
+/**
+ * Arm timer to fire after delay, replacing any earlier arming. The
+ * calling thread must have a wheel.
+ */
+void arm(Timer& timer, std::chrono::milliseconds delay);
+
+/**
+ * Disarm timer if it has not fired yet.
+ */
+void cancel(Timer& timer);
+
+/**
+ * Park the calling fiber for duration. Falls back to the fiber
+ * scheduler's own sleep on threads without a wheel.
+ */
+void sleep(std::chrono::milliseconds duration);
+
+inline Timer::~Timer() {
+    if (armed()) {
+        cancel(*this);
+    }
+}
+
+/**
+ * Runs on_expire once if still in scope after ms milliseconds, as a
+ * deadline for an operation that on_expire aborts. No deadline is set if
+ * ms is zero or less, or if the thread has no wheel.
+ */
+class Deadline {
+public:
+    Deadline(int ms, void (*on_expire)(void*), void* arg) :
+        timer_(&Deadline::fire, this), on_expire_(on_expire), arg_(arg) {
+        if (ms > 0 && enabled()) {
+            arm(timer_, std::chrono::milliseconds(ms));
+        }
+    }
+
+    Deadline(const Deadline&) = delete;
+    Deadline& operator=(const Deadline&) = delete;
+
+    /**
+     * True if the deadline passed before the operation finished.
+     */
+    bool expired() const { return expired_; }
+
+private:
+    static void fire(void* self) {
+        auto* deadline = static_cast<Deadline*>(self);
+        deadline->expired_ = true;
+        deadline->on_expire_(deadline->arg_);
+    }
+
+    Timer timer_;
+    void (*on_expire_)(void*);
+    void* arg_;
+    bool expired_ = false;
+};
+
+}  // namespace bishop::rt::timer
@@ -0,0 +1,475 @@
+/**
+ * @file uring.cpp
+ * @brief io_uring backend for the fiber runtime.
+ *
+ * Uses the raw io_uring system calls, so it needs only the kernel headers.
+ * Each scheduler thread owns one ring and is the only thread that touches
+ * it: fibers never change threads once started, so a request is queued,
+ * submitted and reaped on the thread whose fiber waits for it.
+ */
+
+#ifndef BOOST_ASIO_SEPARATE_COMPILATION
+#define BOOST_ASIO_SEPARATE_COMPILATION
+#endif
+#include <boost/fiber/all.hpp>
+#include <boost/asio.hpp>
+
+#include <bishop/uring.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <vector>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace bishop::rt {
+
+boost::asio::io_context& io_context();
+
+namespace uring {
+
+namespace {
+
+/// Submission queue size of each ring; the kernel makes the completion
+/// queue twice as large and keeps overflowing completions (NODROP)
+constexpr unsigned RING_ENTRIES = 256;
+
+/// Opcodes the backend issues; a kernel missing any of them is not used
+constexpr std::uint8_t REQUIRED_OPS[] = {
+    IORING_OP_ACCEPT, IORING_OP_RECV, IORING_OP_SEND, IORING_OP_READ, IORING_OP_WRITE,
+    IORING_OP_OPENAT, IORING_OP_CLOSE, IORING_OP_TIMEOUT, IORING_OP_POLL_ADD,
+};
+
+int sys_setup(unsigned entries, io_uring_params* params) {
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int sys_enter(int fd, unsigned to_submit, unsigned flags) {
+    return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit, 0, flags, nullptr, 0));
+}
+
+int sys_register(int fd, unsigned opcode, void* arg, unsigned nr_args) {
+    return static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+/**
+ * Acquire load / release store on a ring index shared with the kernel.
+ */
+unsigned load(unsigned* index) {
+    return std::atomic_ref<unsigned>(*index).load(std::memory_order_acquire);
+}
+
+void store(unsigned* index, unsigned value) {
+    std::atomic_ref<unsigned>(*index).store(value, std::memory_order_release);
+}
+
+/**
+ * True if the ring supports every opcode the backend issues.
+ */
+bool supports_required_ops(int ring_fd) {
+    constexpr unsigned MAX_OPS = 256;
+    std::vector<unsigned char> buffer(sizeof(io_uring_probe) + MAX_OPS * sizeof(io_uring_probe_op));
+    auto* probe = reinterpret_cast<io_uring_probe*>(buffer.data());
+
+    if (sys_register(ring_fd, IORING_REGISTER_PROBE, probe, MAX_OPS) < 0) {
+        return false;
+    }
+
+    for (std::uint8_t op : REQUIRED_OPS) {
+        if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * A request in flight. Lives on the stack of the fiber waiting for it.
+ */
+struct Completion {
+    boost::fibers::context* waiter = boost::fibers::context::active();
+    int result = 0;
+    bool done = false;
+};
+
+/**
+ * One thread's ring. Requests are written to the submission queue as
+ * fibers make them and submitted together by a handler posted to the
+ * thread's io_context, which the scheduler runs once it has no other
+ * fiber to switch to or on its next poll. Requests that finish during the
+ * submit are reaped straight away. Every completion also signals an
+ * eventfd that the io_context watches; the async-only eventfd would miss
+ * timeouts and poll-driven socket requests, which the kernel completes
+ * outside its worker threads. Completions wake their fibers from the
+ * dispatcher, never from the fiber that is suspending.
+ */
+class Ring {
+public:
+    /**
+     * Map a new ring and hook it into io_ctx. Returns null if the kernel
+     * lacks io_uring or an opcode the backend needs.
+     */
+    static Ring* create(boost::asio::io_context& io_ctx) {
+        io_uring_params params{};
+        int fd = sys_setup(RING_ENTRIES, &params);
+
+        if (fd < 0) {
+            return nullptr;
+        }
+
+        bool usable = (params.features & IORING_FEAT_SINGLE_MMAP)
+            && (params.features & IORING_FEAT_NODROP)
+            && supports_required_ops(fd);
+
+        std::size_t ring_size = std::max(
+            params.sq_off.array + params.sq_entries * sizeof(unsigned),
+            params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+        std::size_t sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        void* ring = MAP_FAILED;
+        void* sqes = MAP_FAILED;
+        int event_fd = -1;
+
+        if (usable) {
+            ring = ::mmap(nullptr, ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+            sqes = ::mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+            event_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        }
+
+        if (ring == MAP_FAILED || sqes == MAP_FAILED || event_fd < 0
+            || sys_register(fd, IORING_REGISTER_EVENTFD, &event_fd, 1) < 0) {
+            if (ring != MAP_FAILED) {
+                ::munmap(ring, ring_size);
+            }
+
+            if (sqes != MAP_FAILED) {
+                ::munmap(sqes, sqes_size);
+            }
+
+            if (event_fd >= 0) {
+                ::close(event_fd);
+            }
+
+            ::close(fd);
+            return nullptr;
+        }
+
+        return new Ring(io_ctx, fd, params, static_cast<char*>(ring), static_cast<io_uring_sqe*>(sqes), event_fd);
+    }
+
+    /**
+     * Queue request, park the calling fiber until it completes, and
+     * return its result.
+     */
+    int run(const io_uring_sqe& request) {
+        Completion completion;
+        io_uring_sqe* sqe = next_sqe();
+        *sqe = request;
+        sqe->user_data = reinterpret_cast<std::uint64_t>(&completion);
+        store(sq_tail_, *sq_tail_ + 1);
+        queued_++;
+
+        if (!flush_posted_) {
+            flush_posted_ = true;
+            boost::asio::post(io_ctx_, [this] {
+                flush_posted_ = false;
+                submit();
+                reap();
+            });
+        }
+
+        while (!completion.done) {
+            completion.waiter->suspend();
+        }
+
+        return completion.result;
+    }
+
+private:
+    boost::asio::io_context& io_ctx_;
+    int fd_;
+    unsigned* sq_tail_;
+    unsigned* sq_head_;
+    unsigned* sq_flags_;
+    unsigned sq_mask_;
+    unsigned sq_entries_;
+    io_uring_sqe* sqes_;
+    unsigned* cq_head_;
+    unsigned* cq_tail_;
+    unsigned cq_mask_;
+    io_uring_cqe* cqes_;
+    boost::asio::posix::stream_descriptor event_;
+    std::uint64_t event_count_ = 0;
+    unsigned queued_ = 0;
+    bool flush_posted_ = false;
+
+    Ring(boost::asio::io_context& io_ctx, int fd, const io_uring_params& params,
+         char* ring, io_uring_sqe* sqes, int event_fd) :
+        io_ctx_(io_ctx),
+        fd_(fd),
+        sq_tail_(reinterpret_cast<unsigned*>(ring + params.sq_off.tail)),
+        sq_head_(reinterpret_cast<unsigned*>(ring + params.sq_off.head)),
+        sq_flags_(reinterpret_cast<unsigned*>(ring + params.sq_off.flags)),
+        sq_mask_(*reinterpret_cast<unsigned*>(ring + params.sq_off.ring_mask)),
+        sq_entries_(params.sq_entries),
+        sqes_(sqes),
+        cq_head_(reinterpret_cast<unsigned*>(ring + params.cq_off.head)),
+        cq_tail_(reinterpret_cast<unsigned*>(ring + params.cq_off.tail)),
+        cq_mask_(*reinterpret_cast<unsigned*>(ring + params.cq_off.ring_mask)),
+        cqes_(reinterpret_cast<io_uring_cqe*>(ring + params.cq_off.cqes)),
+        event_(io_ctx, event_fd) {
+        // Submission slot i always holds entry i, so queueing is a tail bump
+        auto* sq_array = reinterpret_cast<unsigned*>(ring + params.sq_off.array);
+
+        for (unsigned i = 0; i < sq_entries_; i++) {
+            sq_array[i] = i;
+        }
+
+        watch();
+    }
+
+    /**
+     * Next free submission entry, submitting what is queued first if the
+     * queue is full.
+     */
+    io_uring_sqe* next_sqe() {
+        unsigned tail = *sq_tail_;
+
+        if (tail - load(sq_head_) == sq_entries_) {
+            submit();
+        }
+
+        io_uring_sqe* sqe = &sqes_[tail & sq_mask_];
+        *sqe = io_uring_sqe{};
+        return sqe;
+    }
+
+    /**
+     * Hand the queued entries to the kernel in one system call.
+     */
+    void submit() {
+        while (queued_ > 0) {
+            int submitted = sys_enter(fd_, queued_, 0);
+
+            if (submitted >= 0) {
+                queued_ -= static_cast<unsigned>(submitted);
+                continue;
+            }
+
+            if (errno == EINTR) {
+                continue;
+            }
+
+            if (errno != EBUSY && errno != EAGAIN) {
+                return;
+            }
+
+            // The completion queue is backed up; make room and retry
+            reap();
+        }
+    }
+
+    /**
+     * Wake the fiber of every finished request.
+     */
+    void reap() {
+        unsigned head = *cq_head_;
+        unsigned tail = load(cq_tail_);
+
+        while (head != tail) {
+            for (; head != tail; head++) {
+                io_uring_cqe& cqe = cqes_[head & cq_mask_];
+                auto* completion = reinterpret_cast<Completion*>(cqe.user_data);
+                completion->result = cqe.res;
+                completion->done = true;
+                boost::fibers::context::active()->schedule(completion->waiter);
+            }
+
+            store(cq_head_, head);
+
+            // Completions the kernel kept back while the queue was full
+            if (load(sq_flags_) & IORING_SQ_CQ_OVERFLOW) {
+                sys_enter(fd_, 0, IORING_ENTER_GETEVENTS);
+            }
+
+            tail = load(cq_tail_);
+        }
+    }
+
+    /**
+     * Reap whenever the ring signals its eventfd.
+     */
+    void watch() {
+        event_.async_wait(boost::asio::posix::stream_descriptor::wait_read,
+            [this](const boost::system::error_code& ec) {
+                if (ec) {
+                    return;
+                }
+
+                [[maybe_unused]] auto drained = ::read(event_.native_handle(), &event_count_, sizeof(event_count_));
+                reap();
+                watch();
+            });
+    }
+};
+
+// Rings are never freed: a scheduler thread lives until the process exits
+thread_local Ring* t_ring = nullptr;
+
+io_uring_sqe make_request(std::uint8_t opcode, int fd, const void* addr, std::size_t len, std::uint64_t offset) {
+    io_uring_sqe sqe{};
+    sqe.opcode = opcode;
+    sqe.fd = fd;
+    sqe.addr = reinterpret_cast<std::uint64_t>(addr);
+    sqe.len = static_cast<std::uint32_t>(len);
+    sqe.off = offset;
+    return sqe;
+}
+
+/**
+ * Run a socket request. Sockets asio has put in non-blocking mode answer
+ * -EAGAIN instead of waiting, so wait for readiness on the ring and retry.
+ */
+int run_socket(const io_uring_sqe& request, unsigned events) {
+    while (true) {
+        int result = t_ring->run(request);
+
+        if (result != -EAGAIN) {
+            return result;
+        }
+
+        io_uring_sqe poll = make_request(IORING_OP_POLL_ADD, request.fd, nullptr, 0, 0);
+        poll.poll32_events = events;
+        int ready = t_ring->run(poll);
+
+        if (ready < 0) {
+            return ready;
+        }
+    }
+}
+
+long or_errno(long result) {
+    return result < 0 ? -errno : result;
+}
+
+}  // namespace
+
+bool enabled() {
+    return t_ring != nullptr;
+}
+
+bool init_thread() {
+    if (!t_ring) {
+        t_ring = Ring::create(io_context());
+    }
+
+    return t_ring != nullptr;
+}
+
+int accept(int fd) {
+    if (!t_ring) {
+        return static_cast<int>(or_errno(::accept4(fd, nullptr, nullptr, SOCK_CLOEXEC)));
+    }
+
+    io_uring_sqe request = make_request(IORING_OP_ACCEPT, fd, nullptr, 0, 0);
+    request.accept_flags = SOCK_CLOEXEC;
+    return run_socket(request, POLLIN);
+}
+
+long recv(int fd, void* buf, std::size_t len) {
+    if (!t_ring) {
+        return or_errno(::recv(fd, buf, len, 0));
+    }
+
+    return run_socket(make_request(IORING_OP_RECV, fd, buf, len, 0), POLLIN);
+}
+
+long send(int fd, const void* buf, std::size_t len) {
+    if (!t_ring) {
+        return or_errno(::send(fd, buf, len, MSG_NOSIGNAL));
+    }
+
+    io_uring_sqe request = make_request(IORING_OP_SEND, fd, buf, len, 0);
+    request.msg_flags = MSG_NOSIGNAL;
+    return run_socket(request, POLLOUT);
+}
+
+long send_all(int fd, const void* buf, std::size_t len) {
+    const char* data = static_cast<const char*>(buf);
+    std::size_t sent = 0;
+
+    while (sent < len) {
+        long n = send(fd, data + sent, len - sent);
+
+        if (n < 0) {
+            return n;
+        }
+
+        sent += static_cast<std::size_t>(n);
+    }
+
+    return static_cast<long>(sent);
+}
+
+long read(int fd, void* buf, std::size_t len, std::uint64_t offset) {
+    if (!t_ring) {
+        return or_errno(::pread(fd, buf, len, static_cast<off_t>(offset)));
+    }
+
+    return t_ring->run(make_request(IORING_OP_READ, fd, buf, len, offset));
+}
+
+long write(int fd, const void* buf, std::size_t len, std::uint64_t offset) {
+    if (!t_ring) {
+        return or_errno(::pwrite(fd, buf, len, static_cast<off_t>(offset)));
+    }
+
+    return t_ring->run(make_request(IORING_OP_WRITE, fd, buf, len, offset));
+}
+
+int open(const std::string& path, int flags, int mode) {
+    flags |= O_CLOEXEC;
+
+    if (!t_ring) {
+        return static_cast<int>(or_errno(::open(path.c_str(), flags, mode)));
+    }
+
+    io_uring_sqe request = make_request(IORING_OP_OPENAT, AT_FDCWD, path.c_str(), static_cast<std::size_t>(mode), 0);
+    request.open_flags = static_cast<std::uint32_t>(flags);
+    return t_ring->run(request);
+}
+
+int close(int fd) {
+    if (!t_ring) {
+        return static_cast<int>(or_errno(::close(fd)));
+    }
+
+    return t_ring->run(make_request(IORING_OP_CLOSE, fd, nullptr, 0, 0));
+}
+
+void sleep(std::chrono::nanoseconds duration) {
+    if (!t_ring) {
+        boost::this_fiber::sleep_for(duration);
+        return;
+    }
+
+    __kernel_timespec ts{};
+    ts.tv_sec = std::chrono::duration_cast<std::chrono::seconds>(duration).count();
+    ts.tv_nsec = (duration - std::chrono::seconds(ts.tv_sec)).count();
+
+    // A pure timeout completes with -ETIME when it expires
+    t_ring->run(make_request(IORING_OP_TIMEOUT, -1, &ts, 1, 0));
+}
+
+}  // namespace uring
+
+}  // namespace bishop::rt
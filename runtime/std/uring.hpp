@@ -0,0 +1,85 @@
+/**
+ * @file uring.hpp
+ * @brief Optional io_uring I/O backend for the fiber runtime.
+ *
+ * With io = "uring" in bishop.toml (or BISHOP_IO=uring), every scheduler
+ * thread gets its own io_uring. A fiber doing socket or file I/O queues a
+ * request on its thread's ring and parks; the requests queued by all the
+ * thread's fibers are submitted with one system call per pass of the
+ * scheduler loop, and completions are reaped from shared memory when the
+ * ring's eventfd fires in the io_context.
+ *
+ * When the kernel has no usable io_uring the runtime falls back to the
+ * asio epoll reactor and enabled() returns false. The calls below then
+ * make the plain blocking system call, so callers that have an asio path
+ * should check enabled() and keep using it.
+ *
+ * All calls return the result of the underlying system call, or -errno.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace bishop::rt::uring {
+
+/**
+ * True if the calling thread submits I/O through io_uring.
+ */
+bool enabled();
+
+/**
+ * Set up the calling scheduler thread's ring. Called by the runtime when
+ * io_uring is configured; returns false if the kernel refuses it.
+ */
+bool init_thread();
+
+/**
+ * Accept a connection on a listening socket. Returns the new socket.
+ */
+int accept(int fd);
+
+/**
+ * Receive up to len bytes from a socket. Returns 0 at end of stream.
+ */
+long recv(int fd, void* buf, std::size_t len);
+
+/**
+ * Send up to len bytes on a socket. Returns the bytes sent.
+ */
+long send(int fd, const void* buf, std::size_t len);
+
+/**
+ * Send all len bytes on a socket.
+ */
+long send_all(int fd, const void* buf, std::size_t len);
+
+/**
+ * Read up to len bytes from a file at offset.
+ */
+long read(int fd, void* buf, std::size_t len, std::uint64_t offset);
+
+/**
+ * Write up to len bytes to a file at offset.
+ */
+long write(int fd, const void* buf, std::size_t len, std::uint64_t offset);
+
+/**
+ * Open a file. Returns the new file descriptor.
+ */
+int open(const std::string& path, int flags, int mode = 0666);
+
+/**
+ * Close a file descriptor.
+ */
+int close(int fd);
+
+/**
+ * Park the calling fiber for duration using a ring timeout.
+ */
+void sleep(std::chrono::nanoseconds duration);
+
+}  // namespace bishop::rt::uring
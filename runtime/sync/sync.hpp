@@ -2,32 +2,51 @@
  * @file sync.hpp
  * @brief Bishop synchronization runtime library.
  *
- * Provides synchronization primitives for Bishop programs.
+ * Provides synchronization primitives for Bishop programs. Blocking
+ * operations park the calling goroutine instead of its thread.
  * This header is included when programs import the sync module.
  */
 
 #pragma once
 
-#include <mutex>
+#include <boost/fiber/condition_variable.hpp>
+#include <boost/fiber/mutex.hpp>
 #include <atomic>
-#include <condition_variable>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <functional>
+#include <mutex>
 
 namespace bsync {
 
+// Every blocking primitive here keeps its state under a boost::fibers::mutex
+// and parks waiters on a boost::fibers::condition_variable. A waiting
+// goroutine suspends only itself, never its thread, so the others keep
+// running; both work across scheduler threads. The state is a flag or a
+// count rather than an owned lock, so any goroutine may release what
+// another acquired, as in Go.
+
+using Lock = std::unique_lock<boost::fibers::mutex>;
+
 // ============================================================================
 // Mutex - Mutual exclusion lock
 // ============================================================================
 
 /**
- * Mutex wrapper for Bishop.
+ * Mutex implementation for Bishop.
  * Uses shared_ptr to allow copying in Bishop's value semantics.
  */
 struct Mutex {
-    std::shared_ptr<std::mutex> impl;
+    struct Impl {
+        boost::fibers::mutex mtx;
+        boost::fibers::condition_variable cv;
+        bool locked = false;
+    };
 
-    Mutex() : impl(std::make_shared<std::mutex>()) {}
+    std::shared_ptr<Impl> impl;
+
+    Mutex() : impl(std::make_shared<Impl>()) {}
 };
 
 /**
@@ -38,17 +57,24 @@ inline Mutex mutex_create() {
 }
 
 /**
- * Acquires the mutex lock. Blocks until available.
+ * Acquires the mutex lock. Parks the calling goroutine until available.
  */
 inline void mutex_lock(Mutex& mtx) {
-    mtx.impl->lock();
+    Lock lock(mtx.impl->mtx);
+    mtx.impl->cv.wait(lock, [&mtx]() { return !mtx.impl->locked; });
+    mtx.impl->locked = true;
 }
 
 /**
- * Releases the mutex lock.
+ * Releases the mutex lock and wakes one waiting goroutine.
  */
 inline void mutex_unlock(Mutex& mtx) {
-    mtx.impl->unlock();
+    {
+        Lock lock(mtx.impl->mtx);
+        mtx.impl->locked = false;
+    }
+
+    mtx.impl->cv.notify_one();
 }
 
 /**
@@ -56,7 +82,186 @@ inline void mutex_unlock(Mutex& mtx) {
  * Returns true if lock was acquired, false otherwise.
  */
 inline bool mutex_try_lock(Mutex& mtx) {
-    return mtx.impl->try_lock();
+    Lock lock(mtx.impl->mtx);
+
+    if (mtx.impl->locked) {
+        return false;
+    }
+
+    mtx.impl->locked = true;
+    return true;
+}
+
+/**
+ * Acquires the lock, giving up after ms milliseconds.
+ * Returns true if lock was acquired, false on timeout.
+ */
+inline bool mutex_lock_timeout(Mutex& mtx, int64_t ms) {
+    Lock lock(mtx.impl->mtx);
+
+    if (!mtx.impl->cv.wait_for(lock, std::chrono::milliseconds(ms), [&mtx]() { return !mtx.impl->locked; })) {
+        return false;
+    }
+
+    mtx.impl->locked = true;
+    return true;
+}
+
+// ============================================================================
+// RWMutex - Reader/writer lock
+// ============================================================================
+
+/**
+ * Reader/writer lock for Bishop: any number of readers or one writer.
+ * A waiting writer holds back new readers, so a steady stream of readers
+ * cannot starve it.
+ */
+struct RWMutex {
+    struct Impl {
+        boost::fibers::mutex mtx;
+        boost::fibers::condition_variable readers_cv;
+        boost::fibers::condition_variable writers_cv;
+        int64_t readers = 0;
+        int64_t writers_waiting = 0;
+        bool writer = false;
+    };
+
+    std::shared_ptr<Impl> impl;
+
+    RWMutex() : impl(std::make_shared<Impl>()) {}
+};
+
+/**
+ * Creates a new reader/writer lock.
+ */
+inline RWMutex rwmutex_create() {
+    return RWMutex();
+}
+
+/**
+ * Acquires the lock for writing. Parks until no reader or writer holds it.
+ */
+inline void rwmutex_lock(RWMutex& rw) {
+    RWMutex::Impl& s = *rw.impl;
+    Lock lock(s.mtx);
+    s.writers_waiting++;
+    s.writers_cv.wait(lock, [&s]() { return !s.writer && s.readers == 0; });
+    s.writers_waiting--;
+    s.writer = true;
+}
+
+/**
+ * Releases a write lock, handing it to the next writer if one waits and
+ * to the waiting readers otherwise.
+ */
+inline void rwmutex_unlock(RWMutex& rw) {
+    RWMutex::Impl& s = *rw.impl;
+    bool writers_waiting = false;
+
+    {
+        Lock lock(s.mtx);
+        s.writer = false;
+        writers_waiting = s.writers_waiting > 0;
+    }
+
+    if (writers_waiting) {
+        s.writers_cv.notify_one();
+    } else {
+        s.readers_cv.notify_all();
+    }
+}
+
+/**
+ * Acquires the lock for reading. Parks while a writer holds or waits for it.
+ */
+inline void rwmutex_rlock(RWMutex& rw) {
+    RWMutex::Impl& s = *rw.impl;
+    Lock lock(s.mtx);
+    s.readers_cv.wait(lock, [&s]() { return !s.writer && s.writers_waiting == 0; });
+    s.readers++;
+}
+
+/**
+ * Releases a read lock. The last reader out wakes a waiting writer.
+ */
+inline void rwmutex_runlock(RWMutex& rw) {
+    RWMutex::Impl& s = *rw.impl;
+    bool wake_writer = false;
+
+    {
+        Lock lock(s.mtx);
+        s.readers--;
+        wake_writer = s.readers == 0 && s.writers_waiting > 0;
+    }
+
+    if (wake_writer) {
+        s.writers_cv.notify_one();
+    }
+}
+
+// ============================================================================
+// Semaphore - Counting semaphore
+// ============================================================================
+
+/**
+ * Counting semaphore for Bishop.
+ * Uses shared_ptr to allow copying in Bishop's value semantics.
+ */
+struct Semaphore {
+    struct Impl {
+        boost::fibers::mutex mtx;
+        boost::fibers::condition_variable cv;
+        int64_t permits = 0;
+    };
+
+    std::shared_ptr<Impl> impl;
+
+    explicit Semaphore(int64_t permits) : impl(std::make_shared<Impl>()) {
+        impl->permits = permits;
+    }
+};
+
+/**
+ * Creates a semaphore with the given number of permits.
+ */
+inline Semaphore semaphore_create(int64_t permits) {
+    return Semaphore(permits);
+}
+
+/**
+ * Takes a permit, parking until one is available.
+ */
+inline void semaphore_acquire(Semaphore& sem) {
+    Lock lock(sem.impl->mtx);
+    sem.impl->cv.wait(lock, [&sem]() { return sem.impl->permits > 0; });
+    sem.impl->permits--;
+}
+
+/**
+ * Takes a permit if one is available without blocking.
+ * Returns true if a permit was taken, false otherwise.
+ */
+inline bool semaphore_try_acquire(Semaphore& sem) {
+    Lock lock(sem.impl->mtx);
+
+    if (sem.impl->permits <= 0) {
+        return false;
+    }
+
+    sem.impl->permits--;
+    return true;
+}
+
+/**
+ * Returns a permit and wakes one waiting goroutine.
+ */
+inline void semaphore_release(Semaphore& sem) {
+    {
+        Lock lock(sem.impl->mtx);
+        sem.impl->permits++;
+    }
+
+    sem.impl->cv.notify_one();
 }
 
 // ============================================================================
@@ -69,9 +274,9 @@ inline bool mutex_try_lock(Mutex& mtx) {
  */
 struct WaitGroup {
     struct Impl {
-        std::mutex mtx;
-        std::condition_variable cv;
-        int counter = 0;
+        boost::fibers::mutex mtx;
+        boost::fibers::condition_variable cv;
+        int64_t counter = 0;
     };
 
     std::shared_ptr<Impl> impl;
@@ -90,8 +295,8 @@ inline WaitGroup waitgroup_create() {
  * Adds delta to the WaitGroup counter.
  */
 inline void waitgroup_add(WaitGroup& wg, int64_t n) {
-    std::lock_guard<std::mutex> lock(wg.impl->mtx);
-    wg.impl->counter += static_cast<int>(n);
+    Lock lock(wg.impl->mtx);
+    wg.impl->counter += n;
 }
 
 /**
@@ -99,7 +304,7 @@ inline void waitgroup_add(WaitGroup& wg, int64_t n) {
  * Wakes waiting goroutines when counter reaches zero.
  */
 inline void waitgroup_done(WaitGroup& wg) {
-    std::unique_lock<std::mutex> lock(wg.impl->mtx);
+    Lock lock(wg.impl->mtx);
     wg.impl->counter--;
 
     if (wg.impl->counter <= 0) {
@@ -109,10 +314,10 @@ inline void waitgroup_done(WaitGroup& wg) {
 }
 
 /**
- * Blocks until the WaitGroup counter reaches zero.
+ * Parks the calling goroutine until the WaitGroup counter reaches zero.
  */
 inline void waitgroup_wait(WaitGroup& wg) {
-    std::unique_lock<std::mutex> lock(wg.impl->mtx);
+    Lock lock(wg.impl->mtx);
     wg.impl->cv.wait(lock, [&wg]() { return wg.impl->counter <= 0; });
 }
 
@@ -126,7 +331,8 @@ inline void waitgroup_wait(WaitGroup& wg) {
  */
 struct Once {
     struct Impl {
-        std::once_flag flag;
+        boost::fibers::mutex mtx;
+        bool done = false;
     };
 
     std::shared_ptr<Impl> impl;
@@ -143,9 +349,16 @@ inline Once once_create() {
 
 /**
  * Executes the function exactly once, even if called concurrently.
+ * Concurrent callers park until it has returned. If it throws, the next
+ * caller runs it again.
  */
 inline void once_do(Once& once, std::function<void()> f) {
-    std::call_once(once.impl->flag, f);
+    Lock lock(once.impl->mtx);
+
+    if (!once.impl->done) {
+        f();
+        once.impl->done = true;
+    }
 }
 
 // ============================================================================
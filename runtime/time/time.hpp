@@ -3,14 +3,20 @@
  * @brief Bishop time runtime library.
  *
  * Provides time and duration operations for Bishop programs.
- * Uses std::chrono for all time operations.
+ * Uses std::chrono for all time operations. Timer channels are fed by the
+ * calling core's timer wheel.
  */
 
 #pragma once
 
 #include <bishop/std.hpp>
 #include <bishop/error.hpp>
+#include <bishop/channel.hpp>
+#include <bishop/timer.hpp>
+#include <algorithm>
 #include <chrono>
+#include <memory>
+#include <stdexcept>
 #include <ctime>
 #include <iomanip>
 #include <sstream>
@@ -379,6 +385,83 @@ inline Duration since(const Timestamp& ts) {
     return Duration{ms};
 }
 
+namespace detail {
+
+/**
+ * Sends into a time.after or time.ticker channel from the wheel of the
+ * core that made it. Each firing sends the milliseconds elapsed since the
+ * channel was made, without blocking: a ticker whose receiver falls behind
+ * drops ticks instead of queueing them, and skips ticks it missed.
+ */
+class TimerFeed : public bishop::rt::detail::ChannelFeed {
+public:
+    using clock = std::chrono::steady_clock;
+
+    TimerFeed(bishop::rt::Channel<int>& ch, int ms, bool repeat) :
+        ch_(ch),
+        period_(std::max(ms, repeat ? 1 : 0)),
+        repeat_(repeat),
+        start_(clock::now()),
+        next_(start_ + period_),
+        timer_(&TimerFeed::fire, this) {
+        if (!bishop::rt::timer::enabled()) {
+            throw std::runtime_error("timer channels need a scheduler thread");
+        }
+
+        bishop::rt::timer::arm(timer_, period_);
+    }
+
+private:
+    static void fire(void* self) {
+        auto* feed = static_cast<TimerFeed*>(self);
+        auto now = clock::now();
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - feed->start_);
+        feed->ch_.try_send(static_cast<int>(elapsed.count()));
+
+        if (!feed->repeat_) {
+            return;
+        }
+
+        // Tick on a fixed schedule, so rounding and late wakeups never drift
+        feed->next_ += feed->period_;
+
+        if (feed->next_ <= now) {
+            feed->next_ += ((now - feed->next_) / feed->period_ + 1) * feed->period_;
+        }
+
+        bishop::rt::timer::arm(feed->timer_, std::chrono::ceil<std::chrono::milliseconds>(feed->next_ - now));
+    }
+
+    bishop::rt::Channel<int>& ch_;
+    std::chrono::milliseconds period_;
+    bool repeat_;
+    clock::time_point start_;
+    clock::time_point next_;
+    bishop::rt::timer::Timer timer_;
+};
+
+}  // namespace detail
+
+/**
+ * Returns a channel that receives one value after ms milliseconds: the
+ * milliseconds that actually elapsed.
+ */
+inline bishop::rt::Channel<int> after(int ms) {
+    return bishop::rt::Channel<int>(1, [ms](bishop::rt::Channel<int>& ch) {
+        return std::make_unique<detail::TimerFeed>(ch, ms, false);
+    });
+}
+
+/**
+ * Returns a channel that receives a value every ms milliseconds for as
+ * long as the channel lives: the milliseconds elapsed since it was made.
+ */
+inline bishop::rt::Channel<int> ticker(int ms) {
+    return bishop::rt::Channel<int>(1, [ms](bishop::rt::Channel<int>& ch) {
+        return std::make_unique<detail::TimerFeed>(ch, ms, true);
+    });
+}
+
 /**
  * Parses a timestamp from a string using strptime format specifiers.
  *
@@ -77,7 +77,7 @@
  * @bishop_fn serve
  * @module http
  * @async
- * @description Starts an HTTP server on the specified port with a single handler function.
+ * @description Starts an HTTP server on the specified port with a single handler function. With the sharded scheduler every core listens on the port and serves the connections it accepts. With io = "uring" under [runtime] in bishop.toml, connections are accepted, read and written through io_uring.
  * @param port int - Port number to listen on
  * @param handler fn(http.Request) -> http.Response - Handler function for all requests
  * @example
@@ -111,7 +111,7 @@
  * @bishop_method listen
  * @type http.App
  * @async
- * @description Starts the HTTP server and begins listening for requests.
+ * @description Starts the HTTP server and begins listening for requests. With the sharded scheduler every core listens on the port and serves the connections it accepts.
  * @param port int - Port number to listen on
  * @example await app.listen(8080);
  */
@@ -125,7 +125,7 @@ namespace bishop::stdlib {
 /**
  * List of built-in stdlib modules.
  */
-const vector<string> BUILTIN_MODULES = {"http", "fs", "crypto", "net", "process", "regex", "time", "math", "random", "log", "sync", "json", "algo", "yaml", "markdown"};
+const vector<string> BUILTIN_MODULES = {"http", "fs", "crypto", "net", "process", "regex", "time", "math", "random", "log", "sync", "json", "algo", "yaml", "markdown", "runtime"};
 
 /**
  * Checks if a module name is a built-in stdlib module.
@@ -196,7 +196,8 @@
 /**
  * @bishop_method set_timeout
  * @type net.TcpStream
- * @description Sets read/write timeout in milliseconds.
+ * @description Sets read/write timeout in milliseconds. A read or write
+ * that takes longer fails with a "timed out" error; the connection stays open.
  * @param ms int - Timeout in milliseconds (0 for no timeout)
  * @example
  * conn.set_timeout(5000);  // 5 second timeout
@@ -0,0 +1,199 @@
+/**
+ * @file runtime.cpp
+ * @brief Built-in runtime module implementation.
+ *
+ * Creates the AST definitions for the runtime module.
+ * The actual runtime is in runtime/runtime/runtime.hpp and included as a header.
+ */
+
+/**
+ * @bishop_struct Stats
+ * @module runtime
+ * @description Counters of the fiber runtime, for one core or the whole process. Scheduler counters (ready, switches, busy_ms, idle_ms, timers, channel_blocks) stay zero unless metrics = true is set under [runtime] in bishop.toml or BISHOP_METRICS=1. Stall counters stay zero unless stall_ms is set under [runtime] or BISHOP_STALL_MS.
+ * @field live int - Spawned goroutines that have not returned yet
+ * @field spawned int - Goroutines spawned
+ * @field finished int - Spawned goroutines that have returned
+ * @field ready int - Goroutines waiting for a thread to run them
+ * @field switches int - Goroutines resumed by the scheduler
+ * @field switches_per_sec int - Switches averaged over the uptime
+ * @field busy_ms int - Time spent running goroutines
+ * @field idle_ms int - Time spent waiting for I/O, timers or wakeups
+ * @field timers int - Sleeps and timed waits started
+ * @field channel_blocks int - Channel operations that had to wait
+ * @field stalls int - Goroutine runs longer than stall_ms without yielding
+ * @field stall_ms int - Total time of those runs
+ * @field longest_stall_ms int - Longest of those runs
+ * @field uptime_ms int - Time since the runtime started
+ * @example
+ * s := runtime.stats();
+ * print(s.live, s.switches_per_sec);
+ */
+
+/**
+ * @bishop_fn stats
+ * @module runtime
+ * @description Returns the runtime counters summed over every core.
+ * @returns runtime.Stats - Current counters
+ * @example
+ * s := runtime.stats();
+ * print(s.spawned, s.finished);
+ */
+
+/**
+ * @bishop_fn core_stats
+ * @module runtime
+ * @description Returns the counters of one core. Goroutines count as live on the core that spawned them.
+ * @param core int - Core index, from 0
+ * @returns runtime.Stats - Current counters of that core
+ * @example
+ * for i in 0..runtime.core_count() {
+ *     print(i, runtime.core_stats(i).ready);
+ * }
+ */
+
+/**
+ * @bishop_fn core_count
+ * @module runtime
+ * @description Returns the number of scheduler threads.
+ * @returns int - Number of cores the runtime uses
+ * @example
+ * print(runtime.core_count());
+ */
+
+/**
+ * @bishop_fn core_id
+ * @module runtime
+ * @description Returns the index of the core the calling goroutine runs on.
+ * @returns int - Core index, from 0
+ * @example
+ * print(runtime.core_id());
+ */
+
+/**
+ * @bishop_fn metrics_enabled
+ * @module runtime
+ * @description Returns true if scheduler metrics are being collected.
+ * @returns bool - Whether metrics are on
+ * @example
+ * if runtime.metrics_enabled() {
+ *     print(runtime.stats().switches);
+ * }
+ */
+
+/**
+ * @bishop_fn dump
+ * @module runtime
+ * @description Returns every counter as text, one line for the totals and one per core. With metrics on, the same text is written to stderr when the process receives SIGUSR1.
+ * @returns str - Formatted counters
+ * @example
+ * print(runtime.dump());
+ */
+
+/**
+ * @bishop_fn spawn_blocking
+ * @module runtime
+ * @description Runs a function on the blocking thread pool and waits for it to return. Other goroutines keep running meanwhile, so use it for CPU-heavy work or calls into code that blocks the thread. The pool size is blocking_threads under [runtime] in bishop.toml or BISHOP_BLOCKING_THREADS.
+ * @param f fn() - The function to run
+ * @example
+ * total := 0;
+ * runtime.spawn_blocking(fn() {
+ *     for i in 0..10000000 {
+ *         total = total + i;
+ *     }
+ * });
+ */
+
+#include "runtime.hpp"
+
+using namespace std;
+
+namespace bishop::stdlib {
+
+/**
+ * Creates the AST for the built-in runtime module.
+ */
+unique_ptr<Program> create_runtime_module() {
+    auto program = make_unique<Program>();
+
+    // Stats :: struct { live, spawned, finished, ready, switches, ... int }
+    auto stats_struct = make_unique<StructDef>();
+    stats_struct->name = "Stats";
+    stats_struct->visibility = Visibility::Public;
+    stats_struct->fields.push_back({"live", "int", ""});
+    stats_struct->fields.push_back({"spawned", "int", ""});
+    stats_struct->fields.push_back({"finished", "int", ""});
+    stats_struct->fields.push_back({"ready", "int", ""});
+    stats_struct->fields.push_back({"switches", "int", ""});
+    stats_struct->fields.push_back({"switches_per_sec", "int", ""});
+    stats_struct->fields.push_back({"busy_ms", "int", ""});
+    stats_struct->fields.push_back({"idle_ms", "int", ""});
+    stats_struct->fields.push_back({"timers", "int", ""});
+    stats_struct->fields.push_back({"channel_blocks", "int", ""});
+    stats_struct->fields.push_back({"stalls", "int", ""});
+    stats_struct->fields.push_back({"stall_ms", "int", ""});
+    stats_struct->fields.push_back({"longest_stall_ms", "int", ""});
+    stats_struct->fields.push_back({"uptime_ms", "int", ""});
+    program->structs.push_back(move(stats_struct));
+
+    // fn stats() -> runtime.Stats
+    auto stats_fn = make_unique<FunctionDef>();
+    stats_fn->name = "stats";
+    stats_fn->visibility = Visibility::Public;
+    stats_fn->return_type = "runtime.Stats";
+    program->functions.push_back(move(stats_fn));
+
+    // fn core_stats(int core) -> runtime.Stats
+    auto core_stats_fn = make_unique<FunctionDef>();
+    core_stats_fn->name = "core_stats";
+    core_stats_fn->visibility = Visibility::Public;
+    core_stats_fn->params.push_back({"int", "core"});
+    core_stats_fn->return_type = "runtime.Stats";
+    program->functions.push_back(move(core_stats_fn));
+
+    // fn core_count() -> int
+    auto core_count_fn = make_unique<FunctionDef>();
+    core_count_fn->name = "core_count";
+    core_count_fn->visibility = Visibility::Public;
+    core_count_fn->return_type = "int";
+    program->functions.push_back(move(core_count_fn));
+
+    // fn core_id() -> int
+    auto core_id_fn = make_unique<FunctionDef>();
+    core_id_fn->name = "core_id";
+    core_id_fn->visibility = Visibility::Public;
+    core_id_fn->return_type = "int";
+    program->functions.push_back(move(core_id_fn));
+
+    // fn metrics_enabled() -> bool
+    auto metrics_enabled_fn = make_unique<FunctionDef>();
+    metrics_enabled_fn->name = "metrics_enabled";
+    metrics_enabled_fn->visibility = Visibility::Public;
+    metrics_enabled_fn->return_type = "bool";
+    program->functions.push_back(move(metrics_enabled_fn));
+
+    // fn dump() -> str
+    auto dump_fn = make_unique<FunctionDef>();
+    dump_fn->name = "dump";
+    dump_fn->visibility = Visibility::Public;
+    dump_fn->return_type = "str";
+    program->functions.push_back(move(dump_fn));
+
+    // fn spawn_blocking(fn() f)
+    auto spawn_blocking_fn = make_unique<FunctionDef>();
+    spawn_blocking_fn->name = "spawn_blocking";
+    spawn_blocking_fn->visibility = Visibility::Public;
+    spawn_blocking_fn->params.push_back({"fn()", "f"});
+    program->functions.push_back(move(spawn_blocking_fn));
+
+    return program;
+}
+
+/**
+ * Returns empty - runtime.hpp is included at the top of generated code
+ * for precompiled header support.
+ */
+string generate_runtime_runtime() {
+    return "";
+}
+
+}  // namespace bishop::stdlib
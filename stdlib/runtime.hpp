@@ -0,0 +1,37 @@
+/**
+ * @file runtime.hpp
+ * @brief Built-in runtime module header.
+ *
+ * Declares the AST creation functions for the runtime module.
+ * The actual runtime is in runtime/runtime/runtime.hpp.
+ */
+
+#pragma once
+
+#include "parser/ast.hpp"
+#include <memory>
+#include <string>
+
+namespace bishop::stdlib {
+
+/**
+ * Creates the AST for the built-in runtime module.
+ * Contains:
+ * - Stats struct (live, spawned, finished, ready, switches, switches_per_sec,
+ *   busy_ms, idle_ms, timers, channel_blocks, stalls, stall_ms,
+ *   longest_stall_ms, uptime_ms fields)
+ * - stats() -> Stats
+ * - core_stats(int) -> Stats
+ * - core_count() -> int
+ * - core_id() -> int
+ * - metrics_enabled() -> bool
+ * - dump() -> str
+ */
+std::unique_ptr<Program> create_runtime_module();
+
+/**
+ * Generates the runtime module code (empty - uses precompiled header).
+ */
+std::string generate_runtime_runtime();
+
+}  // namespace bishop::stdlib
@@ -57,6 +57,132 @@
  * }
  */
 
+/**
+ * @bishop_fn mutex_lock_timeout
+ * @module sync
+ * @description Acquires the mutex lock, giving up after a timeout.
+ * @param mtx Mutex - The mutex to lock
+ * @param ms int - Milliseconds to wait at most
+ * @returns bool - True if lock was acquired, false on timeout
+ * @example
+ * import sync;
+ * mtx := sync.mutex_create();
+ * if sync.mutex_lock_timeout(mtx, 100) {
+ *     // critical section
+ *     sync.mutex_unlock(mtx);
+ * }
+ */
+
+/**
+ * @bishop_fn rwmutex_create
+ * @module sync
+ * @description Creates a reader/writer lock, held by any number of readers or by one writer. A waiting writer holds back new readers.
+ * @returns RWMutex - A new reader/writer lock
+ * @example
+ * import sync;
+ * rw := sync.rwmutex_create();
+ */
+
+/**
+ * @bishop_fn rwmutex_lock
+ * @module sync
+ * @description Acquires the lock for writing. Blocks until no reader or writer holds it.
+ * @param rw RWMutex - The lock
+ * @example
+ * import sync;
+ * rw := sync.rwmutex_create();
+ * sync.rwmutex_lock(rw);
+ * // write shared state
+ * sync.rwmutex_unlock(rw);
+ */
+
+/**
+ * @bishop_fn rwmutex_unlock
+ * @module sync
+ * @description Releases a write lock.
+ * @param rw RWMutex - The lock
+ * @example
+ * import sync;
+ * rw := sync.rwmutex_create();
+ * sync.rwmutex_lock(rw);
+ * sync.rwmutex_unlock(rw);
+ */
+
+/**
+ * @bishop_fn rwmutex_rlock
+ * @module sync
+ * @description Acquires the lock for reading. Blocks while a writer holds or waits for it.
+ * @param rw RWMutex - The lock
+ * @example
+ * import sync;
+ * rw := sync.rwmutex_create();
+ * sync.rwmutex_rlock(rw);
+ * // read shared state
+ * sync.rwmutex_runlock(rw);
+ */
+
+/**
+ * @bishop_fn rwmutex_runlock
+ * @module sync
+ * @description Releases a read lock.
+ * @param rw RWMutex - The lock
+ * @example
+ * import sync;
+ * rw := sync.rwmutex_create();
+ * sync.rwmutex_rlock(rw);
+ * sync.rwmutex_runlock(rw);
+ */
+
+/**
+ * @bishop_fn semaphore_create
+ * @module sync
+ * @description Creates a counting semaphore with the given number of permits.
+ * @param permits int - Permits available at the start
+ * @returns Semaphore - A new semaphore
+ * @example
+ * import sync;
+ * sem := sync.semaphore_create(4);
+ */
+
+/**
+ * @bishop_fn semaphore_acquire
+ * @module sync
+ * @description Takes a permit. Blocks until one is available.
+ * @param sem Semaphore - The semaphore
+ * @example
+ * import sync;
+ * sem := sync.semaphore_create(4);
+ * sync.semaphore_acquire(sem);
+ * // at most 4 goroutines here at once
+ * sync.semaphore_release(sem);
+ */
+
+/**
+ * @bishop_fn semaphore_try_acquire
+ * @module sync
+ * @description Takes a permit if one is available, without blocking.
+ * @param sem Semaphore - The semaphore
+ * @returns bool - True if a permit was taken, false otherwise
+ * @example
+ * import sync;
+ * sem := sync.semaphore_create(1);
+ * if sync.semaphore_try_acquire(sem) {
+ *     sync.semaphore_release(sem);
+ * }
+ */
+
+/**
+ * @bishop_fn semaphore_release
+ * @module sync
+ * @description Returns a permit, waking one waiting goroutine.
+ * @param sem Semaphore - The semaphore
+ * @example
+ * import sync;
+ * sem := sync.semaphore_create(1);
+ * sync.semaphore_acquire(sem);
+ * sync.semaphore_release(sem);
+ */
+
 /**
  * @bishop_fn waitgroup_create
  * @module sync
@@ -246,6 +372,84 @@ unique_ptr<Program> create_sync_module() {
     mutex_try_lock_fn->return_type = "bool";
     program->functions.push_back(move(mutex_try_lock_fn));
 
+    // fn mutex_lock_timeout(Mutex mtx, int ms) -> bool
+    auto mutex_lock_timeout_fn = make_unique<FunctionDef>();
+    mutex_lock_timeout_fn->name = "mutex_lock_timeout";
+    mutex_lock_timeout_fn->visibility = Visibility::Public;
+    mutex_lock_timeout_fn->params.push_back({"Mutex", "mtx"});
+    mutex_lock_timeout_fn->params.push_back({"int", "ms"});
+    mutex_lock_timeout_fn->return_type = "bool";
+    program->functions.push_back(move(mutex_lock_timeout_fn));
+
+    // RWMutex functions
+
+    // fn rwmutex_create() -> RWMutex
+    auto rw_create_fn = make_unique<FunctionDef>();
+    rw_create_fn->name = "rwmutex_create";
+    rw_create_fn->visibility = Visibility::Public;
+    rw_create_fn->return_type = "RWMutex";
+    program->functions.push_back(move(rw_create_fn));
+
+    // fn rwmutex_lock(RWMutex rw)
+    auto rw_lock_fn = make_unique<FunctionDef>();
+    rw_lock_fn->name = "rwmutex_lock";
+    rw_lock_fn->visibility = Visibility::Public;
+    rw_lock_fn->params.push_back({"RWMutex", "rw"});
+    program->functions.push_back(move(rw_lock_fn));
+
+    // fn rwmutex_unlock(RWMutex rw)
+    auto rw_unlock_fn = make_unique<FunctionDef>();
+    rw_unlock_fn->name = "rwmutex_unlock";
+    rw_unlock_fn->visibility = Visibility::Public;
+    rw_unlock_fn->params.push_back({"RWMutex", "rw"});
+    program->functions.push_back(move(rw_unlock_fn));
+
+    // fn rwmutex_rlock(RWMutex rw)
+    auto rw_rlock_fn = make_unique<FunctionDef>();
+    rw_rlock_fn->name = "rwmutex_rlock";
+    rw_rlock_fn->visibility = Visibility::Public;
+    rw_rlock_fn->params.push_back({"RWMutex", "rw"});
+    program->functions.push_back(move(rw_rlock_fn));
+
+    // fn rwmutex_runlock(RWMutex rw)
+    auto rw_runlock_fn = make_unique<FunctionDef>();
+    rw_runlock_fn->name = "rwmutex_runlock";
+    rw_runlock_fn->visibility = Visibility::Public;
+    rw_runlock_fn->params.push_back({"RWMutex", "rw"});
+    program->functions.push_back(move(rw_runlock_fn));
+
+    // Semaphore functions
+
+    // fn semaphore_create(int permits) -> Semaphore
+    auto sem_create_fn = make_unique<FunctionDef>();
+    sem_create_fn->name = "semaphore_create";
+    sem_create_fn->visibility = Visibility::Public;
+    sem_create_fn->params.push_back({"int", "permits"});
+    sem_create_fn->return_type = "Semaphore";
+    program->functions.push_back(move(sem_create_fn));
+
+    // fn semaphore_acquire(Semaphore sem)
+    auto sem_acquire_fn = make_unique<FunctionDef>();
+    sem_acquire_fn->name = "semaphore_acquire";
+    sem_acquire_fn->visibility = Visibility::Public;
+    sem_acquire_fn->params.push_back({"Semaphore", "sem"});
+    program->functions.push_back(move(sem_acquire_fn));
+
+    // fn semaphore_try_acquire(Semaphore sem) -> bool
+    auto sem_try_acquire_fn = make_unique<FunctionDef>();
+    sem_try_acquire_fn->name = "semaphore_try_acquire";
+    sem_try_acquire_fn->visibility = Visibility::Public;
+    sem_try_acquire_fn->params.push_back({"Semaphore", "sem"});
+    sem_try_acquire_fn->return_type = "bool";
+    program->functions.push_back(move(sem_try_acquire_fn));
+
+    // fn semaphore_release(Semaphore sem)
+    auto sem_release_fn = make_unique<FunctionDef>();
+    sem_release_fn->name = "semaphore_release";
+    sem_release_fn->visibility = Visibility::Public;
+    sem_release_fn->params.push_back({"Semaphore", "sem"});
+    program->functions.push_back(move(sem_release_fn));
+
     // WaitGroup functions
 
     // fn waitgroup_create() -> WaitGroup
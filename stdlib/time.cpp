@@ -134,6 +134,42 @@
  * print(ts.year, ts.month, ts.day);
  */
 
+/**
+ * @bishop_fn after
+ * @module time
+ * @description Returns a channel that receives one value after a delay:
+ * the milliseconds that actually elapsed. Delays of a second or more may
+ * fire up to about 6% late, so that timers due close together share a wakeup.
+ * @param ms int - Delay in milliseconds
+ * @returns Channel<int> - Channel that receives once
+ * @example
+ * deadline := time.after(500);
+ * select {
+ *     case msg := results.recv() {
+ *         print(msg);
+ *     }
+ *     case deadline.recv() {
+ *         print("timed out");
+ *     }
+ * }
+ */
+
+/**
+ * @bishop_fn ticker
+ * @module time
+ * @description Returns a channel that receives a value every ms
+ * milliseconds, for as long as the channel is in scope: the milliseconds
+ * elapsed since it was made. Ticks the receiver is not ready for are dropped.
+ * @param ms int - Interval in milliseconds
+ * @returns Channel<int> - Channel that receives on every tick
+ * @example
+ * tick := time.ticker(1000);
+ * for i in 0..5 {
+ *     tick.recv();
+ *     print("tick", i);
+ * }
+ */
+
 /**
  * @bishop_method as_millis
  * @type Duration
@@ -387,6 +423,22 @@ unique_ptr<Program> create_time_module() {
     since_fn->return_type = "time.Duration";
     program->functions.push_back(move(since_fn));
 
+    // fn after(int ms) -> Channel<int>
+    auto after_fn = make_unique<FunctionDef>();
+    after_fn->name = "after";
+    after_fn->visibility = Visibility::Public;
+    after_fn->params.push_back({"int", "ms"});
+    after_fn->return_type = "Channel<int>";
+    program->functions.push_back(move(after_fn));
+
+    // fn ticker(int ms) -> Channel<int>
+    auto ticker_fn = make_unique<FunctionDef>();
+    ticker_fn->name = "ticker";
+    ticker_fn->visibility = Visibility::Public;
+    ticker_fn->params.push_back({"int", "ms"});
+    ticker_fn->return_type = "Channel<int>";
+    program->functions.push_back(move(ticker_fn));
+
     // fn parse(str s, str fmt) -> time.Timestamp or err
     auto parse_fn = make_unique<FunctionDef>();
     parse_fn->name = "parse";
@@ -0,0 +1,7 @@
+fn empty_list<T>() -> List<T> {
+    return List<T>();
+}
+
+fn main() {
+    items := empty_list();
+}
@@ -0,0 +1,3 @@
+@hot @cold
+fn spin() {
+}
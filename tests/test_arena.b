@@ -0,0 +1,77 @@
+// ============================================
+// Arena-allocated locals
+// ============================================
+
+fn sum_squares(int n) -> int {
+    squares := List<int>();
+
+    for i in 0..n {
+        squares.append(i * i);
+    }
+
+    total := 0;
+
+    for s in squares {
+        total = total + s;
+    }
+
+    return total;
+}
+
+fn count_words(List<str> words) -> int {
+    counts := {"": 0};
+    counts.remove("");
+
+    for w in words {
+        current := counts.get(w) default 0;
+        counts.set(w, current + 1);
+    }
+
+    return counts.length();
+}
+
+fn escaping_list() -> List<int> {
+    xs := [1, 2, 3];
+    xs.append(4);
+    return xs;
+}
+
+@arena
+fn row_sums(int rows) -> int {
+    total := 0;
+
+    for r in 0..rows {
+        row := [r, r + 1, r + 2];
+        row.append(r * 10);
+        total = total + row.last();
+    }
+
+    return total;
+}
+
+@arena
+fn empty_arena() -> int {
+    return 7;
+}
+
+fn test_arena_list_local() {
+    assert_eq(sum_squares(4), 14);
+}
+
+fn test_arena_map_local() {
+    assert_eq(count_words(["a", "b", "a", "c"]), 3);
+}
+
+fn test_escaping_list_survives_return() {
+    xs := escaping_list();
+    assert_eq(xs.length(), 4);
+    assert_eq(xs.get(3), 4);
+}
+
+fn test_arena_attribute_with_loop_locals() {
+    assert_eq(row_sums(3), 30);
+}
+
+fn test_arena_attribute_without_locals() {
+    assert_eq(empty_arena(), 7);
+}
@@ -0,0 +1,101 @@
+// ============================================
+// Array Creation
+// ============================================
+
+fn test_array_create_with_values() {
+    v := [3]int(10, 20, 30);
+    assert_eq(v.length(), 3);
+    assert_eq(v.get(0), 10);
+    assert_eq(v.get(2), 30);
+}
+
+fn test_array_create_zeroed() {
+    v := [4]int();
+    assert_eq(v.length(), 4);
+    assert_eq(v.get(3), 0);
+}
+
+fn test_array_typed_decl() {
+    [2]str names = [2]str("a", "b");
+    assert_eq(names.first(), "a");
+    assert_eq(names.last(), "b");
+}
+
+// ============================================
+// Array Methods
+// ============================================
+
+fn test_array_set() {
+    v := [3]f64(1.0, 2.0, 3.0);
+    v.set(1, 5.5);
+    assert_eq(v.get(1), 5.5);
+}
+
+fn test_array_contains() {
+    v := [3]int(1, 2, 3);
+    assert_eq(v.contains(2), true);
+    assert_eq(v.contains(7), false);
+}
+
+// ============================================
+// Arrays in Loops
+// ============================================
+
+fn test_array_for_each() {
+    v := [4]int(1, 2, 3, 4);
+    sum := 0;
+
+    for x in v {
+        sum = sum + x;
+    }
+
+    assert_eq(sum, 10);
+}
+
+fn test_array_index_loop() {
+    a := [3]int(1, 2, 3);
+    b := [3]int(4, 5, 6);
+    dot := 0;
+
+    for i in 0..a.length() {
+        dot = dot + a.get(i) * b.get(i);
+    }
+
+    assert_eq(dot, 32);
+}
+
+// ============================================
+// Arrays as Values
+// ============================================
+
+Vec3 :: struct {
+    v [3]f64
+}
+
+fn scale(Vec3 p, f64 k) -> Vec3 {
+    out := [3]f64();
+
+    for i in 0..3 {
+        out.set(i, p.v.get(i) * k);
+    }
+
+    return Vec3 { v: out };
+}
+
+fn test_array_struct_field() {
+    p := Vec3 { v: [3]f64(1.0, 2.0, 3.0) };
+    q := scale(p, 2.0);
+    assert_eq(q.v.get(2), 6.0);
+    assert_eq(p.v.get(2), 3.0);
+}
+
+fn sum3([3]int v) -> int {
+    return v.get(0) + v.get(1) + v.get(2);
+}
+
+fn test_array_param_is_copied() {
+    v := [3]int(1, 2, 3);
+    assert_eq(sum3(v), 6);
+    v.set(0, 10);
+    assert_eq(sum3(v), 15);
+}
@@ -134,6 +134,133 @@ fn test_send_recv() {
     assert_eq(val, 42);
 }
 
+fn test_spawn_copies_loop_variable() {
+    ch := Channel<int>(4);
+
+    for i in 0..4 {
+        go sender(ch, i);
+    }
+
+    total := 0;
+
+    for j in 0..4 {
+        total = total + ch.recv();
+    }
+
+    assert_eq(total, 6);
+}
+
+fn sum_to(Channel<int> ch, int n) {
+    total := 0;
+
+    for i in 0..n {
+        total = total + i;
+    }
+
+    ch.send(total);
+}
+
+fn depth_of(int n) -> int {
+    if n == 0 {
+        return 0;
+    }
+
+    return depth_of(n - 1) + 1;
+}
+
+@deep_stack
+fn recurse(Channel<int> ch, int n) {
+    ch.send(depth_of(n));
+}
+
+fn test_fan_out_fan_in() {
+    // Many short-lived goroutines; with BISHOP_WORKERS > 1 they are
+    // spread across worker threads and must still all report back
+    ch := Channel<int>(8);
+
+    for i in 0..100 {
+        go sum_to(ch, 1000);
+    }
+
+    total := 0;
+
+    for j in 0..100 {
+        total = total + ch.recv();
+    }
+
+    assert_eq(total, 49950000);
+}
+
+fn test_spawn_lambda_with_args() {
+    ch := Channel<int>();
+
+    go fn(int a, int b) {
+        ch.send(a * b);
+    }(6, 7);
+
+    assert_eq(ch.recv(), 42);
+}
+
+// ============================================
+// Unbuffered, Closed and Batched Channels
+// ============================================
+
+fn test_channel_unbuffered() {
+    // Capacity 0: each send waits for a receiver to take the value
+    ch := Channel<int>(0);
+    go sender(ch, 7);
+    assert_eq(ch.recv(), 7);
+}
+
+fn produce(Channel<int> ch, int n) {
+    for i in 0..n {
+        ch.send(i);
+    }
+
+    ch.close();
+}
+
+fn test_channel_for_loop_until_closed() {
+    ch := Channel<int>(4);
+    go produce(ch, 10);
+
+    total := 0;
+    count := 0;
+
+    for x in ch {
+        total = total + x;
+        count = count + 1;
+    }
+
+    assert_eq(count, 10);
+    assert_eq(total, 45);
+}
+
+fn test_channel_recv_after_close() {
+    ch := Channel<int>(2);
+    ch.send(5);
+    ch.close();
+
+    // Values sent before close are still delivered, then zero values
+    assert_eq(ch.recv(), 5);
+    assert_eq(ch.recv(), 0);
+}
+
+fn test_channel_batches() {
+    ch := Channel<int>(16);
+    List<int> items = [1, 2, 3, 4, 5];
+    ch.send_many(items);
+
+    first := ch.recv_many(3);
+    assert_eq(first.length(), 3);
+    assert_eq(first[0], 1);
+    assert_eq(first[2], 3);
+
+    rest := ch.recv_many(10);
+    assert_eq(rest.length(), 2);
+    assert_eq(rest[1], 5);
+}
+
 // ============================================
 // Select Statement
 // ============================================
@@ -163,6 +290,138 @@ fn test_select_recv() {
     assert_eq(selected, 41);
 }
 
+fn test_select_send() {
+    ch := Channel<int>(1);
+    sent := false;
+
+    select {
+        case ch.send(7) {
+            sent = true;
+        }
+    }
+
+    assert_eq(sent, true);
+    assert_eq(ch.recv(), 7);
+}
+
+fn test_select_send_waits_for_room() {
+    ch := Channel<int>(1);
+    ch.send(1);
+
+    go fn(Channel<int> c) {
+        c.recv();
+    }(ch);
+
+    select {
+        case ch.send(2) {
+        }
+    }
+
+    assert_eq(ch.recv(), 2);
+}
+
+fn test_select_default() {
+    ch := Channel<int>();
+    ran_default := false;
+
+    select {
+        case val := ch.recv() {
+            ran_default = false;
+        }
+        default {
+            ran_default = true;
+        }
+    }
+
+    assert_eq(ran_default, true);
+
+    ch.send(5);
+    got := 0;
+
+    select {
+        case val := ch.recv() {
+            got = val;
+        }
+        default {
+            got = -1;
+        }
+    }
+
+    assert_eq(got, 5);
+}
+
+fn test_select_timeout() {
+    ch := Channel<int>();
+    timed_out := false;
+
+    select {
+        case val := ch.recv() {
+            timed_out = false;
+        }
+        timeout(10) {
+            timed_out = true;
+        }
+    }
+
+    assert_eq(timed_out, true);
+}
+
+fn test_select_wakes_before_timeout() {
+    ch := Channel<int>();
+    go sender(ch, 9);
+    got := 0;
+
+    select {
+        case val := ch.recv() {
+            got = val;
+        }
+        timeout(5000) {
+            got = -1;
+        }
+    }
+
+    assert_eq(got, 9);
+}
+
+fn test_select_in_loop() {
+    nums := Channel<int>(4);
+    done := Channel<bool>();
+
+    go fn(Channel<int> n, Channel<bool> d) {
+        n.send(1);
+        n.send(2);
+        n.send(3);
+        d.send(true);
+    }(nums, done);
+
+    total := 0;
+
+    while true {
+        select {
+            case val := nums.recv() {
+                total = total + val;
+                continue;
+            }
+            case fin := done.recv() {
+                while true {
+                    select {
+                        case val := nums.recv() {
+                            total = total + val;
+                        }
+                        default {
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        break;
+    }
+
+    assert_eq(total, 6);
+}
+
 // ============================================
 // Sync test
 // ============================================
@@ -171,3 +430,9 @@ fn test_sync_still_works() {
     x := 1;
     assert_eq(x, 1);
 }
+
+fn test_deep_stack_goroutine() {
+    ch := Channel<int>(1);
+    go recurse(ch, 20000);
+    assert_eq(ch.recv(), 20000);
+}
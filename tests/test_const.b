@@ -141,3 +141,64 @@ fn test_module_const_in_loop() {
 
     assert_eq(sum, 10);
 }
+
+// Tests for compile-time evaluation
+const int MODULE_HALF = MODULE_MAX_SIZE / 2;
+
+fn test_module_const_from_const() {
+    assert_eq(MODULE_HALF, 50);
+}
+
+fn test_const_from_local_consts() {
+    const int WIDTH = 8;
+    const int HEIGHT = WIDTH * 2 + 1;
+    const bool TALL = HEIGHT > WIDTH;
+    assert_eq(HEIGHT, 17);
+    assert_eq(TALL, true);
+}
+
+fn test_const_string_length() {
+    const str GREETING = "Hello" + ", " + "World";
+    const int SIZE = GREETING.length();
+    assert_eq(SIZE, 12);
+}
+
+fn test_const_list_table() {
+    const PRIMES := [2, 3, 5, 7, 11];
+    sum := 0;
+
+    for p in PRIMES {
+        sum = sum + p;
+    }
+
+    assert_eq(sum, 28);
+    assert_eq(PRIMES.length(), 5);
+    assert_eq(PRIMES.get(2), 5);
+    assert_eq(PRIMES.last(), 11);
+    assert_eq(PRIMES.contains(4), false);
+}
+
+fn count_items(List<str> items) -> int {
+    return items.length();
+}
+
+fn test_const_list_passed_along() {
+    const NAMES := ["a", "b", "c"];
+    assert_eq(count_items(NAMES), 3);
+}
+
+fn test_const_map_str_keys() {
+    const STATUS := {"ok": 200, "not_found": 404, "teapot": 418, "error": 500};
+    assert_eq(STATUS.length(), 4);
+    assert_eq(STATUS.contains("teapot"), true);
+    assert_eq(STATUS.contains("missing"), false);
+    assert_eq(STATUS.get("not_found") default 0, 404);
+    assert_eq(STATUS.get("missing") default 0, 0);
+    assert_eq(STATUS.keys().length(), 4);
+}
+
+fn test_const_map_str_values() {
+    const CODES := {"en": "English", "fr": "French"};
+    assert_eq(CODES.get("fr") default "", "French");
+    assert_eq(CODES.values().length(), 2);
+}
@@ -46,3 +46,36 @@ fn test_cause_chain_length() {
         return;
     };
 }
+
+fn fail_literal() -> int or err {
+    fail "literal failure";
+}
+
+fn wrap_literal() -> int or err {
+    x := fail_literal() or fail WrapperError;
+    return x;
+}
+
+fn test_literal_error_as_cause() {
+    for i in 0..3 {
+        result := wrap_literal() or {
+            assert_eq(err.message, "WrapperError");
+            assert_eq(err.cause.message, "literal failure");
+            continue;
+        };
+    }
+}
+
+fn test_repeated_literal_failures() {
+    failures := 0;
+
+    for i in 0..100 {
+        x := fail_literal() or {
+            assert_eq(err.message, "literal failure");
+            failures = failures + 1;
+            continue;
+        };
+    }
+
+    assert_eq(failures, 100);
+}
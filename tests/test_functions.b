@@ -19,3 +19,31 @@ fn test_function_ref_multiply() {
     result := apply_op(3, 4, multiply);
     assert_eq(result, 12);
 }
+
+@hot @inline
+fn square(int x) -> int {
+    return x * x;
+}
+
+@cold @noinline
+fn checked_half(int x) -> int or err {
+    if x < 0 {
+        fail "negative";
+    }
+
+    return x / 2;
+}
+
+fn test_hot_inline_function() {
+    assert_eq(square(7), 49);
+}
+
+fn test_cold_function() -> void or err {
+    half := checked_half(10) or fail err;
+    assert_eq(half, 5);
+}
+
+fn test_cold_function_fails() {
+    half := checked_half(-4) or return;
+    assert_true(false);
+}
@@ -0,0 +1,120 @@
+fn largest<T>(List<T> items) -> T {
+    best := items.get(0);
+
+    for item in items {
+        if item > best {
+            best = item;
+        }
+    }
+
+    return best;
+}
+
+fn map_all<T, U>(List<T> items, fn(T) -> U f) -> List<U> {
+    List<U> out = List<U>();
+
+    for item in items {
+        out.append(f(item));
+    }
+
+    return out;
+}
+
+fn first_or<T>(List<T> items, T fallback) -> T {
+    if items.is_empty() {
+        return fallback;
+    }
+
+    return items.get(0);
+}
+
+fn twice(int x) -> int {
+    return x * 2;
+}
+
+fn describe(int x) -> str {
+    return f"#{x}";
+}
+
+Bag<T> :: struct {
+    items List<T>
+}
+
+Bag<T> :: first(self) -> T {
+    return self.items.get(0);
+}
+
+Bag<T> :: contains(self, T value) -> bool {
+    for item in self.items {
+        if item == value {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+Bag<T> :: size(self) -> int {
+    return self.items.length();
+}
+
+Pair2<K, V> :: struct {
+    key K,
+    value V
+}
+
+fn swap<K, V>(Pair2<K, V> p) -> Pair2<V, K> {
+    return Pair2<V, K> { key: p.value, value: p.key };
+}
+
+fn test_generic_function_int() {
+    assert_eq(largest([3, 9, 4]), 9);
+}
+
+fn test_generic_function_str() {
+    assert_eq(largest(["b", "c", "a"]), "c");
+}
+
+fn test_generic_function_ref_arg() {
+    doubled := map_all([1, 2, 3], twice);
+    assert_eq(doubled.get(2), 6);
+
+    labels := map_all([1, 2], describe);
+    assert_eq(labels.get(1), "#2");
+}
+
+fn test_generic_function_lambda_arg() {
+    lengths := map_all(["a", "bcd"], fn(str s) -> int { return s.length(); });
+    assert_eq(lengths.get(1), 3);
+}
+
+fn test_generic_fallback() {
+    List<str> empty = List<str>();
+    assert_eq(first_or(empty, "none"), "none");
+    assert_eq(first_or([5], 0), 5);
+}
+
+fn test_generic_struct_explicit() {
+    s := Bag<int> { items: [3, 8] };
+    assert_eq(s.first(), 3);
+    assert_eq(s.size(), 2);
+    assert_true(s.contains(8));
+}
+
+fn test_generic_struct_inferred() {
+    names := Bag { items: ["a", "b"] };
+    assert_eq(names.first(), "a");
+    assert_false(names.contains("c"));
+}
+
+fn test_generic_struct_typed_decl() {
+    Bag<f64> s = Bag<f64> { items: [1.5] };
+    assert_eq(s.items.get(0), 1.5);
+}
+
+fn test_generic_struct_two_params() {
+    p := Pair2 { key: "age", value: 42 };
+    q := swap(p);
+    assert_eq(q.key, 42);
+    assert_eq(q.value, "age");
+}
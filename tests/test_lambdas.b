@@ -178,3 +178,49 @@ fn test_immediate_lambda_invocation_multiple_args() {
     result := fn(int a, int b) -> int { return a + b; }(10, 32);
     assert_eq(result, 42);
 }
+
+// ============================================
+// Function Parameters (by reference vs stored)
+// ============================================
+
+fn sum_mapped(List<int> xs, fn(int) -> int f) -> int {
+    total := 0;
+
+    for x in xs {
+        total = total + f(x);
+    }
+
+    return total;
+}
+
+fn keep_op(fn(int) -> int f) -> fn(int) -> int {
+    return f;
+}
+
+fn forward_op(int x, fn(int) -> int f) -> int {
+    return apply_unary(x, f);
+}
+
+fn triple(int x) -> int {
+    return x * 3;
+}
+
+fn test_fn_param_called_in_loop() {
+    offset := 1;
+    result := sum_mapped([1, 2, 3], fn(int x) -> int { return x + offset; });
+    assert_eq(result, 9);
+}
+
+fn test_fn_param_named_function() {
+    assert_eq(sum_mapped([1, 2, 3], triple), 18);
+}
+
+fn test_fn_param_stored_value() {
+    op := fn(int x) -> int { return x * 5; };
+    kept := keep_op(op);
+    assert_eq(kept(2), 10);
+}
+
+fn test_fn_param_forwarded() {
+    assert_eq(forward_op(4, fn(int x) -> int { return x - 1; }), 3);
+}
@@ -179,3 +179,94 @@ fn test_list_chained_append() {
     assert_eq(nums.first(), 1);
     assert_eq(nums.last(), 3);
 }
+
+// ============================================
+// Indexing in Loops
+// ============================================
+
+fn sum_by_index(List<int> nums) -> int {
+    total := 0;
+
+    for i in 0..nums.length() {
+        total = total + nums.get(i);
+    }
+
+    return total;
+}
+
+fn test_list_index_in_range_loop() {
+    assert_eq(sum_by_index([1, 2, 3, 4]), 10);
+    assert_eq(sum_by_index(List<int>()), 0);
+}
+
+fn test_list_index_nested_loops() {
+    a := [1, 2, 3];
+    b := [10, 20];
+    total := 0;
+
+    for i in 0..a.length() {
+        for j in 0..b.length() {
+            total = total + a.get(i) * b.get(j);
+        }
+    }
+
+    assert_eq(total, 180);
+}
+
+fn test_list_index_loop_growing_list() {
+    nums := [1, 2];
+
+    for i in 1..nums.length() {
+        if nums.length() < 5 {
+            nums.append(nums.get(i) + 1);
+        }
+    }
+
+    assert_eq(nums.length(), 5);
+    assert_eq(nums.get(4), 5);
+}
+
+fn test_list_index_loop_shrinking_list() {
+    nums := [1, 2, 3, 4];
+    seen := 0;
+
+    for i in 0..nums.length() {
+        seen = seen + nums.get(i);
+        nums.pop();
+    }
+
+    assert_eq(seen, 3);
+}
+
+// ============================================
+// Last-use Hand-offs
+// ============================================
+
+fn with_sentinel(List<int> nums) -> List<int> {
+    out := nums;
+    out.append(-1);
+    return out;
+}
+
+fn test_list_handoff_last_use() {
+    nums := [1, 2, 3];
+    out := with_sentinel(nums);
+    assert_eq(out.length(), 4);
+    assert_eq(out.last(), -1);
+}
+
+fn test_list_handoff_keeps_earlier_copy() {
+    nums := [1, 2];
+    copy := nums;
+    nums.append(3);
+    assert_eq(copy.length(), 2);
+    assert_eq(nums.length(), 3);
+}
+
+fn test_list_handoff_into_nested_list() {
+    row := [1, 2];
+    grid := List<List<int>>();
+    grid.append(row);
+    assert_eq(grid.length(), 1);
+    assert_eq(grid.first().length(), 2);
+}
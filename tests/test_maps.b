@@ -227,3 +227,50 @@ fn test_map_typed_empty() {
     Map<str, str> config = Map<str, str>();
     assert_eq(config.is_empty(), true);
 }
+
+// ============================================
+// Growth and Removal
+// ============================================
+
+fn test_map_grows_past_many_entries() {
+    squares := Map<int, int>();
+    for i in 0..1000 {
+        squares.set(i, i * i);
+    }
+
+    assert_eq(squares.length(), 1000);
+    assert_eq(squares.get(0) default -1, 0);
+    assert_eq(squares.get(999) default -1, 998001);
+    assert_eq(squares.contains(1000), false);
+}
+
+fn test_map_remove_and_reinsert() {
+    m := Map<int, int>();
+    for round in 0..20 {
+        for i in 0..100 {
+            m.set(i, round);
+        }
+        for i in 0..100 {
+            m.remove(i);
+        }
+    }
+
+    assert_eq(m.is_empty(), true);
+    m.set(42, 7);
+    assert_eq(m.get(42) default 0, 7);
+    assert_eq(m.length(), 1);
+}
+
+fn test_map_long_string_keys() {
+    counts := Map<str, int>();
+    key := "prefix-";
+    for i in 0..50 {
+        key = key + "x";
+        counts.set(key, i);
+    }
+
+    assert_eq(counts.length(), 50);
+    assert_eq(counts.get("prefix-x") default -1, 0);
+    assert_eq(counts.get(key) default -1, 49);
+    assert_eq(counts.contains("prefix-"), false);
+}
@@ -640,3 +640,12 @@ fn test_acos_out_of_range() {
     assert_eq(true, math.is_nan(result));
 }
 
+
+fn test_const_folded_math_calls() {
+    const int G = math.gcd(12, 18);
+    const int L = math.lcm(4, 6);
+    const int C = math.clamp_int(math.abs_int(-15), 0, 10);
+    assert_eq(G, 6);
+    assert_eq(L, 12);
+    assert_eq(C, 10);
+}
@@ -0,0 +1,24 @@
+// ============================================
+// Print / Flush Tests
+// ============================================
+
+fn test_print_mixed_values() {
+    print("int:", 42, " float:", 3.5, " bool:", true);
+}
+
+fn test_print_many_lines() {
+    i := 0;
+
+    while i < 1000 {
+        print("line ", i);
+        i = i + 1;
+    }
+
+    assert_eq(i, 1000);
+}
+
+fn test_flush() {
+    print("before flush");
+    flush();
+    print("after flush");
+}
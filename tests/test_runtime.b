@@ -0,0 +1,79 @@
+// Tests for the runtime module
+
+import runtime;
+
+fn report(Channel<int> ch, int n) {
+    ch.send(n);
+}
+
+fn test_core_count() {
+    assert_true(runtime.core_count() >= 1);
+}
+
+fn test_core_id_in_range() {
+    id := runtime.core_id();
+    assert_true(id >= 0);
+    assert_true(id < runtime.core_count());
+}
+
+fn test_spawn_counted() {
+    before := runtime.stats();
+    ch := Channel<int>(4);
+
+    go report(ch, 1);
+    go report(ch, 2);
+    go report(ch, 3);
+
+    total := ch.recv() + ch.recv() + ch.recv();
+    assert_eq(total, 6);
+
+    after := runtime.stats();
+    assert_eq(after.spawned - before.spawned, 3);
+}
+
+fn test_live_never_exceeds_spawned() {
+    s := runtime.stats();
+    assert_true(s.live <= s.spawned);
+    assert_true(s.finished <= s.spawned);
+}
+
+fn test_core_stats_out_of_range() {
+    s := runtime.core_stats(runtime.core_count());
+    assert_eq(s.spawned, 0);
+}
+
+fn test_dump_lists_totals() {
+    text := runtime.dump();
+    assert_true(text.contains("total"));
+}
+
+fn test_stall_counters_consistent() {
+    s := runtime.stats();
+    assert_true(s.stalls >= 0);
+    assert_true(s.longest_stall_ms <= s.stall_ms);
+    assert_true(runtime.dump().contains("stalls"));
+}
+
+fn test_spawn_blocking_runs_function() {
+    total := 0;
+    runtime.spawn_blocking(fn() {
+        for i in 0..1000 {
+            total = total + i;
+        }
+    });
+    assert_eq(total, 499500);
+}
+
+fn test_spawn_blocking_lets_goroutines_run() {
+    ch := Channel<int>(1);
+    got := 0;
+
+    // The goroutine only runs if the scheduler is free while f blocks
+    go report(ch, 7);
+
+    runtime.spawn_blocking(fn() {
+        got = ch.recv();
+    });
+
+    assert_eq(got, 7);
+}
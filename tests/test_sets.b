@@ -387,3 +387,34 @@ fn test_set_chained_operations() {
     assert_eq(common.contains(4), true);
     assert_eq(common.contains(5), true);
 }
+
+// ============================================
+// Growth and Removal
+// ============================================
+
+fn test_set_grows_past_many_elements() {
+    evens := Set<int>();
+    for i in 0..2000 {
+        evens.add(i * 2);
+    }
+
+    assert_eq(evens.length(), 2000);
+    assert_eq(evens.contains(3998), true);
+    assert_eq(evens.contains(3), false);
+}
+
+fn test_set_remove_and_readd() {
+    nums := Set<int>();
+    for round in 0..20 {
+        for i in 0..100 {
+            nums.add(i);
+        }
+        for i in 0..100 {
+            nums.remove(i);
+        }
+    }
+
+    assert_eq(nums.is_empty(), true);
+    nums.add(5);
+    assert_eq(nums.contains(5), true);
+}
@@ -0,0 +1,157 @@
+@soa
+Particle :: struct {
+    alive bool,
+    x f64,
+    id int,
+    vx f64
+}
+
+Particle :: speed(self) -> f64 {
+    return self.vx;
+}
+
+fn make_particle(int id) -> Particle {
+    return Particle { alive: true, x: 0.0, id: id, vx: 1.5 };
+}
+
+Counter :: struct {
+    n int
+}
+
+Counter :: next_id(self) -> int {
+    self.n = self.n + 1;
+    return self.n;
+}
+
+Counter :: next_speed(self) -> f64 {
+    self.n = self.n + 1;
+
+    if self.n == 2 {
+        return 2.0;
+    }
+
+    return 1.0;
+}
+
+// ============================================
+// SoaList Creation
+// ============================================
+
+fn test_soa_list_create() {
+    ps := SoaList<Particle>();
+    assert_eq(ps.length(), 0);
+    assert_eq(ps.is_empty(), true);
+}
+
+fn test_soa_list_typed_decl() {
+    SoaList<Particle> ps = SoaList<Particle>();
+    ps.append(make_particle(7));
+    assert_eq(ps.length(), 1);
+}
+
+// ============================================
+// SoaList Methods
+// ============================================
+
+fn test_soa_list_append_get() {
+    ps := SoaList<Particle>();
+    ps.append(Particle { alive: true, x: 1.0, id: 1, vx: 2.0 });
+    ps.append(Particle { alive: false, x: 3.0, id: 2, vx: 4.0 });
+
+    p := ps.get(1);
+    assert_eq(p.alive, false);
+    assert_eq(p.x, 3.0);
+    assert_eq(p.id, 2);
+    assert_eq(p.speed(), 4.0);
+}
+
+fn test_soa_list_set() {
+    ps := SoaList<Particle>();
+    ps.append(make_particle(1));
+    ps.set(0, Particle { alive: false, x: 9.0, id: 5, vx: 0.0 });
+    assert_eq(ps.get(0).id, 5);
+    assert_eq(ps.first().x, 9.0);
+}
+
+fn test_soa_list_pop_remove_clear() {
+    ps := SoaList<Particle>();
+    ps.append(make_particle(1));
+    ps.append(make_particle(2));
+    ps.append(make_particle(3));
+
+    last := ps.pop();
+    assert_eq(last.id, 3);
+
+    ps.remove(0);
+    assert_eq(ps.length(), 1);
+    assert_eq(ps.last().id, 2);
+
+    ps.clear();
+    assert_eq(ps.is_empty(), true);
+}
+
+// ============================================
+// Field-wise Loops
+// ============================================
+
+fn test_soa_list_loop_updates_columns() {
+    ps := SoaList<Particle>();
+
+    for i in 0..4 {
+        ps.append(make_particle(i));
+    }
+
+    for p in ps {
+        p.x = p.x + p.vx * 2.0;
+    }
+
+    assert_eq(ps.get(0).x, 3.0);
+    assert_eq(ps.get(3).x, 3.0);
+}
+
+fn test_soa_list_loop_reads() {
+    ps := SoaList<Particle>();
+    ps.append(Particle { alive: true, x: 1.0, id: 1, vx: 0.0 });
+    ps.append(Particle { alive: false, x: 2.0, id: 2, vx: 0.0 });
+    ps.append(Particle { alive: true, x: 4.0, id: 3, vx: 0.0 });
+
+    total := 0.0;
+
+    for p in ps {
+        if p.alive {
+            total = total + p.x;
+        }
+    }
+
+    assert_eq(total, 5.0);
+}
+
+fn test_soa_list_loop_element_copy() {
+    ps := SoaList<Particle>();
+    ps.append(make_particle(1));
+
+    for p in ps {
+        copy := p;
+        copy.x = 100.0;
+        assert_eq(copy.speed(), 1.5);
+    }
+
+    assert_eq(ps.get(0).x, 0.0);
+}
+
+// ============================================
+// Field Ordering
+// ============================================
+
+fn test_struct_literal_any_field_order() {
+    p := Particle { vx: 2.5, id: 4, x: 1.0, alive: true };
+    assert_eq(p.id, 4);
+    assert_eq(p.vx, 2.5);
+}
+
+fn test_struct_literal_calls_run_in_order() {
+    counter := Counter { n: 0 };
+    p := Particle { alive: true, x: 0.0, id: counter.next_id(), vx: counter.next_speed() };
+    assert_eq(p.id, 1);
+    assert_eq(p.vx, 2.0);
+}
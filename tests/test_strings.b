@@ -88,6 +88,29 @@ fn test_str_concat_variables() {
     assert_eq(c, "foobar");
 }
 
+fn greeting(str name) -> str {
+    return "hi " + name;
+}
+
+fn test_str_concat_chain() {
+    code := "200";
+    text := "OK";
+    line := "HTTP/1.1 " + code + " " + text + "\r\n";
+    assert_eq(line, "HTTP/1.1 200 OK\r\n");
+}
+
+fn test_str_concat_parens_and_calls() {
+    a := "x";
+    s := greeting("bob") + (a + "-" + a) + "!";
+    assert_eq(s, "hi bobx-x!");
+}
+
+fn test_str_concat_reassign() {
+    s := "a";
+    s = s + "b" + s;
+    assert_eq(s, "aba");
+}
+
 fn test_single_quoted_string() {
     s := 'hello';
     assert_eq(s, "hello");
@@ -265,3 +288,46 @@ fn test_raw_string_concat() {
     c := a + b;
     assert_eq(c, "hello\\nworld\\n");
 }
+
+// f-string tests (f"...")
+
+fn test_fstring_basic() {
+    name := "Ada";
+    age := 36;
+    s := f"{name} is {age} years old";
+    assert_eq(s, "Ada is 36 years old");
+}
+
+fn test_fstring_no_placeholders() {
+    s := f"plain";
+    assert_eq(s, "plain");
+}
+
+fn test_fstring_expressions() {
+    xs := [1, 2, 3];
+    s := f"{xs.length()} items, first {xs.get(0) + 10}, {greeting("al")}";
+    assert_eq(s, "3 items, first 11, hi al");
+}
+
+fn test_fstring_matches_print_formatting() {
+    s := f"{1.5} {0.1 + 0.2} {true} {false}";
+    assert_eq(s, "1.5 0.3 1 0");
+}
+
+fn test_fstring_specs() {
+    price := 3.14159;
+    flags := 255;
+    label := "ab";
+    assert_eq(f"{price:.2f}", "3.14");
+    assert_eq(f"[{price:>8.3f}]", "[   3.142]");
+    assert_eq(f"{flags:x} {flags:X} {flags:b} {flags:o}", "ff FF 11111111 377");
+    assert_eq(f"{flags:0>6x}", "0000ff");
+    assert_eq(f"[{label:<4}][{label:>4}][{label:*^6}]", "[ab  ][  ab][**ab**]");
+    assert_eq(f"[{flags:5}]", "[  255]");
+}
+
+fn test_fstring_braces_and_escapes() {
+    x := 7;
+    s := f"{{x}} = {x}\n";
+    assert_eq(s, "{x} = 7\n");
+}
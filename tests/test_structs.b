@@ -101,3 +101,16 @@ fn test_method_on_different_instances() {
     assert_eq(p1.is_adult(), true);
     assert_eq(p2.is_adult(), false);
 }
+
+fn test_struct_literal_takes_last_use() {
+    name := "Dana";
+    p := Person { name: name, age: 40 };
+    assert_eq(p.name, "Dana");
+}
+
+fn test_struct_literal_keeps_later_use() {
+    name := "Dana";
+    p := Person { name: name, age: 40 };
+    assert_eq(name, "Dana");
+    assert_eq(p.name, name);
+}
@@ -37,6 +37,93 @@ fn test_mutex_relock() {
     sync.mutex_unlock(mtx);
 }
 
+fn test_mutex_parks_goroutine() {
+    mtx := sync.mutex_create();
+    ch := Channel<int>(1);
+    sync.mutex_lock(mtx);
+
+    go fn() {
+        sync.mutex_lock(mtx);
+        ch.send(1);
+        sync.mutex_unlock(mtx);
+    }();
+
+    // A waiter that blocked its thread would never let this resume
+    sleep(10);
+    sync.mutex_unlock(mtx);
+    assert_eq(ch.recv(), 1);
+}
+
+fn test_mutex_lock_timeout() {
+    mtx := sync.mutex_create();
+    assert_eq(true, sync.mutex_lock_timeout(mtx, 10));
+    assert_eq(false, sync.mutex_lock_timeout(mtx, 10));
+    sync.mutex_unlock(mtx);
+}
+
+// ============================================
+// RWMutex Tests
+// ============================================
+
+fn test_rwmutex_shared_readers() {
+    rw := sync.rwmutex_create();
+    sync.rwmutex_rlock(rw);
+    sync.rwmutex_rlock(rw);
+    sync.rwmutex_runlock(rw);
+    sync.rwmutex_runlock(rw);
+    sync.rwmutex_lock(rw);
+    sync.rwmutex_unlock(rw);
+}
+
+fn test_rwmutex_writer_waits_for_readers() {
+    rw := sync.rwmutex_create();
+    written := sync.atomic_int_create(0);
+    ch := Channel<int>(1);
+    sync.rwmutex_rlock(rw);
+
+    go fn() {
+        sync.rwmutex_lock(rw);
+        sync.atomic_int_store(written, 1);
+        sync.rwmutex_unlock(rw);
+        ch.send(1);
+    }();
+
+    sleep(10);
+    assert_eq(0, sync.atomic_int_load(written));
+
+    sync.rwmutex_runlock(rw);
+    ch.recv();
+    assert_eq(1, sync.atomic_int_load(written));
+}
+
+// ============================================
+// Semaphore Tests
+// ============================================
+
+fn test_semaphore_permits() {
+    sem := sync.semaphore_create(2);
+    assert_eq(true, sync.semaphore_try_acquire(sem));
+    assert_eq(true, sync.semaphore_try_acquire(sem));
+    assert_eq(false, sync.semaphore_try_acquire(sem));
+
+    sync.semaphore_release(sem);
+    assert_eq(true, sync.semaphore_try_acquire(sem));
+}
+
+fn test_semaphore_acquire_parks() {
+    sem := sync.semaphore_create(0);
+    ch := Channel<int>(1);
+
+    go fn() {
+        sync.semaphore_acquire(sem);
+        ch.send(1);
+    }();
+
+    sleep(10);
+    sync.semaphore_release(sem);
+    assert_eq(ch.recv(), 1);
+}
+
 // ============================================
 // WaitGroup Tests
 // ============================================
@@ -72,6 +159,23 @@ fn test_waitgroup_add_wait() {
     sync.waitgroup_wait(wg);
 }
 
+fn test_waitgroup_waits_for_goroutines() {
+    wg := sync.waitgroup_create();
+    count := sync.atomic_int_create(0);
+    sync.waitgroup_add(wg, 3);
+
+    for i in 0..3 {
+        go fn() {
+            sleep(5);
+            sync.atomic_int_add(count, 1);
+            sync.waitgroup_done(wg);
+        }();
+    }
+
+    sync.waitgroup_wait(wg);
+    assert_eq(3, sync.atomic_int_load(count));
+}
+
 // ============================================
 // Once Tests
 // ============================================
@@ -328,3 +328,51 @@ fn test_measure_elapsed() {
     elapsed := time.now() - start;
     assert_eq(true, elapsed.as_millis() >= 50);
 }
+
+// ============================================================
+// Tests for timer channels
+// ============================================================
+
+fn test_after_fires_once() {
+    start := time.now();
+    ch := time.after(30);
+    elapsed := ch.recv();
+
+    assert_eq(true, elapsed >= 30);
+    assert_eq(true, time.since(start).as_millis() >= 30);
+}
+
+fn test_after_in_select() {
+    never := Channel<int>();
+    deadline := time.after(20);
+    chosen := 0;
+
+    select {
+        case val := never.recv() {
+            chosen = 1;
+        }
+        case deadline.recv() {
+            chosen = 2;
+        }
+    }
+
+    assert_eq(2, chosen);
+}
+
+fn test_ticker_ticks_repeatedly() {
+    tick := time.ticker(10);
+    first := tick.recv();
+    second := tick.recv();
+    third := tick.recv();
+
+    assert_eq(true, first >= 10);
+    assert_eq(true, second > first);
+    assert_eq(true, third > second);
+    assert_eq(true, third >= 30);
+}
+
+fn test_sleep_waits_full_duration() {
+    start := time.now();
+    sleep(25);
+    assert_eq(true, time.since(start).as_millis() >= 25);
+}
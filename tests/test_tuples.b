@@ -155,3 +155,29 @@ fn test_tuple_in_loop() {
 
     assert_eq(sum, 15);
 }
+
+// ============================================
+// Tuple Reassignment and Parameters
+// ============================================
+
+fn tuple_sum(Tuple<int> t) -> int {
+    sum := 0;
+
+    for i in 0..5 {
+        sum = sum + (t.get(i) default 0);
+    }
+
+    return sum;
+}
+
+fn test_tuple_reassigned_to_other_arity() {
+    t := Tuple<int>(1, 2);
+    t = Tuple<int>(1, 2, 3, 4);
+    assert_eq(t.get(3) default 0, 4);
+    assert_eq(t.get(4) default 99, 99);
+}
+
+fn test_tuple_passed_as_param() {
+    assert_eq(tuple_sum(Tuple<int>(1, 2)), 3);
+    assert_eq(tuple_sum(Tuple<int>(1, 2, 3, 4, 5)), 15);
+}
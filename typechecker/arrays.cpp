@@ -0,0 +1,104 @@
+/**
+ * @file arrays.cpp
+ * @brief Fixed-size array method type definitions for the Bishop type checker.
+ *
+ * Defines type signatures for all built-in [N]T methods.
+ * Uses "T" as a placeholder for the element type, which is
+ * substituted with the actual type at type check time.
+ */
+
+/**
+ * @bishop_method length
+ * @type [N]T
+ * @description Returns the number of elements in the array, which is always N.
+ * @returns int - The array length
+ * @example
+ * v := [3]int(1, 2, 3);
+ * len := v.length();  // 3
+ */
+
+/**
+ * @bishop_method get
+ * @type [N]T
+ * @description Returns the element at the specified index (bounds-checked).
+ * @param index int - The index (0-based)
+ * @returns T - The element at that position
+ * @example
+ * v := [3]int(10, 20, 30);
+ * val := v.get(1);  // 20
+ */
+
+/**
+ * @bishop_method set
+ * @type [N]T
+ * @description Replaces the element at the specified index (bounds-checked).
+ * @param index int - The index (0-based)
+ * @param value T - The new value
+ * @example
+ * v := [3]int(1, 2, 3);
+ * v.set(1, 99);  // v is now [3]int(1, 99, 3)
+ */
+
+/**
+ * @bishop_method first
+ * @type [N]T
+ * @description Returns the first element of the array.
+ * @returns T - The first element
+ * @example
+ * v := [3]int(1, 2, 3);
+ * x := v.first();  // 1
+ */
+
+/**
+ * @bishop_method last
+ * @type [N]T
+ * @description Returns the last element of the array.
+ * @returns T - The last element
+ * @example
+ * v := [3]int(1, 2, 3);
+ * x := v.last();  // 3
+ */
+
+/**
+ * @bishop_method contains
+ * @type [N]T
+ * @description Checks if the array contains the given element.
+ * @param elem T - The element to search for
+ * @returns bool - True if found, false otherwise
+ * @example
+ * v := [3]int(1, 2, 3);
+ * found := v.contains(2);  // true
+ */
+
+#include "arrays.hpp"
+
+#include <map>
+
+namespace bishop {
+
+std::optional<ArrayMethodInfo> get_array_method_info(const std::string& method_name) {
+    // "T" is placeholder for element type, substituted at type check time
+    static const std::map<std::string, ArrayMethodInfo> array_methods = {
+        // Query methods
+        {"length", {{}, "int"}},
+        {"contains", {{"T"}, "bool"}},
+
+        // Access methods
+        {"get", {{"int"}, "T"}},
+        {"first", {{}, "T"}},
+        {"last", {{}, "T"}},
+
+        // Modification methods
+        {"set", {{"int", "T"}, "void"}},
+    };
+
+    auto it = array_methods.find(method_name);
+
+    if (it != array_methods.end()) {
+        return it->second;
+    }
+
+    return std::nullopt;
+}
+
+}  // namespace bishop
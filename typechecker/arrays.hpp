@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <optional>
+
+namespace bishop {
+
+/**
+ * Represents an array method signature with parameter types and return type.
+ * Uses "T" as a placeholder for the element type.
+ */
+struct ArrayMethodInfo {
+    std::vector<std::string> param_types;
+    std::string return_type;
+};
+
+/**
+ * Returns type information for built-in fixed-size array methods.
+ * Returns nullopt if the method is not found.
+ */
+std::optional<ArrayMethodInfo> get_array_method_info(const std::string& method_name);
+
+}  // namespace bishop
@@ -0,0 +1,88 @@
+/**
+ * @file check_array.cpp
+ * @brief Fixed-size array type inference for the Bishop type checker.
+ */
+
+#include "typechecker.hpp"
+#include "arrays.hpp"
+
+using namespace std;
+
+namespace typechecker {
+
+/**
+ * Infers the type of an array creation expression. An array is either
+ * value-initialized ([N]T()) or given exactly N elements.
+ */
+TypeInfo check_array_create(TypeCheckerState& state, const ArrayCreate& array) {
+    string type = "[" + to_string(array.size) + "]" + array.element_type;
+
+    if (array.size == 0) {
+        error(state, "array size must be at least 1", array.line);
+    }
+
+    if (!is_valid_type(state, array.element_type)) {
+        error(state, "unknown array element type '" + array.element_type + "'", array.line);
+        return {"unknown", false, false};
+    }
+
+    if (!array.elements.empty() && array.elements.size() != array.size) {
+        error(state, "array '" + type + "' expects " + to_string(array.size) +
+              " elements, got " + to_string(array.elements.size()), array.line);
+    }
+
+    TypeInfo expected_type = {array.element_type, false, false};
+
+    for (size_t i = 0; i < array.elements.size(); i++) {
+        TypeInfo elem_type = infer_type(state, *array.elements[i]);
+
+        if (!types_compatible(expected_type, elem_type)) {
+            error(state, "array element " + to_string(i) + " type mismatch: expected '" +
+                  array.element_type + "', got '" + format_type(elem_type) + "'", array.line);
+        }
+    }
+
+    return {type, false, false};
+}
+
+/**
+ * Type checks a method call on a fixed-size array.
+ */
+TypeInfo check_array_method(TypeCheckerState& state, const MethodCall& mcall, const string& element_type) {
+    auto method_info = bishop::get_array_method_info(mcall.method_name);
+
+    if (!method_info) {
+        error(state, "array has no method '" + mcall.method_name + "'", mcall.line);
+        return {"unknown", false, false};
+    }
+
+    const auto& [param_types, return_type] = *method_info;
+
+    if (mcall.args.size() != param_types.size()) {
+        error(state, "method '" + mcall.method_name + "' expects " +
+              to_string(param_types.size()) + " arguments, got " +
+              to_string(mcall.args.size()), mcall.line);
+    }
+
+    for (size_t i = 0; i < mcall.args.size() && i < param_types.size(); i++) {
+        TypeInfo arg_type = infer_type(state, *mcall.args[i]);
+        string expected = param_types[i] == "T" ? element_type : param_types[i];
+        TypeInfo expected_type = {expected, false, false};
+
+        if (!types_compatible(expected_type, arg_type)) {
+            error(state, "argument " + to_string(i + 1) + " of method '" +
+                  mcall.method_name + "' expects '" + expected +
+                  "', got '" + format_type(arg_type) + "'", mcall.line);
+        }
+    }
+
+    string ret = return_type == "T" ? element_type : return_type;
+
+    if (ret == "void") {
+        return {"void", false, true};
+    }
+
+    return {ret, false, false};
+}
+
+} // namespace typechecker
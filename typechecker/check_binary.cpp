@@ -22,6 +22,7 @@ TypeInfo check_binary_expr(TypeCheckerState& state, const BinaryExpr& bin) {
     }
 
     if (bin.op == "+" && left_type.base_type == "str" && right_type.base_type == "str") {
+        bin.str_concat = true;
         return {"str", false, false};
     }
 
@@ -108,6 +109,11 @@ TypeInfo check_address_of(TypeCheckerState& state, const AddressOf& addr) {
         return {"unknown", false, false};
     }
 
+    if (is_soa_element(state, *addr.value)) {
+        error(state, "cannot take address of a SoaList element; copy it with get() first", addr.line);
+        return {"unknown", false, false};
+    }
+
     // Only allow pointers to struct types, not primitives
     if (is_primitive_type(inner_type.base_type)) {
         error(state, "cannot take address of primitive type '" + format_type(inner_type) +
@@ -53,6 +53,39 @@ TypeInfo check_channel_method(TypeCheckerState& state, const MethodCall& mcall,
         }
 
         return {element_type, false, false};
+    } else if (mcall.method_name == "close") {
+        if (!mcall.args.empty()) {
+            error(state, "Channel.close expects 0 arguments, got " + to_string(mcall.args.size()), mcall.line);
+        }
+
+        return {"void", false, true};
+    } else if (mcall.method_name == "send_many") {
+        string list_type = "List<" + element_type + ">";
+
+        if (mcall.args.size() != 1) {
+            error(state, "Channel.send_many expects 1 argument, got " + to_string(mcall.args.size()), mcall.line);
+        } else {
+            TypeInfo arg_type = infer_type(state, *mcall.args[0]);
+            TypeInfo expected = {list_type, false, false};
+
+            if (!types_compatible(expected, arg_type)) {
+                error(state, "Channel.send_many expects '" + list_type + "', got '" + format_type(arg_type) + "'", mcall.line);
+            }
+        }
+
+        return {"void", false, true};
+    } else if (mcall.method_name == "recv_many") {
+        if (mcall.args.size() != 1) {
+            error(state, "Channel.recv_many expects 1 argument, got " + to_string(mcall.args.size()), mcall.line);
+        } else {
+            TypeInfo arg_type = infer_type(state, *mcall.args[0]);
+
+            if (arg_type.base_type != "int") {
+                error(state, "Channel.recv_many expects 'int', got '" + format_type(arg_type) + "'", mcall.line);
+            }
+        }
+
+        return {"List<" + element_type + ">", false, false};
     } else {
         error(state, "Channel has no method '" + mcall.method_name + "'", mcall.line);
         return {"unknown", false, false};
@@ -27,6 +27,10 @@ TypeInfo infer_type(TypeCheckerState& state, const ASTNode& expr) {
         return check_string_literal(state, *str);
     }
 
+    if (auto* fstr = dynamic_cast<const FormatString*>(&expr)) {
+        return check_format_string(state, *fstr);
+    }
+
     if (auto* bl = dynamic_cast<const BoolLiteral*>(&expr)) {
         return check_bool_literal(state, *bl);
     }
@@ -103,6 +107,10 @@ TypeInfo infer_type(TypeCheckerState& state, const ASTNode& expr) {
         return check_tuple_create(state, *tuple);
     }
 
+    if (auto* array = dynamic_cast<const ArrayCreate*>(&expr)) {
+        return check_array_create(state, *array);
+    }
+
     if (auto* deque = dynamic_cast<const DequeCreate*>(&expr)) {
         return check_deque_create(state, *deque);
     }
@@ -127,6 +135,10 @@ TypeInfo infer_type(TypeCheckerState& state, const ASTNode& expr) {
         return check_set_literal(state, *set);
     }
 
+    if (auto* soa = dynamic_cast<const SoaListCreate*>(&expr)) {
+        return check_soa_list_create(state, *soa);
+    }
+
     if (auto* lambda = dynamic_cast<const LambdaExpr*>(&expr)) {
         return check_lambda_expr(state, *lambda);
     }
@@ -93,7 +93,7 @@ TypeInfo check_field_access(TypeCheckerState& state, const FieldAccess& access)
 
     for (const auto& field : sdef->fields) {
         if (field.name == access.field_name) {
-            return {field.type, false, false};
+            return {struct_member_type(sdef->type_params, struct_type, field.type), false, false};
         }
     }
 
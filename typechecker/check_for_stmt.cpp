@@ -4,6 +4,7 @@
  */
 
 #include "typechecker.hpp"
+#include "common/type_utils.hpp"
 
 using namespace std;
 
@@ -53,19 +54,56 @@ void check_for_stmt(TypeCheckerState& state, const ForStmt& for_stmt) {
             } else {
                 loop_var_type = {element_type, false, false};
             }
+        } else if (iter_type.base_type.rfind("SoaList<", 0) == 0) {
+            string element_type = extract_element_type(iter_type.base_type, "SoaList<");
+
+            if (element_type.empty()) {
+                error(state, "malformed SoaList type '" + iter_type.base_type + "' in for-each loop", for_stmt.line);
+            } else {
+                loop_var_type = {element_type, false, false};
+            }
+        } else if (iter_type.base_type.rfind("Channel<", 0) == 0) {
+            // Receives until the channel is closed and drained
+            string element_type = extract_element_type(iter_type.base_type, "Channel<");
+
+            if (element_type.empty()) {
+                error(state, "malformed Channel type '" + iter_type.base_type + "' in for-each loop", for_stmt.line);
+            } else {
+                loop_var_type = {element_type, false, false};
+            }
+        } else if (iter_type.base_type.rfind("[", 0) == 0) {
+            auto [size, element_type] = bishop::extract_array_type(iter_type.base_type);
+
+            if (element_type.empty()) {
+                error(state, "malformed array type '" + iter_type.base_type + "' in for-each loop", for_stmt.line);
+            } else {
+                loop_var_type = {element_type, false, false};
+            }
         } else {
-            error(state, "for-each requires a List or Set, got '" + format_type(iter_type) + "'", for_stmt.line);
+            error(state, "for-each requires a List, Set, SoaList, Channel or array, got '" + format_type(iter_type) + "'", for_stmt.line);
         }
+
+        for_stmt.iterable_type = iter_type.base_type;
     }
 
     push_scope(state);  // for-statement scope (holds the loop variable)
     declare_local(state, for_stmt.loop_var, loop_var_type, for_stmt.line);
 
+    // SoaList elements are bound as references into the columns
+    const TypeInfo* soa_element = nullptr;
+
+    if (for_stmt.iterable_type.rfind("SoaList<", 0) == 0) {
+        soa_element = lookup_local(state, for_stmt.loop_var);
+        state.soa_elements.insert(soa_element);
+    }
+
     push_scope(state);  // body block scope
     for (const auto& s : for_stmt.body) {
         check_statement(state, *s);
     }
     pop_scope(state);
+
+    state.soa_elements.erase(soa_element);
     pop_scope(state);
 }
 
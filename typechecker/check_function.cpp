@@ -47,6 +47,7 @@ void check_method(TypeCheckerState& state, const MethodDef& method) {
     state.local_scopes.clear();
     push_scope(state);  // method scope (parameters + body)
     state.current_struct = method.struct_name;  // Track struct for static method resolution
+    state.type_params = method.type_params;
     state.current_function_is_fallible = !method.error_type.empty();
 
     if (method.return_type.empty()) {
@@ -72,6 +73,7 @@ void check_method(TypeCheckerState& state, const MethodDef& method) {
     }
 
     state.current_struct.clear();
+    state.type_params.clear();
 }
 
 /**
@@ -83,6 +85,7 @@ void check_function(TypeCheckerState& state, const FunctionDef& func) {
     state.current_struct.clear();
     state.current_function_is_fallible = !func.error_type.empty();
     state.in_main = (func.name == "main");
+    state.type_params = func.type_params;
 
     if (func.return_type.empty()) {
         state.current_return = {"void", false, true};
@@ -105,6 +108,8 @@ void check_function(TypeCheckerState& state, const FunctionDef& func) {
     if (!func.return_type.empty() && func.return_type != "void" && !has_return(func.body)) {
         error(state, "function '" + func.name + "' must return a value of type '" + func.return_type + "'", func.line);
     }
+
+    state.type_params.clear();
 }
 
 } // namespace typechecker
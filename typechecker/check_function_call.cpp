@@ -218,6 +218,14 @@ TypeInfo check_function_call(TypeCheckerState& state, const FunctionCall& call)
         return {"void", false, true};
     }
 
+    if (call.name == "flush") {
+        if (!call.args.empty()) {
+            error(state, "flush expects 0 arguments, got " + to_string(call.args.size()), call.line);
+        }
+
+        return {"void", false, true};
+    }
+
     size_t dot_pos = call.name.find('.');
 
     if (dot_pos != string::npos) {
@@ -231,6 +239,10 @@ TypeInfo check_function_call(TypeCheckerState& state, const FunctionCall& call)
             return {"unknown", false, false};
         }
 
+        if (!func->type_params.empty()) {
+            return check_generic_call(state, call, *func);
+        }
+
         if (call.args.size() != func->params.size()) {
             error(state, "function '" + call.name + "' expects " + to_string(func->params.size()) + " arguments, got " + to_string(call.args.size()), call.line);
         }
@@ -290,6 +302,10 @@ TypeInfo check_function_call(TypeCheckerState& state, const FunctionCall& call)
     if (state.functions.find(call.name) != state.functions.end()) {
         const FunctionDef* func = state.functions[call.name];
 
+        if (!func->type_params.empty()) {
+            return check_generic_call(state, call, *func);
+        }
+
         if (call.args.size() != func->params.size()) {
             error(state, "function '" + call.name + "' expects " + to_string(func->params.size()) + " arguments, got " + to_string(call.args.size()), call.line);
         }
@@ -339,6 +355,10 @@ TypeInfo check_function_call(TypeCheckerState& state, const FunctionCall& call)
     if (alias && alias->member_type == "function") {
         const FunctionDef* func = get_qualified_function(state, alias->module_alias, alias->member_name);
 
+        if (func && !func->type_params.empty()) {
+            return check_generic_call(state, call, *func);
+        }
+
         if (func) {
             if (call.args.size() != func->params.size()) {
                 error(state, "function '" + call.name + "' expects " + to_string(func->params.size()) + " arguments, got " + to_string(call.args.size()), call.line);
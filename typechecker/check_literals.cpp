@@ -4,6 +4,8 @@
  */
 
 #include "typechecker.hpp"
+#include "common/format_spec.hpp"
+#include <algorithm>
 
 using namespace std;
 
@@ -36,6 +38,59 @@ TypeInfo check_string_literal(TypeCheckerState& state, const StringLiteral& lit)
     return {"str", false, false};
 }
 
+/**
+ * Checks that a format spec parses and suits a value of the given type.
+ * Integers take d x X o b, floats take f e g and a precision; str and bool
+ * only take fill, alignment and width.
+ */
+static void check_format_spec(TypeCheckerState& state, const string& spec, const string& type, int line) {
+    bishop::FormatSpec parsed;
+
+    if (!bishop::parse_format_spec(spec, parsed)) {
+        error(state, "invalid format spec '" + spec + "'", line);
+        return;
+    }
+
+    bool is_integer = type == "int" || type == "u32" || type == "u64" || type == "cint";
+    bool is_float = type == "f32" || type == "f64";
+    string types = is_integer ? "dxXob" : is_float ? "feg" : "";
+
+    if (parsed.type != '\0' && types.find(parsed.type) == string::npos) {
+        error(state, "format type '" + string(1, parsed.type) + "' is not valid for '" + type + "'", line);
+    }
+
+    if (parsed.precision >= 0 && !is_float) {
+        error(state, "format precision is only valid for floats, got '" + type + "'", line);
+    }
+}
+
+/**
+ * Infers the type of an f-string. Each interpolated value must be a
+ * primitive, since it is formatted directly into the result.
+ */
+TypeInfo check_format_string(TypeCheckerState& state, const FormatString& fstr) {
+    static const vector<string> formattable = {"int", "u32", "u64", "cint", "f32", "f64", "bool", "str"};
+
+    for (size_t i = 0; i < fstr.values.size(); i++) {
+        TypeInfo type = infer_type(state, *fstr.values[i]);
+
+        if (type.base_type == "unknown") {
+            continue;
+        }
+
+        if (type.is_optional || ranges::find(formattable, type.base_type) == formattable.end()) {
+            error(state, "cannot interpolate value of type '" + format_type(type) + "'", fstr.line);
+            continue;
+        }
+
+        if (!fstr.specs[i].empty()) {
+            check_format_spec(state, fstr.specs[i], type.base_type, fstr.line);
+        }
+    }
+
+    return {"str", false, false};
+}
+
 /**
  * Infers the type of a bool literal.
  */
@@ -143,7 +143,7 @@ TypeInfo check_struct_method(TypeCheckerState& state, const MethodCall& mcall, c
     }
 
     const MethodDef* method = nullptr;
-    size_t dot_pos = obj_type.base_type.find('.');
+    size_t dot_pos = bishop::split_generic_type(obj_type.base_type).first.find('.');
 
     if (dot_pos != string::npos) {
         string module_name = obj_type.base_type.substr(0, dot_pos);
@@ -173,7 +173,7 @@ TypeInfo check_struct_method(TypeCheckerState& state, const MethodCall& mcall, c
 
     for (size_t i = 0; i < mcall.args.size() && i + 1 < method->params.size(); i++) {
         TypeInfo arg_type = infer_type(state, *mcall.args[i]);
-        TypeInfo param_type = {method->params[i + 1].type, false, false};
+        TypeInfo param_type = {struct_member_type(method->type_params, obj_type.base_type, method->params[i + 1].type), false, false};
 
         if (!types_compatible(param_type, arg_type)) {
             error(state, "argument " + to_string(i + 1) + " of method '" + mcall.method_name +
@@ -183,7 +183,7 @@ TypeInfo check_struct_method(TypeCheckerState& state, const MethodCall& mcall, c
 
     bool is_fallible = !method->error_type.empty();
     return method->return_type.empty() ? TypeInfo{"void", false, true, is_fallible}
-                                       : TypeInfo{method->return_type, false, false, is_fallible};
+                                       : TypeInfo{struct_member_type(method->type_params, obj_type.base_type, method->return_type), false, false, is_fallible};
 }
 
 /**
@@ -270,6 +270,17 @@ TypeInfo check_method_call(TypeCheckerState& state, const MethodCall& mcall) {
         return check_tuple_method(state, mcall, element_type);
     }
 
+    if (effective_type.base_type.rfind("[", 0) == 0) {
+        auto [size, element_type] = bishop::extract_array_type(effective_type.base_type);
+
+        if (element_type.empty()) {
+            error(state, "malformed array type '" + effective_type.base_type + "'", mcall.line);
+            return {"unknown", false, false};
+        }
+
+        return check_array_method(state, mcall, element_type);
+    }
+
     if (effective_type.base_type.rfind("Deque<", 0) == 0) {
         string element_type = extract_element_type(effective_type.base_type, "Deque<");
 
@@ -325,10 +336,26 @@ TypeInfo check_method_call(TypeCheckerState& state, const MethodCall& mcall) {
         return check_set_method(state, mcall, element_type);
     }
 
+    if (effective_type.base_type.rfind("SoaList<", 0) == 0) {
+        string element_type = extract_element_type(effective_type.base_type, "SoaList<");
+
+        if (element_type.empty()) {
+            error(state, "malformed SoaList type '" + effective_type.base_type + "'", mcall.line);
+            return {"unknown", false, false};
+        }
+
+        return check_soa_list_method(state, mcall, element_type);
+    }
+
     if (effective_type.base_type == "str") {
         return check_str_method(state, mcall);
     }
 
+    if (is_soa_element(state, *mcall.object)) {
+        error(state, "cannot call method '" + mcall.method_name + "' on a SoaList element; copy it with get() first", mcall.line);
+        return {"unknown", false, false};
+    }
+
     return check_struct_method(state, mcall, effective_type);
 }
 
@@ -63,7 +63,12 @@ TypeInfo check_function_ref(TypeCheckerState& state, const FunctionRef& fref) {
         return {"fn:" + fref.name, false, false};
     }
 
-    if (state.functions.find(fref.name) != state.functions.end()) {
+    if (auto it = state.functions.find(fref.name); it != state.functions.end()) {
+        if (!it->second->type_params.empty()) {
+            error(state, "generic function '" + fref.name + "' cannot be used as a value", fref.line);
+            return {"unknown", false, false};
+        }
+
         return {"fn:" + fref.name, false, false};
     }
 
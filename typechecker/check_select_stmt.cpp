@@ -13,11 +13,42 @@ namespace typechecker {
  * Type checks a select statement.
  */
 void check_select_stmt(TypeCheckerState& state, const SelectStmt& select_stmt) {
+    bool has_fallback = false;
+
     for (const auto& select_case : select_stmt.cases) {
         // Each case introduces its own scope so bindings and declarations inside one
         // case do not leak into other cases or after the select statement.
         push_scope(state);
 
+        if (select_case->operation == "default" || select_case->operation == "timeout") {
+            if (has_fallback) {
+                error(state, "select can have only one default or timeout case", select_case->line);
+            }
+
+            has_fallback = true;
+
+            if (select_case->timeout) {
+                TypeInfo timeout_type = infer_type(state, *select_case->timeout);
+
+                if (timeout_type.base_type != "int" || timeout_type.is_optional) {
+                    error(state, "select timeout expects milliseconds as 'int', got '" + format_type(timeout_type) + "'", select_case->line);
+                }
+            }
+
+            for (const auto& s : select_case->body) {
+                check_statement(state, *s);
+            }
+
+            pop_scope(state);
+            continue;
+        }
+
+        if (!select_case->channel || (select_case->operation != "recv" && select_case->operation != "send")) {
+            error(state, "select case must be a channel recv() or send()", select_case->line);
+            pop_scope(state);
+            continue;
+        }
+
         TypeInfo channel_type = infer_type(state, *select_case->channel);
 
         if (channel_type.base_type.rfind("Channel<", 0) != 0) {
@@ -38,6 +69,10 @@ void check_select_stmt(TypeCheckerState& state, const SelectStmt& select_stmt) {
             declare_local(state, select_case->binding_name, {element_type, false, false}, select_case->line);
         }
 
+        if (select_case->operation == "send" && !select_case->send_value) {
+            error(state, "select send expects a value", select_case->line);
+        }
+
         if (select_case->operation == "send" && select_case->send_value) {
             TypeInfo val_type = infer_type(state, *select_case->send_value);
             TypeInfo expected = {element_type, false, false};
@@ -0,0 +1,90 @@
+/**
+ * @file check_soa_list.cpp
+ * @brief SoaList type inference for the Bishop type checker.
+ */
+
+#include "typechecker.hpp"
+#include "soa_lists.hpp"
+#include <algorithm>
+
+using namespace std;
+
+namespace typechecker {
+
+/**
+ * Returns true if the type names a struct marked @soa.
+ */
+bool is_soa_struct(const TypeCheckerState& state, const string& type) {
+    const StructDef* sdef = get_struct(state, type);
+    return sdef && ranges::find(sdef->attributes, "soa") != sdef->attributes.end();
+}
+
+/**
+ * Returns true if the expression is a for-each variable bound to a SoaList
+ * element. Such a variable is a set of references into the columns rather
+ * than a struct value, so it has no methods and no address.
+ */
+bool is_soa_element(const TypeCheckerState& state, const ASTNode& node) {
+    auto* ref = dynamic_cast<const VariableRef*>(&node);
+
+    if (!ref) {
+        return false;
+    }
+
+    const TypeInfo* local = lookup_local(state, ref->name);
+    return local && state.soa_elements.count(local);
+}
+
+/**
+ * Infers the type of a SoaList creation expression.
+ */
+TypeInfo check_soa_list_create(TypeCheckerState& state, const SoaListCreate& soa) {
+    if (!is_soa_struct(state, soa.element_type)) {
+        error(state, "SoaList element type '" + soa.element_type + "' must be a struct marked @soa", soa.line);
+        return {"unknown", false, false};
+    }
+
+    return {"SoaList<" + soa.element_type + ">", false, false};
+}
+
+/**
+ * Type checks a method call on a SoaList.
+ */
+TypeInfo check_soa_list_method(TypeCheckerState& state, const MethodCall& mcall, const string& element_type) {
+    auto method_info = bishop::get_soa_list_method_info(mcall.method_name);
+
+    if (!method_info) {
+        error(state, "SoaList has no method '" + mcall.method_name + "'", mcall.line);
+        return {"unknown", false, false};
+    }
+
+    const auto& [param_types, return_type] = *method_info;
+
+    if (mcall.args.size() != param_types.size()) {
+        error(state, "method '" + mcall.method_name + "' expects " +
+              to_string(param_types.size()) + " arguments, got " +
+              to_string(mcall.args.size()), mcall.line);
+    }
+
+    for (size_t i = 0; i < mcall.args.size() && i < param_types.size(); i++) {
+        TypeInfo arg_type = infer_type(state, *mcall.args[i]);
+        string expected = param_types[i] == "T" ? element_type : param_types[i];
+        TypeInfo expected_type = {expected, false, false};
+
+        if (!types_compatible(expected_type, arg_type)) {
+            error(state, "argument " + to_string(i + 1) + " of method '" +
+                  mcall.method_name + "' expects '" + expected +
+                  "', got '" + format_type(arg_type) + "'", mcall.line);
+        }
+    }
+
+    string ret = return_type == "T" ? element_type : return_type;
+
+    if (ret == "void") {
+        return {"void", false, true};
+    }
+
+    return {ret, false, false};
+}
+
+} // namespace typechecker
@@ -31,6 +31,15 @@ TypeInfo check_struct_literal(TypeCheckerState& state, const StructLiteral& lit)
         return {"unknown", false, false};
     }
 
+    if (!sdef->type_params.empty()) {
+        return check_generic_struct_literal(state, lit, *sdef, struct_name);
+    }
+
+    if (!lit.type_args.empty()) {
+        error(state, "struct '" + lit.struct_name + "' is not generic", lit.line);
+        return {"unknown", false, false};
+    }
+
     for (const auto& [field_name, field_val] : lit.field_values) {
         string expected_type;
 
@@ -26,6 +26,7 @@ void check_variable_decl_stmt(TypeCheckerState& state, const VariableDecl& decl)
         }
 
         TypeInfo init_type = infer_type(state, *decl.value);
+        decl.resolved_type = decl.type.empty() ? init_type.base_type : decl.type;
 
         if (!decl.type.empty()) {
             TypeInfo expected = {decl.type, decl.is_optional, false};
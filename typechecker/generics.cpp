@@ -0,0 +1,320 @@
+/**
+ * @file generics.cpp
+ * @brief Generic functions and structs for the Bishop type checker.
+ *
+ * A generic definition is checked once, with its type parameters standing
+ * in as opaque types. Each use binds the parameters to concrete types,
+ * either written out (Box<int>) or inferred by matching parameter types
+ * against argument types, and codegen emits the definition as a C++
+ * template that the C++ compiler specializes per use.
+ */
+
+#include "typechecker.hpp"
+#include "common/type_utils.hpp"
+#include <algorithm>
+
+using namespace std;
+
+namespace typechecker {
+
+/**
+ * Joins type arguments into a generic type: Box + {int, str} -> Box<int, str>.
+ */
+string generic_type_name(const string& name, const vector<string>& args) {
+    string out = name + "<";
+
+    for (size_t i = 0; i < args.size(); i++) {
+        out += (i == 0 ? "" : ", ") + args[i];
+    }
+
+    return out + ">";
+}
+
+/**
+ * Returns a member type of a generic struct instance with the instance's
+ * type arguments substituted: field `value T` of Box<int> is an int.
+ * Types of non-generic structs are returned unchanged.
+ */
+string struct_member_type(const vector<string>& type_params, const string& struct_type, const string& member_type) {
+    if (type_params.empty()) {
+        return member_type;
+    }
+
+    string base = struct_type;
+
+    if (!base.empty() && base.back() == '*') {
+        base.pop_back();
+    }
+
+    return bishop::substitute_type_params(member_type, type_params, bishop::split_generic_type(base).second);
+}
+
+/**
+ * Builds the function type of a named function: fn(int, int) -> int.
+ */
+static string function_signature(const FunctionDef& func) {
+    string sig = "fn(";
+
+    for (size_t i = 0; i < func.params.size(); i++) {
+        sig += (i == 0 ? "" : ", ") + func.params[i].type;
+    }
+
+    sig += ")";
+
+    if (!func.return_type.empty() && func.return_type != "void") {
+        sig += " -> " + func.return_type;
+    }
+
+    return sig;
+}
+
+/**
+ * Splits a function type into its parameter types and return type
+ * (empty for void). Returns false if the type is not a function type.
+ */
+static bool split_function_type(const string& type, vector<string>& params, string& ret) {
+    if (type.rfind("fn(", 0) != 0) {
+        return false;
+    }
+
+    int depth = 1;
+    size_t close = 3;
+
+    for (; close < type.size() && depth > 0; close++) {
+        if (type[close] == '(') depth++;
+        else if (type[close] == ')') depth--;
+    }
+
+    if (depth != 0) {
+        return false;
+    }
+
+    params = bishop::split_type_list(type.substr(3, close - 4));
+    size_t arrow = type.find(" -> ", close - 1);
+    ret = arrow == string::npos ? "" : type.substr(arrow + 4);
+    return true;
+}
+
+/**
+ * Matches a parameter type that may mention type parameters against the
+ * type of an argument, recording what each type parameter stands for.
+ * Parts that don't line up are left for the usual compatibility check.
+ * Returns false and names the parameter in conflict when one type
+ * parameter would have to stand for two different types.
+ */
+static bool unify_type(const TypeCheckerState& state, const string& param, string arg,
+                       const vector<string>& type_params, map<string, string>& bindings, string& conflict) {
+    if (arg.empty() || arg == "unknown" || arg == "none") {
+        return true;
+    }
+
+    if (ranges::find(type_params, param) != type_params.end()) {
+        auto [it, inserted] = bindings.insert({param, arg});
+
+        if (!inserted && it->second != arg) {
+            conflict = param;
+            return false;
+        }
+
+        return true;
+    }
+
+    // A named function passed as an argument: match against its signature
+    if (arg.rfind("fn:", 0) == 0) {
+        string name = arg.substr(3);
+        size_t dot = name.find('.');
+        const FunctionDef* func = nullptr;
+
+        if (dot != string::npos) {
+            func = get_qualified_function(state, name.substr(0, dot), name.substr(dot + 1));
+        } else if (auto it = state.functions.find(name); it != state.functions.end()) {
+            func = it->second;
+        }
+
+        if (!func) {
+            return true;
+        }
+
+        arg = function_signature(*func);
+    }
+
+    vector<string> param_fn_params, arg_fn_params;
+    string param_ret, arg_ret;
+
+    if (split_function_type(param, param_fn_params, param_ret) && split_function_type(arg, arg_fn_params, arg_ret)) {
+        for (size_t i = 0; i < param_fn_params.size() && i < arg_fn_params.size(); i++) {
+            if (!unify_type(state, param_fn_params[i], arg_fn_params[i], type_params, bindings, conflict)) {
+                return false;
+            }
+        }
+
+        return param_ret.empty() || unify_type(state, param_ret, arg_ret, type_params, bindings, conflict);
+    }
+
+    if (param.size() > 1 && param.back() == '*' && arg.back() == '*') {
+        return unify_type(state, param.substr(0, param.size() - 1), arg.substr(0, arg.size() - 1),
+                          type_params, bindings, conflict);
+    }
+
+    if (param.rfind("[", 0) == 0) {
+        auto [param_size, param_element] = bishop::extract_array_type(param);
+        auto [arg_size, arg_element] = bishop::extract_array_type(arg);
+
+        if (!param_element.empty() && param_size == arg_size) {
+            return unify_type(state, param_element, arg_element, type_params, bindings, conflict);
+        }
+
+        return true;
+    }
+
+    auto [param_name, param_args] = bishop::split_generic_type(param);
+    auto [arg_name, arg_args] = bishop::split_generic_type(arg);
+
+    if (param_args.empty() || param_name != arg_name || param_args.size() != arg_args.size()) {
+        return true;
+    }
+
+    for (size_t i = 0; i < param_args.size(); i++) {
+        if (!unify_type(state, param_args[i], arg_args[i], type_params, bindings, conflict)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Collects the bound type arguments in parameter order. Reports the first
+ * type parameter nothing bound and returns false.
+ */
+static bool bound_type_args(TypeCheckerState& state, const vector<string>& type_params,
+                            const map<string, string>& bindings, const string& what, int line,
+                            vector<string>& args) {
+    for (const auto& p : type_params) {
+        auto it = bindings.find(p);
+
+        if (it == bindings.end()) {
+            error(state, "cannot infer type parameter '" + p + "' of " + what, line);
+            return false;
+        }
+
+        args.push_back(it->second);
+    }
+
+    return true;
+}
+
+/**
+ * Type checks a call to a generic function. The type arguments are
+ * inferred from the arguments and recorded on the call for codegen.
+ */
+TypeInfo check_generic_call(TypeCheckerState& state, const FunctionCall& call, const FunctionDef& func) {
+    if (call.args.size() != func.params.size()) {
+        error(state, "function '" + call.name + "' expects " + to_string(func.params.size()) + " arguments, got " + to_string(call.args.size()), call.line);
+    }
+
+    vector<TypeInfo> arg_types;
+    map<string, string> bindings;
+
+    for (size_t i = 0; i < call.args.size(); i++) {
+        arg_types.push_back(infer_type(state, *call.args[i]));
+        string conflict;
+
+        if (i < func.params.size() &&
+            !unify_type(state, func.params[i].type, arg_types[i].base_type, func.type_params, bindings, conflict)) {
+            error(state, "argument " + to_string(i + 1) + " of function '" + call.name + "' needs type parameter '" +
+                  conflict + "' to be '" + bindings[conflict] + "', got '" + format_type(arg_types[i]) + "'", call.line);
+            return {"unknown", false, false};
+        }
+    }
+
+    vector<string> type_args;
+
+    if (!bound_type_args(state, func.type_params, bindings, "function '" + call.name + "'", call.line, type_args)) {
+        return {"unknown", false, false};
+    }
+
+    call.type_args = type_args;
+
+    for (size_t i = 0; i < arg_types.size() && i < func.params.size(); i++) {
+        TypeInfo param_type = {bishop::substitute_type_params(func.params[i].type, func.type_params, type_args), false, false};
+
+        if (!types_compatible(param_type, arg_types[i])) {
+            error(state, "argument " + to_string(i + 1) + " of function '" + call.name +
+                  "' expects '" + format_type(param_type) + "', got '" + format_type(arg_types[i]) + "'", call.line);
+        }
+    }
+
+    bool fallible = !func.error_type.empty();
+
+    if (func.return_type.empty()) {
+        return {"void", false, true, fallible};
+    }
+
+    return {bishop::substitute_type_params(func.return_type, func.type_params, type_args), false, false, fallible};
+}
+
+/**
+ * Type checks a literal of a generic struct. Type arguments are taken as
+ * written (Box<int> { ... }) or inferred from the field values and
+ * recorded on the literal for codegen.
+ */
+TypeInfo check_generic_struct_literal(TypeCheckerState& state, const StructLiteral& lit, const StructDef& sdef,
+                                      const string& struct_name) {
+    vector<string> type_args = lit.type_args;
+
+    if (!type_args.empty() && type_args.size() != sdef.type_params.size()) {
+        error(state, "struct '" + lit.struct_name + "' expects " + to_string(sdef.type_params.size()) +
+              " type arguments, got " + to_string(type_args.size()), lit.line);
+        return {"unknown", false, false};
+    }
+
+    for (const auto& arg : type_args) {
+        if (!is_valid_type(state, arg)) {
+            error(state, "unknown type '" + arg + "'", lit.line);
+            return {"unknown", false, false};
+        }
+    }
+
+    vector<pair<const StructField*, TypeInfo>> values;
+    map<string, string> bindings;
+
+    for (const auto& [field_name, field_val] : lit.field_values) {
+        auto field = ranges::find_if(sdef.fields, [&](const StructField& f) { return f.name == field_name; });
+
+        if (field == sdef.fields.end()) {
+            error(state, "struct '" + lit.struct_name + "' has no field '" + field_name + "'", lit.line);
+            continue;
+        }
+
+        TypeInfo val_type = infer_type(state, *field_val);
+        string conflict;
+
+        if (lit.type_args.empty() &&
+            !unify_type(state, field->type, val_type.base_type, sdef.type_params, bindings, conflict)) {
+            error(state, "field '" + field_name + "' needs type parameter '" + conflict + "' to be '" +
+                  bindings[conflict] + "', got '" + format_type(val_type) + "'", lit.line);
+            return {"unknown", false, false};
+        }
+
+        values.push_back({&*field, val_type});
+    }
+
+    if (lit.type_args.empty() &&
+        !bound_type_args(state, sdef.type_params, bindings, "struct '" + lit.struct_name + "'", lit.line, type_args)) {
+        return {"unknown", false, false};
+    }
+
+    for (const auto& [field, val_type] : values) {
+        string expected_type = bishop::substitute_type_params(field->type, sdef.type_params, type_args);
+
+        if (!types_compatible({expected_type, false, false}, val_type)) {
+            error(state, "field '" + field->name + "' expects '" + expected_type + "', got '" + format_type(val_type) + "'", lit.line);
+        }
+    }
+
+    lit.type_args = type_args;
+    return {generic_type_name(struct_name, type_args), false, false};
+}
+
+} // namespace typechecker
@@ -0,0 +1,139 @@
+/**
+ * @file soa_lists.cpp
+ * @brief SoaList method type definitions for the Bishop type checker.
+ *
+ * Defines type signatures for all built-in SoaList<T> methods.
+ * Uses "T" as a placeholder for the element type, which is
+ * substituted with the actual type at type check time.
+ */
+
+/**
+ * @bishop_method length
+ * @type SoaList<T>
+ * @description Returns the number of elements in the list.
+ * @returns int - The number of elements
+ * @example
+ * ps := SoaList<Particle>();
+ * n := ps.length();  // 0
+ */
+
+/**
+ * @bishop_method is_empty
+ * @type SoaList<T>
+ * @description Checks if the list has no elements.
+ * @returns bool - True if empty, false otherwise
+ * @example
+ * ps := SoaList<Particle>();
+ * empty := ps.is_empty();  // true
+ */
+
+/**
+ * @bishop_method get
+ * @type SoaList<T>
+ * @description Gathers the element at the specified index from its columns (bounds-checked).
+ * @param index int - The index (0-based)
+ * @returns T - A copy of the element
+ * @example
+ * p := ps.get(0);
+ * p.reset();
+ */
+
+/**
+ * @bishop_method first
+ * @type SoaList<T>
+ * @description Returns a copy of the first element.
+ * @returns T - The first element
+ * @example
+ * p := ps.first();
+ */
+
+/**
+ * @bishop_method last
+ * @type SoaList<T>
+ * @description Returns a copy of the last element.
+ * @returns T - The last element
+ * @example
+ * p := ps.last();
+ */
+
+/**
+ * @bishop_method append
+ * @type SoaList<T>
+ * @description Scatters an element's fields onto the end of each column.
+ * @param value T - The element to add
+ * @example
+ * ps.append(Particle { x: 0.0, vx: 1.5 });
+ */
+
+/**
+ * @bishop_method pop
+ * @type SoaList<T>
+ * @description Removes and returns the last element.
+ * @returns T - The removed element
+ * @example
+ * p := ps.pop();
+ */
+
+/**
+ * @bishop_method set
+ * @type SoaList<T>
+ * @description Replaces the element at the specified index (bounds-checked).
+ * @param index int - The index (0-based)
+ * @param value T - The new element
+ * @example
+ * ps.set(0, Particle { x: 1.0, vx: 0.0 });
+ */
+
+/**
+ * @bishop_method clear
+ * @type SoaList<T>
+ * @description Removes all elements from every column.
+ * @example
+ * ps.clear();
+ */
+
+/**
+ * @bishop_method remove
+ * @type SoaList<T>
+ * @description Removes the element at the specified index.
+ * @param index int - The index to remove
+ * @example
+ * ps.remove(0);
+ */
+
+#include "soa_lists.hpp"
+
+#include <map>
+
+namespace bishop {
+
+std::optional<SoaListMethodInfo> get_soa_list_method_info(const std::string& method_name) {
+    // "T" is placeholder for element type, substituted at type check time
+    static const std::map<std::string, SoaListMethodInfo> soa_list_methods = {
+        // Query methods
+        {"length", {{}, "int"}},
+        {"is_empty", {{}, "bool"}},
+
+        // Access methods
+        {"get", {{"int"}, "T"}},
+        {"first", {{}, "T"}},
+        {"last", {{}, "T"}},
+
+        // Modification methods
+        {"append", {{"T"}, "void"}},
+        {"pop", {{}, "T"}},
+        {"set", {{"int", "T"}, "void"}},
+        {"clear", {{}, "void"}},
+        {"remove", {{"int"}, "void"}},
+    };
+
+    auto it = soa_list_methods.find(method_name);
+
+    if (it != soa_list_methods.end()) {
+        return it->second;
+    }
+
+    return std::nullopt;
+}
+
+}  // namespace bishop
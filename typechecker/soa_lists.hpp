@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <optional>
+
+namespace bishop {
+
+/**
+ * Represents a SoaList method signature with parameter types and return type.
+ * Uses "T" as a placeholder for the element type.
+ */
+struct SoaListMethodInfo {
+    std::vector<std::string> param_types;
+    std::string return_type;
+};
+
+/**
+ * Returns type information for built-in SoaList methods.
+ * Returns nullopt if the method is not found.
+ */
+std::optional<SoaListMethodInfo> get_soa_list_method_info(const std::string& method_name);
+
+}  // namespace bishop
@@ -9,6 +9,7 @@
 #include "typechecker.hpp"
 #include "common/type_utils.hpp"
 #include <optional>
+#include <algorithm>
 
 using namespace std;
 
@@ -129,6 +130,24 @@ void collect_methods(TypeCheckerState& state, const Program& program) {
             continue;
         }
 
+        const StructDef* sdef = state.structs[m->struct_name];
+
+        if (m->type_params.size() != sdef->type_params.size()) {
+            if (sdef->type_params.empty()) {
+                error(state, "struct '" + m->struct_name + "' is not generic", m->line);
+            } else {
+                error(state, "method '" + m->name + "' must name the type parameters of '" + m->struct_name + "': " +
+                      generic_type_name(m->struct_name, sdef->type_params) + " :: " + m->name, m->line);
+            }
+
+            continue;
+        }
+
+        if (m->is_static && !sdef->type_params.empty()) {
+            error(state, "generic struct '" + m->struct_name + "' cannot have static method '" + m->name + "'", m->line);
+            continue;
+        }
+
         auto& struct_methods = state.methods[m->struct_name];
 
         for (const auto* existing : struct_methods) {
@@ -219,10 +238,25 @@ bool is_valid_type(const TypeCheckerState& state, const string& type) {
         return true;
     }
 
-    if (state.structs.find(type) != state.structs.end()) {
+    if (ranges::find(state.type_params, type) != state.type_params.end()) {
         return true;
     }
 
+    // A generic struct is only a type once it has its type arguments
+    if (auto it = state.structs.find(type); it != state.structs.end()) {
+        return it->second->type_params.empty();
+    }
+
+    auto [generic_name, type_args] = bishop::split_generic_type(type);
+
+    if (auto it = state.structs.find(generic_name); it != state.structs.end() && !type_args.empty()) {
+        if (it->second->type_params.size() != type_args.size()) {
+            return false;
+        }
+
+        return ranges::all_of(type_args, [&](const string& arg) { return is_valid_type(state, arg); });
+    }
+
     if (type.rfind("fn:", 0) == 0 || type.rfind("fn(", 0) == 0) {
         return true;
     }
@@ -267,6 +301,16 @@ bool is_valid_type(const TypeCheckerState& state, const string& type) {
         return is_valid_type(state, element_type);
     }
 
+    if (type.rfind("[", 0) == 0) {
+        auto [size, element_type] = bishop::extract_array_type(type);
+
+        if (element_type.empty()) {
+            return false;
+        }
+
+        return is_valid_type(state, element_type);
+    }
+
     if (type.rfind("Deque<", 0) == 0 && type.back() == '>') {
         string element_type = extract_element_type(type, "Deque<");
 
@@ -317,11 +361,16 @@ bool is_valid_type(const TypeCheckerState& state, const string& type) {
         return is_valid_type(state, element_type);
     }
 
+    if (type.rfind("SoaList<", 0) == 0 && type.back() == '>') {
+        return is_soa_struct(state, extract_element_type(type, "SoaList<"));
+    }
+
     // Pointer type: StructName* -> check that base is a valid struct
     if (!type.empty() && type.back() == '*') {
         string pointee = type.substr(0, type.length() - 1);
         // Only struct pointers are allowed, not primitive pointers
-        return state.structs.find(pointee) != state.structs.end();
+        return state.structs.find(bishop::split_generic_type(pointee).first) != state.structs.end() &&
+               is_valid_type(state, pointee);
     }
 
     size_t dot_pos = type.find('.');
@@ -463,6 +512,13 @@ const StructDef* get_struct(const TypeCheckerState& state, const string& name) {
         return it->second;
     }
 
+    // Instance of a generic struct: Box<int>
+    auto [generic_name, type_args] = bishop::split_generic_type(name);
+
+    if (!type_args.empty() && (it = state.structs.find(generic_name)) != state.structs.end()) {
+        return it->second;
+    }
+
     size_t dot_pos = name.find('.');
 
     if (dot_pos != string::npos) {
@@ -478,7 +534,7 @@ const StructDef* get_struct(const TypeCheckerState& state, const string& name) {
  * Looks up a method on a struct. Returns nullptr if not found.
  */
 const MethodDef* get_method(const TypeCheckerState& state, const string& struct_name, const string& method_name) {
-    auto it = state.methods.find(struct_name);
+    auto it = state.methods.find(bishop::split_generic_type(struct_name).first);
 
     if (it == state.methods.end()) {
         return nullptr;
@@ -505,7 +561,7 @@ string get_field_type(const TypeCheckerState& state, const string& struct_name,
 
     for (const auto& field : sdef->fields) {
         if (field.name == field_name) {
-            return field.type;
+            return struct_member_type(sdef->type_params, struct_name, field.type);
         }
     }
 
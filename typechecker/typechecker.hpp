@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
 #include <optional>
 #include "parser/ast.hpp"
 #include "project/module.hpp"
@@ -79,10 +80,12 @@ struct TypeCheckerState {
      * (e.g., using a variable declared inside an `if` block from outside that block).
      */
     std::vector<std::map<std::string, TypeInfo>> local_scopes;
+    std::set<const TypeInfo*> soa_elements;  ///< Locals bound to SoaList elements by for-each
     std::map<std::string, const Module*> imported_modules;
 
     // Current context
     std::string current_struct;
+    std::vector<std::string> type_params;  ///< Type parameters of the generic function or struct being checked
     TypeInfo current_return;
     bool current_function_is_fallible = false;
     bool in_main = false;
@@ -149,6 +152,7 @@ TypeInfo infer_type(TypeCheckerState& state, const ASTNode& expr);
 TypeInfo check_number_literal(TypeCheckerState& state, const NumberLiteral& lit);
 TypeInfo check_float_literal(TypeCheckerState& state, const FloatLiteral& lit);
 TypeInfo check_string_literal(TypeCheckerState& state, const StringLiteral& lit);
+TypeInfo check_format_string(TypeCheckerState& state, const FormatString& fstr);
 TypeInfo check_bool_literal(TypeCheckerState& state, const BoolLiteral& lit);
 TypeInfo check_none_literal(TypeCheckerState& state, const NoneLiteral& lit);
 
@@ -197,6 +201,10 @@ TypeInfo check_pair_field(TypeCheckerState& state, const FieldAccess& access, co
 TypeInfo check_tuple_create(TypeCheckerState& state, const TupleCreate& tuple);
 TypeInfo check_tuple_method(TypeCheckerState& state, const MethodCall& mcall, const std::string& element_type);
 
+// Fixed-size array type inference (check_array.cpp)
+TypeInfo check_array_create(TypeCheckerState& state, const ArrayCreate& array);
+TypeInfo check_array_method(TypeCheckerState& state, const MethodCall& mcall, const std::string& element_type);
+
 // Deque type inference (check_deque.cpp)
 TypeInfo check_deque_create(TypeCheckerState& state, const DequeCreate& deque);
 TypeInfo check_deque_method(TypeCheckerState& state, const MethodCall& mcall, const std::string& element_type);
@@ -218,6 +226,12 @@ TypeInfo check_set_create(TypeCheckerState& state, const SetCreate& set);
 TypeInfo check_set_literal(TypeCheckerState& state, const SetLiteral& set);
 TypeInfo check_set_method(TypeCheckerState& state, const MethodCall& mcall, const std::string& element_type);
 
+// SoaList type inference (check_soa_list.cpp)
+bool is_soa_struct(const TypeCheckerState& state, const std::string& type);
+bool is_soa_element(const TypeCheckerState& state, const ASTNode& node);
+TypeInfo check_soa_list_create(TypeCheckerState& state, const SoaListCreate& soa);
+TypeInfo check_soa_list_method(TypeCheckerState& state, const MethodCall& mcall, const std::string& element_type);
+
 // Function call type inference (check_function_call.cpp)
 TypeInfo check_function_call(TypeCheckerState& state, const FunctionCall& call);
 
@@ -234,6 +248,12 @@ TypeInfo check_field_access(TypeCheckerState& state, const FieldAccess& access);
 // Struct literal type inference (check_struct_literal.cpp)
 TypeInfo check_struct_literal(TypeCheckerState& state, const StructLiteral& lit);
 
+// Generic functions and structs (generics.cpp)
+std::string generic_type_name(const std::string& name, const std::vector<std::string>& args);
+std::string struct_member_type(const std::vector<std::string>& type_params, const std::string& struct_type, const std::string& member_type);
+TypeInfo check_generic_call(TypeCheckerState& state, const FunctionCall& call, const FunctionDef& func);
+TypeInfo check_generic_struct_literal(TypeCheckerState& state, const StructLiteral& lit, const StructDef& sdef, const std::string& struct_name);
+
 // Type utilities (typechecker.cpp)
 bool is_primitive_type(const std::string& type);
 bool is_valid_type(const TypeCheckerState& state, const std::string& type);